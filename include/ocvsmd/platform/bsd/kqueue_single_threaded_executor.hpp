@@ -6,6 +6,7 @@
 #ifndef OCVSMD_PLATFORM_BSD_KQUEUE_SINGLE_THREADED_EXECUTOR_HPP_INCLUDED
 #define OCVSMD_PLATFORM_BSD_KQUEUE_SINGLE_THREADED_EXECUTOR_HPP_INCLUDED
 
+#include "ocvsmd/platform/executor_profiler.hpp"
 #include "ocvsmd/platform/posix_executor_extension.hpp"
 #include "ocvsmd/platform/posix_platform_error.hpp"
 
@@ -27,7 +28,7 @@
 #include <cstdint>
 #include <ctime>
 #include <fcntl.h>
-#include <limits>
+#include <ratio>
 #include <sys/event.h>
 #include <thread>
 #include <unistd.h>
@@ -43,7 +44,8 @@ namespace bsd
 /// @brief Defines BSD Linux platform-specific single-threaded executor based on `kqueue` mechanism.
 ///
 class KqueueSingleThreadedExecutor final : public libcyphal::platform::SingleThreadedExecutor,
-                                           public IPosixExecutorExtension
+                                           public IPosixExecutorExtension,
+                                           public ExecutorProfiler
 {
 public:
     KqueueSingleThreadedExecutor()
@@ -65,6 +67,25 @@ public:
         }
     }
 
+    /// Gets total number of awaitable callbacks which have been made ready (scheduled) by the polling so far.
+    ///
+    /// F.e. the engine busy-poll loop uses it to tell an idle poll from a productive one.
+    ///
+    std::uint64_t readyAwaitablesCount() const noexcept
+    {
+        return ready_awaitables_;
+    }
+
+    /// Sets dispatch mode of ready awaitable callbacks - only the scheduled one is supported by this executor
+    /// (see `EpollSingleThreadedExecutor::setDispatch`), and so the drain budget is ignored.
+    ///
+    /// @return `false` if the direct mode is requested.
+    ///
+    bool setDispatch(const bool is_direct, const libcyphal::Duration) noexcept
+    {
+        return !is_direct;
+    }
+
     CETL_NODISCARD cetl::optional<PollFailure> pollAwaitableResourcesFor(
         const cetl::optional<libcyphal::Duration> timeout) const override
     {
@@ -90,15 +111,14 @@ public:
         const struct timespec* timeout_spec_ptr = nullptr;
         if (timeout)
         {
-            using PollDuration  = std::chrono::nanoseconds;
-            using TimeoutNsType = decltype(timespec::tv_nsec);
+            using PollDuration = std::chrono::nanoseconds;
 
-            // Fill nanoseconds part of the timeout spec taking into account the maximum possible value.
+            // Split the timeout into seconds and nanoseconds parts (the latter should be less than one second).
             //
-            timeout_spec.tv_nsec = static_cast<TimeoutNsType>(  //
-                std::max(static_cast<PollDuration::rep>(0),
-                         std::min(std::chrono::duration_cast<PollDuration>(*timeout).count(),
-                                  static_cast<PollDuration::rep>(std::numeric_limits<TimeoutNsType>::max()))));
+            const auto timeout_ns = std::max(static_cast<PollDuration::rep>(0),
+                                             std::chrono::duration_cast<PollDuration>(*timeout).count());
+            timeout_spec.tv_sec   = static_cast<decltype(timespec::tv_sec)>(timeout_ns / std::nano::den);
+            timeout_spec.tv_nsec  = static_cast<decltype(timespec::tv_nsec)>(timeout_ns % std::nano::den);
 
             timeout_spec_ptr = &timeout_spec;
         }
@@ -128,7 +148,12 @@ public:
             const KEvent& ev = evs[index];
             if (auto* const cb_interface = static_cast<AwaitableNode*>(ev.udata))
             {
+                if (cb_interface->isEvent())
+                {
+                    drainEvent(cb_interface->fd());
+                }
                 cb_interface->schedule(Callback::Schedule::Once{now_time});
+                ++ready_awaitables_;
             }
         }
 
@@ -152,6 +177,10 @@ protected:
                 [&new_cb_node](const Trigger::Writable& writable) {
                     //
                     new_cb_node.setup(writable.fd, EVFILT_WRITE);
+                },
+                [&new_cb_node](const Trigger::Event& event) {
+                    //
+                    new_cb_node.setup(event.fd, EVFILT_READ, true);
                 }),
             trigger);
 
@@ -167,6 +196,10 @@ protected:
         {
             return static_cast<IPosixExecutorExtension*>(this);
         }
+        if (id == ExecutorProfiler::_get_type_id_())
+        {
+            return static_cast<ExecutorProfiler*>(this);
+        }
         return Base::_cast_(id);
     }
     CETL_NODISCARD const void* _cast_(const cetl::type_id& id) const& noexcept override
@@ -175,6 +208,10 @@ protected:
         {
             return static_cast<const IPosixExecutorExtension*>(this);
         }
+        if (id == ExecutorProfiler::_get_type_id_())
+        {
+            return static_cast<const ExecutorProfiler*>(this);
+        }
         return Base::_cast_(id);
     }
 
@@ -192,6 +229,7 @@ private:
             : CallbackNode{executor, std::move(function)}
             , fd_{-1}
             , filter_{0}
+            , is_event_{false}
         {
         }
 
@@ -210,6 +248,7 @@ private:
             : CallbackNode(std::move(static_cast<CallbackNode&&>(other)))
             , fd_{std::exchange(other.fd_, -1)}
             , filter_{std::exchange(other.filter_, 0)}
+            , is_event_{other.is_event_}
         {
             if (fd_ >= 0)
             {
@@ -235,13 +274,21 @@ private:
             return filter_;
         }
 
-        void setup(const int fd, const std::int16_t filter) noexcept
+        /// Whether the fd is drained when found ready (see `Trigger::Event`).
+        ///
+        bool isEvent() const noexcept
+        {
+            return is_event_;
+        }
+
+        void setup(const int fd, const std::int16_t filter, const bool is_event = false) noexcept
         {
             CETL_DEBUG_ASSERT(fd >= 0, "");
             CETL_DEBUG_ASSERT(filter != 0, "");
 
-            fd_     = fd;
-            filter_ = filter;
+            fd_       = fd;
+            filter_   = filter;
+            is_event_ = is_event;
 
             getExecutor().total_awaitables_++;
             KEvent ev{};
@@ -261,6 +308,7 @@ private:
 
         int          fd_;
         std::int16_t filter_;
+        bool         is_event_;
 
     };  // AwaitableNode
 
@@ -268,8 +316,9 @@ private:
 
     static constexpr int MaxEvents = 16;
 
-    int         kqueuefd_;
-    std::size_t total_awaitables_;
+    int                   kqueuefd_;
+    std::size_t           total_awaitables_;
+    mutable std::uint64_t ready_awaitables_{0};
 
 };  // KqueueSingleThreadedExecutor
 
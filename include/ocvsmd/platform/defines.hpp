@@ -13,6 +13,8 @@
 
 #ifdef PLATFORM_OS_TYPE_BSD
 #    include "bsd/kqueue_single_threaded_executor.hpp"
+#elif defined(PLATFORM_USE_IO_URING)
+#    include "linux/io_uring_single_threaded_executor.hpp"
 #else
 #    include "linux/epoll_single_threaded_executor.hpp"
 #endif
@@ -27,6 +29,8 @@ namespace platform
 
 #ifdef PLATFORM_OS_TYPE_BSD
 using SingleThreadedExecutor = bsd::KqueueSingleThreadedExecutor;
+#elif defined(PLATFORM_USE_IO_URING)
+using SingleThreadedExecutor = Linux::IoUringSingleThreadedExecutor;
 #else
 using SingleThreadedExecutor = Linux::EpollSingleThreadedExecutor;
 #endif
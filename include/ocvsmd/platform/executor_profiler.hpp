@@ -0,0 +1,264 @@
+//
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#ifndef OCVSMD_PLATFORM_EXECUTOR_PROFILER_HPP_INCLUDED
+#define OCVSMD_PLATFORM_EXECUTOR_PROFILER_HPP_INCLUDED
+
+#include "log_linear_histogram.hpp"
+
+#include <cetl/rtti.hpp>
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <utility>
+
+namespace ocvsmd
+{
+namespace platform
+{
+
+/// Defines profiler of executor callbacks - a mixin of the platform executors.
+///
+/// Execution time of callbacks is measured (by `Scope` probes placed into callbacks of interest) per category,
+/// and the engine loop reports its spins (duration and scheduling lateness) - all into log-linear histograms.
+/// Any callback (or spin) which exceeds the budget is flagged by the stall watchdog (see `setStallHandler`).
+///
+/// Obtained from an executor via `cetl::rtti_cast<ExecutorProfiler*>(&executor)` - so `nullptr` (f.e. with
+/// a test executor) is allowed everywhere, and just disables the probes. A probe costs two steady clock reads
+/// and a histogram update (a few tens of nanoseconds), or a single branch if profiling is disabled.
+///
+/// Not thread-safe - in use on the executor thread only.
+///
+class ExecutorProfiler
+{
+    // 2655D7DE-20C5-459A-8E7F-A8C6BE3553F3
+    using TypeIdType = cetl::
+        // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+        type_id_type<0x26, 0x55, 0xD7, 0xDE, 0x20, 0xC5, 0x45, 0x9A, 0x8E, 0x7F, 0xA8, 0xC6, 0xBE, 0x35, 0x53, 0xF3>;
+
+public:
+    using Clock    = std::chrono::steady_clock;
+    using Duration = Clock::duration;
+
+    /// Defines categories of profiled callbacks.
+    ///
+    /// Note that probes may nest (f.e. `Service` handlers are called from within `IpcRead` callbacks).
+    ///
+    enum class Category : std::uint8_t
+    {
+        IpcAccept,
+        IpcRead,
+        UdpRx,
+        UdpTx,
+        CanRx,
+        CanTx,
+        Service,
+    };
+
+private:
+    static constexpr std::size_t CategoriesCount = static_cast<std::size_t>(Category::Service) + 1;
+
+public:
+    static constexpr std::size_t categoriesCount() noexcept
+    {
+        return CategoriesCount;
+    }
+
+    static const char* categoryName(const Category category) noexcept
+    {
+        switch (category)
+        {
+        case Category::IpcAccept:
+            return "ipc_accept";
+        case Category::IpcRead:
+            return "ipc_read";
+        case Category::UdpRx:
+            return "udp_rx";
+        case Category::UdpTx:
+            return "udp_tx";
+        case Category::CanRx:
+            return "can_rx";
+        case Category::CanTx:
+            return "can_tx";
+        case Category::Service:
+            return "service";
+        default:
+            return "?";
+        }
+    }
+
+    /// Defines statistics of execution time (in nanoseconds) of a category (or of the engine loop spins).
+    ///
+    struct Stats
+    {
+        LogLinearHistogram histogram;
+        std::uint64_t      over_budget{0};  ///< Number of executions which have exceeded the budget.
+    };
+
+    /// Defines the stall watchdog handler - called with the name of the category (or "spin"),
+    /// and the execution time which has exceeded the budget.
+    ///
+    using StallHandler = std::function<void(const char* what, Duration duration)>;
+
+    /// Defines RAII probe which measures execution time of its scope.
+    ///
+    class Scope final
+    {
+    public:
+        Scope(ExecutorProfiler* const profiler, const Category category) noexcept
+            : profiler_{((profiler != nullptr) && profiler->is_enabled_) ? profiler : nullptr}
+            , category_{category}
+            , start_{(profiler_ != nullptr) ? Clock::now() : Clock::time_point{}}
+        {
+        }
+
+        ~Scope()
+        {
+            if (profiler_ != nullptr)
+            {
+                profiler_->recordCallback(category_, Clock::now() - start_);
+            }
+        }
+
+        Scope(const Scope&)                = delete;
+        Scope(Scope&&) noexcept            = delete;
+        Scope& operator=(const Scope&)     = delete;
+        Scope& operator=(Scope&&) noexcept = delete;
+
+    private:
+        ExecutorProfiler* const profiler_;
+        const Category          category_;
+        const Clock::time_point start_;
+
+    };  // Scope
+
+    ExecutorProfiler(const ExecutorProfiler&)                = delete;
+    ExecutorProfiler(ExecutorProfiler&&) noexcept            = delete;
+    ExecutorProfiler& operator=(const ExecutorProfiler&)     = delete;
+    ExecutorProfiler& operator=(ExecutorProfiler&&) noexcept = delete;
+
+    bool isProfilingEnabled() const noexcept
+    {
+        return is_enabled_;
+    }
+
+    void setProfilingEnabled(const bool is_enabled) noexcept
+    {
+        is_enabled_ = is_enabled;
+    }
+
+    /// Sets the execution time budget of a single callback (or spin) - zero disables the stall watchdog.
+    ///
+    void setCallbackBudget(const Duration budget) noexcept
+    {
+        budget_ = budget;
+    }
+
+    Duration callbackBudget() const noexcept
+    {
+        return budget_;
+    }
+
+    void setStallHandler(StallHandler stall_handler)
+    {
+        stall_handler_ = std::move(stall_handler);
+    }
+
+    void recordCallback(const Category category, const Duration duration)
+    {
+        record(categories_[static_cast<std::size_t>(category)], duration, categoryName(category));
+    }
+
+    /// Records a single spin of the engine loop - its whole duration (of all executed callbacks),
+    /// and its worst scheduling lateness (if any).
+    ///
+    void recordSpin(const Duration duration, const Duration worst_lateness)
+    {
+        if (!is_enabled_)
+        {
+            return;
+        }
+        record(spins_, duration, "spin");
+        if (worst_lateness > Duration::zero())
+        {
+            lateness_.record(toNanoseconds(worst_lateness));
+        }
+    }
+
+    const Stats& callbackStats(const Category category) const noexcept
+    {
+        return categories_[static_cast<std::size_t>(category)];
+    }
+
+    const Stats& spinStats() const noexcept
+    {
+        return spins_;
+    }
+
+    /// Gets histogram of scheduling lateness (in nanoseconds) of the spins which have executed late callbacks.
+    ///
+    const LogLinearHistogram& latenessHistogram() const noexcept
+    {
+        return lateness_;
+    }
+
+    void resetProfilingStats() noexcept
+    {
+        for (auto& stats : categories_)
+        {
+            stats = Stats{};
+        }
+        spins_ = Stats{};
+        lateness_.reset();
+    }
+
+    // MARK: RTTI
+
+    static constexpr cetl::type_id _get_type_id_() noexcept
+    {
+        return cetl::type_id_type_value<TypeIdType>();
+    }
+
+protected:
+    ExecutorProfiler()  = default;
+    ~ExecutorProfiler() = default;
+
+private:
+    static std::uint64_t toNanoseconds(const Duration duration) noexcept
+    {
+        return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count());
+    }
+
+    void record(Stats& stats, const Duration duration, const char* const what)
+    {
+        stats.histogram.record(toNanoseconds(duration));
+        if ((budget_ > Duration::zero()) && (duration > budget_))
+        {
+            ++stats.over_budget;
+            if (stall_handler_)
+            {
+                stall_handler_(what, duration);
+            }
+        }
+    }
+
+    // MARK: Data members:
+
+    bool                               is_enabled_{true};
+    Duration                           budget_{Duration::zero()};
+    StallHandler                       stall_handler_;
+    std::array<Stats, CategoriesCount> categories_{};
+    Stats                              spins_{};
+    LogLinearHistogram                 lateness_{};
+
+};  // ExecutorProfiler
+
+}  // namespace platform
+}  // namespace ocvsmd
+
+#endif  // OCVSMD_PLATFORM_EXECUTOR_PROFILER_HPP_INCLUDED
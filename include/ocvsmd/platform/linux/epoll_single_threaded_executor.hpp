@@ -6,6 +6,7 @@
 #ifndef OCVSMD_PLATFORM_LINUX_EPOLL_SINGLE_THREADED_EXECUTOR_HPP_INCLUDED
 #define OCVSMD_PLATFORM_LINUX_EPOLL_SINGLE_THREADED_EXECUTOR_HPP_INCLUDED
 
+#include "ocvsmd/platform/executor_profiler.hpp"
 #include "ocvsmd/platform/posix_executor_extension.hpp"
 #include "ocvsmd/platform/posix_platform_error.hpp"
 
@@ -20,16 +21,20 @@
 #include <libcyphal/types.hpp>
 
 #include <algorithm>
-#include <array>
 #include <cerrno>
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <ctime>
 #include <limits>
+#include <ratio>
 #include <sys/epoll.h>
+#include <sys/timerfd.h>
 #include <thread>
 #include <unistd.h>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 namespace ocvsmd
 {
@@ -40,13 +45,34 @@ namespace Linux
 
 /// @brief Defines Linux platform-specific single-threaded executor based on `epoll` mechanism.
 ///
+/// Timeouts of the polling have nanosecond resolution - see `waitEvents` for details.
+///
+/// Registrations of awaitable callbacks are kept in a slab of slots owned by the executor (see `Slot`),
+/// so moving a callback costs no system call, and a removed registration stays "parked" in the epoll set
+/// for a while - so that re-registration of the same fd (f.e. by a re-created session) is a cheap `EPOLL_CTL_MOD`
+/// instead of a `EPOLL_CTL_DEL`/`EPOLL_CTL_ADD` pair.
+///
+/// Only one (live) registration per fd is supported - another trigger of an already registered fd
+/// is refused (see `registerAwaitableCallback`).
+///
+/// Ready events are fetched in adaptive batches - a full batch grows the next one (up to `MaxEpollEvents`),
+/// and keeps the polling draining (without blocking) for up to the drain budget. In the direct dispatch mode
+/// (see `setDispatch`) the ready callbacks are executed right by the polling (in readiness order),
+/// instead of being scheduled for the next `spinOnce`.
+///
 class EpollSingleThreadedExecutor final : public libcyphal::platform::SingleThreadedExecutor,
-                                          public IPosixExecutorExtension
+                                          public IPosixExecutorExtension,
+                                          public ExecutorProfiler
 {
 public:
     EpollSingleThreadedExecutor()
         : epollfd_{::epoll_create1(0)}
+        , timerfd_{-1}
+        , is_pwait2_supported_{true}
         , total_awaitables_{0}
+        , is_direct_dispatch_{false}
+        , drain_budget_{0}
+        , events_(InitialEpollEvents)
     {
     }
 
@@ -57,12 +83,48 @@ public:
 
     ~EpollSingleThreadedExecutor() override
     {
+        if (timerfd_ >= 0)
+        {
+            ::close(timerfd_);
+        }
         if (epollfd_ >= 0)
         {
             ::close(epollfd_);
         }
     }
 
+    /// Gets total number of awaitable callbacks which have been made ready (scheduled) by the polling so far.
+    ///
+    /// F.e. the engine busy-poll loop uses it to tell an idle poll from a productive one.
+    ///
+    std::uint64_t readyAwaitablesCount() const noexcept
+    {
+        return ready_awaitables_;
+    }
+
+    /// Sets dispatch mode of ready awaitable callbacks, and the drain budget of the polling.
+    ///
+    /// In the direct mode, the polling executes ready callbacks itself (so they don't wait for the next
+    /// `spinOnce`), but note that their execution time is not a part of the engine loop spins then,
+    /// and that such callbacks must not poll the executor themselves (the events batch is in use).
+    /// Zero drain budget limits the polling to a single batch of events.
+    ///
+    /// @return `true` b/c both modes are supported by this executor.
+    ///
+    bool setDispatch(const bool is_direct, const libcyphal::Duration drain_budget) noexcept
+    {
+        is_direct_dispatch_ = is_direct;
+        drain_budget_       = drain_budget;
+        return true;
+    }
+
+    /// Gets current capacity of the events batch - it grows (up to `MaxEpollEvents`) on full batches.
+    ///
+    std::size_t eventsBatchCapacity() const noexcept
+    {
+        return events_.size();
+    }
+
     CETL_NODISCARD cetl::optional<PollFailure> pollAwaitableResourcesFor(
         const cetl::optional<libcyphal::Duration> timeout) const override
     {
@@ -80,28 +142,13 @@ public:
             return cetl::nullopt;
         }
 
-        // Make sure that timeout is within the range of `::epoll_wait()`'s `int` timeout parameter.
-        // Any possible negative timeout will be treated as zero (return immediately from the `::epoll_wait`).
-        //
-        int clamped_timeout_ms = -1;  // "infinite" timeout
-        if (timeout)
-        {
-            using PollDuration = std::chrono::milliseconds;
-
-            clamped_timeout_ms = static_cast<int>(  //
-                std::max(static_cast<PollDuration::rep>(0),
-                         std::min(std::chrono::duration_cast<PollDuration>(*timeout).count(),
-                                  static_cast<PollDuration::rep>(std::numeric_limits<int>::max()))));
-        }
-
-        std::array<epoll_event, MaxEpollEvents> evs{};
-        const int epoll_result = ::epoll_wait(epollfd_, evs.data(), evs.size(), clamped_timeout_ms);
+        const int epoll_result = waitEvents(timeout);
         if (epoll_result < 0)
         {
             const auto err = errno;
             if (err == EINTR)
             {
-                // Normally, we would just retry a system call (`::epoll_wait`),
+                // Normally, we would just retry a system call (`::epoll_pwait2`),
                 // but we need updated timeout (from the main loop).
                 return cetl::nullopt;
             }
@@ -111,16 +158,39 @@ public:
         {
             return cetl::nullopt;
         }
-        const auto epoll_nfds = static_cast<std::size_t>(epoll_result);
+        auto epoll_nfds = static_cast<std::size_t>(epoll_result);
 
-        const auto now_time = now();
-        for (std::size_t index = 0; index < epoll_nfds; ++index)
+        // In the direct mode, keep draining (with zero timeout) while batches come full - but no longer than
+        // the drain budget, so that the engine loop gets back to its scheduled callbacks in time. Any failure
+        // of such extra wait is not reported b/c the primary one has succeeded already.
+        // In the scheduled mode, callbacks of the batch have not been executed yet - their fds are still ready,
+        // and so an extra (level-triggered) wait would just return the same events again.
+        //
+        const auto start_time = now();
+        dispatchEvents(epoll_nfds, start_time);
+        while (epoll_nfds == events_.size())
         {
-            const epoll_event& ev = evs[index];
-            if (auto* const cb_interface = static_cast<AwaitableNode*>(ev.data.ptr))
+            if (events_.size() < MaxEpollEvents)
             {
-                cb_interface->schedule(Callback::Schedule::Once{now_time});
+                events_.resize(events_.size() * 2);
             }
+            if (!is_direct_dispatch_)
+            {
+                break;
+            }
+
+            const auto now_time = now();
+            if ((now_time - start_time) >= drain_budget_)
+            {
+                break;
+            }
+            const int drain_result = waitEvents(libcyphal::Duration::zero());
+            if (drain_result <= 0)
+            {
+                break;
+            }
+            epoll_nfds = static_cast<std::size_t>(drain_result);
+            dispatchEvents(epoll_nfds, now_time);
         }
 
         return cetl::nullopt;
@@ -132,20 +202,28 @@ protected:
     CETL_NODISCARD Callback::Any registerAwaitableCallback(Callback::Function&&    function,
                                                            const Trigger::Variant& trigger) override
     {
-        AwaitableNode new_cb_node{*this, std::move(function)};
-
-        cetl::visit(  //
+        const auto slot_index = cetl::visit(  //
             cetl::make_overloaded(
-                [&new_cb_node](const Trigger::Readable& readable) {
+                [this, &function](const Trigger::Readable& readable) {
+                    //
+                    return addAwaitable(readable.fd, EPOLLIN, false, std::move(function));
+                },
+                [this, &function](const Trigger::Writable& writable) {
                     //
-                    new_cb_node.setup(readable.fd, EPOLLIN);
+                    return addAwaitable(writable.fd, EPOLLOUT, false, std::move(function));
                 },
-                [&new_cb_node](const Trigger::Writable& writable) {
+                [this, &function](const Trigger::Event& event) {
                     //
-                    new_cb_node.setup(writable.fd, EPOLLOUT);
+                    return addAwaitable(event.fd, EPOLLIN, true, std::move(function));
                 }),
             trigger);
+        if (slot_index == AwaitableNode::InvalidSlotIndex)
+        {
+            CETL_DEBUG_ASSERT(false, "The fd is already registered (by another trigger).");
+            return {};
+        }
 
+        AwaitableNode new_cb_node{*this, slot_index};
         insertCallbackNode(new_cb_node);
         return {std::move(new_cb_node)};
     }
@@ -158,6 +236,10 @@ protected:
         {
             return static_cast<IPosixExecutorExtension*>(this);
         }
+        if (id == ExecutorProfiler::_get_type_id_())
+        {
+            return static_cast<ExecutorProfiler*>(this);
+        }
         return Base::_cast_(id);
     }
     CETL_NODISCARD const void* _cast_(const cetl::type_id& id) const& noexcept override
@@ -166,6 +248,10 @@ protected:
         {
             return static_cast<const IPosixExecutorExtension*>(this);
         }
+        if (id == ExecutorProfiler::_get_type_id_())
+        {
+            return static_cast<const ExecutorProfiler*>(this);
+        }
         return Base::_cast_(id);
     }
 
@@ -173,36 +259,136 @@ private:
     using Base = SingleThreadedExecutor;
     using Self = EpollSingleThreadedExecutor;
 
+    static constexpr std::size_t InitialEpollEvents = 16;
+    static constexpr std::size_t MaxEpollEvents     = 1024;
+
+    /// Waits for events with nanosecond resolution of the timeout.
+    ///
+    /// Uses `epoll_pwait2` (Linux 5.11+, glibc 2.35+). Otherwise, falls back to a deadline `timerfd`
+    /// (registered in the epoll set with `nullptr` data) armed right before (infinite) `epoll_wait`;
+    /// and as a last resort - to the millisecond timeout of `epoll_wait` (rounded up, so never too early).
+    /// Any possible negative timeout is treated as zero (return immediately).
+    ///
+    int waitEvents(const cetl::optional<libcyphal::Duration> timeout) const
+    {
+        const auto max_events = static_cast<int>(events_.size());
+
+        timespec timeout_spec{};
+        if (timeout)
+        {
+            const auto timeout_ns = std::max(static_cast<std::chrono::nanoseconds::rep>(0),
+                                             std::chrono::duration_cast<std::chrono::nanoseconds>(*timeout).count());
+            timeout_spec.tv_sec   = static_cast<std::time_t>(timeout_ns / std::nano::den);
+            timeout_spec.tv_nsec  = static_cast<decltype(timespec::tv_nsec)>(timeout_ns % std::nano::den);
+        }
+
+#if defined(__GLIBC__)
+#    if __GLIBC_PREREQ(2, 35)
+        if (is_pwait2_supported_)
+        {
+            const int result = ::epoll_pwait2(epollfd_,  //
+                                              events_.data(),
+                                              max_events,
+                                              timeout ? &timeout_spec : nullptr,
+                                              nullptr);
+            if ((result >= 0) || (errno != ENOSYS))
+            {
+                return result;
+            }
+            is_pwait2_supported_ = false;
+        }
+#    endif
+#endif
+
+        const bool is_zero_timeout = timeout && (timeout_spec.tv_sec == 0) && (timeout_spec.tv_nsec == 0);
+        if (!is_zero_timeout && ensureTimerFd())
+        {
+            // Zero `it_value` disarms the timer (for infinite timeout), and any re-arming also resets
+            // the timer expirations (if any) - so it's never left "readable" by a previous deadline.
+            //
+            itimerspec timer_spec{};
+            timer_spec.it_value = timeout_spec;
+            if (::timerfd_settime(timerfd_, 0, &timer_spec, nullptr) == 0)
+            {
+                return ::epoll_wait(epollfd_, events_.data(), max_events, -1);
+            }
+        }
+
+        // Make sure that timeout is within the range of `::epoll_wait()`'s `int` timeout parameter.
+        //
+        int clamped_timeout_ms = -1;  // "infinite" timeout
+        if (timeout)
+        {
+            using PollDuration = std::chrono::milliseconds;
+
+            auto timeout_ms = std::chrono::duration_cast<PollDuration>(*timeout);
+            if (timeout_ms < *timeout)
+            {
+                ++timeout_ms;
+            }
+            clamped_timeout_ms = static_cast<int>(  //
+                std::max(static_cast<PollDuration::rep>(0),
+                         std::min(timeout_ms.count(),
+                                  static_cast<PollDuration::rep>(std::numeric_limits<int>::max()))));
+        }
+        return ::epoll_wait(epollfd_, events_.data(), max_events, clamped_timeout_ms);
+    }
+
+    bool ensureTimerFd() const
+    {
+        if (timerfd_ < 0)
+        {
+            const int timerfd = ::timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+            if (timerfd < 0)
+            {
+                return false;
+            }
+            ::epoll_event ev{EPOLLIN, {nullptr}};
+            ev.data.u64 = timerUserData();
+            if (::epoll_ctl(epollfd_, EPOLL_CTL_ADD, timerfd, &ev) < 0)
+            {
+                ::close(timerfd);
+                return false;
+            }
+            timerfd_ = timerfd;
+        }
+        return true;
+    }
+
     /// No Sonar cpp:S4963 b/c `AwaitableNode` supports move operation.
     ///
+    /// The node itself holds just index of its slot - the callback function lives in the slot (see `dispatchSlot`).
+    ///
     class AwaitableNode final : public CallbackNode  // NOSONAR cpp:S4963
     {
     public:
-        AwaitableNode(Self& executor, Callback::Function&& function)
-            : CallbackNode{executor, std::move(function)}
-            , fd_{-1}
-            , events_{0}
+        AwaitableNode(Self& executor, const std::uint32_t slot_index)
+            : CallbackNode{executor,
+                           [&executor, slot_index](const Callback::Arg& arg) {
+                               //
+                               executor.dispatchSlot(slot_index, arg);
+                           }}
+            , slot_index_{slot_index}
         {
+            getExecutor().slots_[slot_index_].node = this;
         }
 
         ~AwaitableNode() override
         {
-            if (fd_ >= 0)
+            if (slot_index_ != InvalidSlotIndex)
             {
-                ::epoll_ctl(getExecutor().epollfd_, EPOLL_CTL_DEL, fd_, nullptr);
-                getExecutor().total_awaitables_--;
+                getExecutor().removeAwaitable(slot_index_);
             }
         }
 
         AwaitableNode(AwaitableNode&& other) noexcept
             : CallbackNode(std::move(other))
-            , fd_{std::exchange(other.fd_, -1)}
-            , events_{std::exchange(other.events_, 0)}
+            , slot_index_{other.slot_index_}
         {
-            if (fd_ >= 0)
+            other.slot_index_ = InvalidSlotIndex;
+            if (slot_index_ != InvalidSlotIndex)
             {
-                ::epoll_event ev{events_, {this}};
-                ::epoll_ctl(getExecutor().epollfd_, EPOLL_CTL_MOD, fd_, &ev);
+                getExecutor().slots_[slot_index_].node = this;
             }
         }
 
@@ -210,50 +396,271 @@ private:
         AwaitableNode& operator=(const AwaitableNode&)           = delete;
         AwaitableNode& operator=(AwaitableNode&& other) noexcept = delete;
 
-        int fd() const noexcept
+    private:
+        friend class EpollSingleThreadedExecutor;
+
+        static constexpr std::uint32_t InvalidSlotIndex = std::numeric_limits<std::uint32_t>::max();
+
+        Self& getExecutor() noexcept
+        {
+            // No lint b/c we know for sure that the executor is of type `Self`.
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-static-cast-downcast)
+            return static_cast<Self&>(executor());
+        }
+
+        // MARK: Data members:
+
+        std::uint32_t slot_index_;
+
+    };  // AwaitableNode
+
+    /// Defines a registration slot of an awaitable node.
+    ///
+    /// Epoll events are referenced (by their user data) via slot index and generation (instead of the node
+    /// address) - so that a node could be moved without `EPOLL_CTL_MOD`, and events of already removed
+    /// (or even reused) registrations are safely recognized.
+    ///
+    /// A slot without node, but with fd, is "parked" - its fd is still in the epoll set (with no events of interest).
+    /// A new registration of a parked fd always takes over its parked slot - so an fd is never both parked
+    /// and registered by a live slot.
+    ///
+    struct Slot
+    {
+        AwaitableNode*     node;
+        int                fd;
+        std::uint32_t      generation;
+        bool               is_event;  ///< Whether the fd is drained when found ready (see `Trigger::Event`).
+        Callback::Function function;
+    };
+
+    /// Max number of parked registrations - beyond that, the oldest ones are deleted from the epoll set.
+    ///
+    static constexpr std::size_t MaxParkedSlots = 64;
+
+    static std::uint64_t makeUserData(const std::uint32_t index, const std::uint32_t generation) noexcept
+    {
+        return (static_cast<std::uint64_t>(generation) << 32U) | index;
+    }
+
+    static constexpr std::uint64_t timerUserData() noexcept
+    {
+        return std::numeric_limits<std::uint64_t>::max();
+    }
+
+    /// Registers fd in a slot (which is returned) - the slot node is bound later by the node constructor.
+    ///
+    /// @return `AwaitableNode::InvalidSlotIndex` if the fd can't be added to the epoll set -
+    ///         f.e. `EEXIST` b/c it's already registered by another live slot.
+    ///
+    std::uint32_t addAwaitable(const int            fd,
+                               const std::uint32_t  events,
+                               const bool           is_event,
+                               Callback::Function&& function)
+    {
+        CETL_DEBUG_ASSERT(fd >= 0, "");
+        CETL_DEBUG_ASSERT(events != 0, "");
+
+        // Reuse parked registration of the same fd (if any) - unless the fd has been closed (and maybe reopened)
+        // since then, which has silently removed it from the epoll set.
+        //
+        const auto parked = std::find_if(parked_slots_.cbegin(), parked_slots_.cend(), [this, fd](const auto index) {
+            //
+            return slots_[index].fd == fd;
+        });
+        if (parked != parked_slots_.cend())
+        {
+            const auto index = *parked;
+            parked_slots_.erase(parked);
+
+            Slot&         slot = slots_[index];
+            ::epoll_event ev{events, {nullptr}};
+            ev.data.u64 = makeUserData(index, slot.generation);
+            if ((::epoll_ctl(epollfd_, EPOLL_CTL_MOD, fd, &ev) != 0) &&
+                (::epoll_ctl(epollfd_, EPOLL_CTL_ADD, fd, &ev) != 0))
+            {
+                slot.fd = -1;
+                free_slots_.push_back(index);
+                return AwaitableNode::InvalidSlotIndex;
+            }
+            return bindSlot(index, is_event, std::move(function));
+        }
+
+        std::uint32_t index = 0;
+        if (free_slots_.empty())
+        {
+            index = static_cast<std::uint32_t>(slots_.size());
+            slots_.push_back(Slot{nullptr, -1, 0, false, {}});
+        }
+        else
+        {
+            index = free_slots_.back();
+            free_slots_.pop_back();
+        }
+        ::epoll_event ev{events, {nullptr}};
+        ev.data.u64 = makeUserData(index, slots_[index].generation);
+        if (::epoll_ctl(epollfd_, EPOLL_CTL_ADD, fd, &ev) != 0)
+        {
+            free_slots_.push_back(index);
+            return AwaitableNode::InvalidSlotIndex;
+        }
+        slots_[index].fd = fd;
+        return bindSlot(index, is_event, std::move(function));
+    }
+
+    /// Makes the slot (which fd is already in the epoll set) the live registration of its fd.
+    ///
+    /// Any previous live slot of the same fd (if any) is stale - its fd has been closed (and so silently
+    /// removed from the epoll set), and the same number is reused now by another file.
+    ///
+    std::uint32_t bindSlot(const std::uint32_t index, const bool is_event, Callback::Function&& function)
+    {
+        Slot& slot    = slots_[index];
+        slot.is_event = is_event;
+        slot.function = std::move(function);
+
+        live_slots_[slot.fd] = index;
+        total_awaitables_++;
+        return index;
+    }
+
+    void removeAwaitable(const std::uint32_t index)
+    {
+        total_awaitables_--;
+
+        Slot& slot    = slots_[index];
+        slot.node     = nullptr;
+        slot.function = Callback::Function{};
+        slot.generation++;
+
+        // A stale registration (see `bindSlot`) must not touch its fd - it might be in use by another live slot.
+        //
+        const auto live = live_slots_.find(slot.fd);
+        if ((live == live_slots_.end()) || (live->second != index))
         {
-            return fd_;
+            slot.fd = -1;
+            free_slots_.push_back(index);
+            return;
         }
+        live_slots_.erase(live);
 
-        std::uint32_t events() const noexcept
+        ::epoll_event ev{0, {nullptr}};
+        ev.data.u64 = makeUserData(index, slot.generation);
+        if (::epoll_ctl(epollfd_, EPOLL_CTL_MOD, slot.fd, &ev) != 0)
         {
-            return events_;
+            unparkSlot(index);
+            return;
         }
 
-        void setup(const int fd, const std::uint32_t events) noexcept
+        // Evict the oldest parked registration (if full). Its fd might be closed already (or even reopened) -
+        // deletion is harmless then, b/c an fd is never both parked and registered by a live slot (see `Slot`).
+        //
+        if (parked_slots_.size() == MaxParkedSlots)
         {
-            CETL_DEBUG_ASSERT(fd >= 0, "");
-            CETL_DEBUG_ASSERT(events != 0, "");
+            unparkSlot(parked_slots_.front());
+            parked_slots_.erase(parked_slots_.begin());
+        }
+        parked_slots_.push_back(index);
+    }
 
-            fd_     = fd;
-            events_ = events;
+    /// Deletes fd of the slot from the epoll set, and frees the slot.
+    ///
+    void unparkSlot(const std::uint32_t index) const
+    {
+        Slot& slot = slots_[index];
+        (void) ::epoll_ctl(epollfd_, EPOLL_CTL_DEL, slot.fd, nullptr);
+        slot.fd = -1;
+        free_slots_.push_back(index);
+    }
 
-            getExecutor().total_awaitables_++;
-            ::epoll_event ev{events_, {this}};
-            ::epoll_ctl(getExecutor().epollfd_, EPOLL_CTL_ADD, fd_, &ev);
+    /// Finds node of a ready event (if any).
+    ///
+    /// Events of the deadline timer, and stale ones (of removed registrations) are ignored.
+    /// A parked registration normally has no events, but it could still report an error or hang-up
+    /// (which is always reported by epoll) - such fd is deleted from the epoll set (to stop level-triggered reports).
+    ///
+    AwaitableNode* findReadyNode(const std::uint64_t user_data) const
+    {
+        const auto index = static_cast<std::uint32_t>(user_data);
+        if ((user_data == timerUserData()) || (index >= slots_.size()) ||
+            (makeUserData(index, slots_[index].generation) != user_data))
+        {
+            return nullptr;
         }
 
-    private:
-        Self& getExecutor() noexcept
+        const Slot& slot = slots_[index];
+        if (slot.node == nullptr)
         {
-            // No lint b/c we know for sure that the executor is of type `Self`.
-            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-static-cast-downcast)
-            return static_cast<Self&>(executor());
+            const auto parked = std::find(parked_slots_.cbegin(), parked_slots_.cend(), index);
+            if (parked != parked_slots_.cend())
+            {
+                parked_slots_.erase(parked);
+                unparkSlot(index);
+            }
         }
+        return slot.node;
+    }
 
-        // MARK: Data members:
+    /// Either executes (direct mode), or schedules ready callbacks of the first `nfds` events of the batch.
+    ///
+    /// Nodes are looked up right before their dispatch - so that events of registrations removed
+    /// (or even reused) by an earlier directly executed callback of the same batch are safely ignored.
+    ///
+    void dispatchEvents(const std::size_t nfds, const libcyphal::TimePoint now_time) const
+    {
+        for (std::size_t index = 0; index < nfds; ++index)
+        {
+            if (auto* const node = findReadyNode(events_[index].data.u64))
+            {
+                const Slot& slot = slots_[node->slot_index_];
+                if (slot.is_event)
+                {
+                    drainEvent(slot.fd);
+                }
+                ++ready_awaitables_;
+                if (is_direct_dispatch_)
+                {
+                    dispatchSlot(node->slot_index_, Callback::Arg{now_time});
+                }
+                else
+                {
+                    node->schedule(Callback::Schedule::Once{now_time});
+                }
+            }
+        }
+    }
 
-        int           fd_;
-        std::uint32_t events_;
+    /// Executes callback function of a slot.
+    ///
+    /// The function is moved out of the slot for the duration of the call - so that the callback could safely
+    /// remove (and even re-register) its own registration, which resets (or reuses) the slot.
+    ///
+    void dispatchSlot(const std::uint32_t index, const Callback::Arg& arg) const
+    {
+        const auto         generation = slots_[index].generation;
+        Callback::Function function{std::move(slots_[index].function)};
+        function(arg);
 
-    };  // AwaitableNode
+        Slot& slot = slots_[index];
+        if (slot.generation == generation)
+        {
+            slot.function = std::move(function);
+        }
+    }
 
     // MARK: - Data members:
 
-    static constexpr int MaxEpollEvents = 16;
-
-    int         epollfd_;
-    std::size_t total_awaitables_;
+    int                                    epollfd_;
+    mutable int                            timerfd_;
+    mutable bool                           is_pwait2_supported_;
+    std::size_t                            total_awaitables_;
+    mutable std::uint64_t                  ready_awaitables_{0};
+    mutable std::vector<Slot>              slots_;
+    mutable std::vector<std::uint32_t>     free_slots_;
+    mutable std::vector<std::uint32_t>     parked_slots_;
+    std::unordered_map<int, std::uint32_t> live_slots_;  ///< Live (not parked) registration slot by its fd.
+    bool                                   is_direct_dispatch_;
+    libcyphal::Duration                    drain_budget_;
+    mutable std::vector<epoll_event>       events_;
 
 };  // EpollSingleThreadedExecutor
 
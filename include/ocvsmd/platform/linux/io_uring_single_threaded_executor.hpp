@@ -0,0 +1,711 @@
+//
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#ifndef OCVSMD_PLATFORM_LINUX_IO_URING_SINGLE_THREADED_EXECUTOR_HPP_INCLUDED
+#define OCVSMD_PLATFORM_LINUX_IO_URING_SINGLE_THREADED_EXECUTOR_HPP_INCLUDED
+
+#include "ocvsmd/platform/executor_profiler.hpp"
+#include "ocvsmd/platform/posix_executor_extension.hpp"
+#include "ocvsmd/platform/posix_platform_error.hpp"
+
+#include <cetl/cetl.hpp>
+#include <cetl/pf17/cetlpf.hpp>
+#include <cetl/rtti.hpp>
+#include <cetl/visit_helpers.hpp>
+#include <libcyphal/errors.hpp>
+#include <libcyphal/executor.hpp>
+#include <libcyphal/platform/single_threaded_executor.hpp>
+#include <libcyphal/transport/errors.hpp>
+#include <libcyphal/types.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <linux/io_uring.h>
+#include <poll.h>
+#include <sys/epoll.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <thread>
+#include <unistd.h>
+#include <utility>
+#include <vector>
+
+namespace ocvsmd
+{
+namespace platform
+{
+namespace Linux
+{
+namespace detail
+{
+
+/// @brief Defines minimal wrapper of a raw `io_uring` instance (without dependency on `liburing`).
+///
+/// The submission queue entries are pushed by `push`, and then submitted (together with an optional wait
+/// for completions) by a single `enter` call; completions are consumed by `drainCompletions`.
+/// Requires Linux 5.11+ (`IORING_FEAT_EXT_ARG` for the timed wait) - otherwise the ring is left invalid.
+///
+class IoUringRing final
+{
+public:
+    explicit IoUringRing(const unsigned entries)
+    {
+        io_uring_params params{};
+        const auto      fd = static_cast<int>(::syscall(__NR_io_uring_setup, entries, &params));
+        if (fd < 0)
+        {
+            return;
+        }
+        constexpr std::uint32_t RequiredFeatures = IORING_FEAT_SINGLE_MMAP | IORING_FEAT_NODROP | IORING_FEAT_EXT_ARG;
+        if ((params.features & RequiredFeatures) != RequiredFeatures)
+        {
+            ::close(fd);
+            return;
+        }
+
+        // With `IORING_FEAT_SINGLE_MMAP` both SQ and CQ rings share the same mapping.
+        //
+        const std::size_t sq_size = params.sq_off.array + (params.sq_entries * sizeof(unsigned));
+        const std::size_t cq_size = params.cq_off.cqes + (params.cq_entries * sizeof(io_uring_cqe));
+        rings_size_               = std::max(sq_size, cq_size);
+        sqes_size_                = params.sq_entries * sizeof(io_uring_sqe);
+
+        void* const rings = ::mmap(nullptr,
+                                   rings_size_,
+                                   PROT_READ | PROT_WRITE,
+                                   MAP_SHARED | MAP_POPULATE,
+                                   fd,
+                                   IORING_OFF_SQ_RING);
+        if (rings == MAP_FAILED)
+        {
+            ::close(fd);
+            return;
+        }
+        void* const sqes = ::mmap(nullptr,  //
+                                  sqes_size_,
+                                  PROT_READ | PROT_WRITE,
+                                  MAP_SHARED | MAP_POPULATE,
+                                  fd,
+                                  IORING_OFF_SQES);
+        if (sqes == MAP_FAILED)
+        {
+            ::munmap(rings, rings_size_);
+            ::close(fd);
+            return;
+        }
+
+        fd_         = fd;
+        rings_      = rings;
+        sqes_       = static_cast<io_uring_sqe*>(sqes);
+        sq_entries_ = params.sq_entries;
+
+        auto* const base = static_cast<char*>(rings);
+        // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic, cppcoreguidelines-pro-type-reinterpret-cast)
+        sq_head_  = reinterpret_cast<unsigned*>(base + params.sq_off.head);
+        sq_tail_  = reinterpret_cast<unsigned*>(base + params.sq_off.tail);
+        sq_mask_  = *reinterpret_cast<unsigned*>(base + params.sq_off.ring_mask);
+        sq_array_ = reinterpret_cast<unsigned*>(base + params.sq_off.array);
+        cq_head_  = reinterpret_cast<unsigned*>(base + params.cq_off.head);
+        cq_tail_  = reinterpret_cast<unsigned*>(base + params.cq_off.tail);
+        cq_mask_  = *reinterpret_cast<unsigned*>(base + params.cq_off.ring_mask);
+        cqes_     = reinterpret_cast<io_uring_cqe*>(base + params.cq_off.cqes);
+        // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic, cppcoreguidelines-pro-type-reinterpret-cast)
+    }
+
+    IoUringRing(const IoUringRing&)                = delete;
+    IoUringRing(IoUringRing&&) noexcept            = delete;
+    IoUringRing& operator=(const IoUringRing&)     = delete;
+    IoUringRing& operator=(IoUringRing&&) noexcept = delete;
+
+    ~IoUringRing()
+    {
+        if (fd_ >= 0)
+        {
+            ::munmap(sqes_, sqes_size_);
+            ::munmap(rings_, rings_size_);
+            ::close(fd_);
+        }
+    }
+
+    bool isValid() const noexcept
+    {
+        return fd_ >= 0;
+    }
+
+    /// Pushes a copy of the given entry to the submission queue.
+    ///
+    /// The entry is not submitted to the kernel until the next `enter` call, unless the queue is full -
+    /// then all pending entries are submitted (without waiting) to make room for the new one.
+    ///
+    /// @return `false` if the queue is full, and pending entries could not be submitted.
+    ///
+    bool push(const io_uring_sqe& sqe) noexcept
+    {
+        CETL_DEBUG_ASSERT(isValid(), "");
+
+        const unsigned tail = *sq_tail_;  // Only this (user) side updates the tail.
+        if ((tail - __atomic_load_n(sq_head_, __ATOMIC_ACQUIRE)) >= sq_entries_)
+        {
+            if ((enter(0, nullptr) < 0) || ((tail - __atomic_load_n(sq_head_, __ATOMIC_ACQUIRE)) >= sq_entries_))
+            {
+                return false;
+            }
+        }
+
+        const unsigned index = tail & sq_mask_;
+        sqes_[index]         = sqe;    // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        sq_array_[index]     = index;  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        __atomic_store_n(sq_tail_, tail + 1, __ATOMIC_RELEASE);
+        ++to_submit_;
+        return true;
+    }
+
+    /// Submits all pending entries, and then (if `min_complete > 0`) waits for completions.
+    ///
+    /// @param min_complete Minimum number of completions to wait for; zero means no waiting.
+    /// @param timeout Optional timeout of the waiting; `nullptr` means "infinite".
+    /// @return Zero on success, or negated `errno` value (`-ETIME` if the wait has timed out).
+    ///
+    int enter(const unsigned min_complete, const __kernel_timespec* const timeout) noexcept
+    {
+        io_uring_getevents_arg arg{};
+        arg.ts = reinterpret_cast<std::uintptr_t>(timeout);  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+
+        unsigned flags = IORING_ENTER_EXT_ARG;
+        if (min_complete > 0)
+        {
+            flags |= IORING_ENTER_GETEVENTS;
+        }
+
+        const auto result = ::syscall(__NR_io_uring_enter, fd_, to_submit_, min_complete, flags, &arg, sizeof(arg));
+        if (result < 0)
+        {
+            return -errno;
+        }
+        to_submit_ -= std::min(to_submit_, static_cast<unsigned>(result));
+        return 0;
+    }
+
+    /// Consumes all available completions - passing `user_data`, `res` and `flags` of each to the visitor.
+    ///
+    /// The visitor is allowed to push new entries (f.e. to re-arm a finished request).
+    ///
+    template <typename Visitor>
+    std::size_t drainCompletions(Visitor&& visitor) noexcept
+    {
+        unsigned       head  = *cq_head_;  // Only this (user) side updates the head.
+        const unsigned tail  = __atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE);
+        std::size_t    count = 0;
+        for (; head != tail; ++head, ++count)
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            const io_uring_cqe& cqe = cqes_[head & cq_mask_];
+            visitor(cqe.user_data, cqe.res, cqe.flags);
+        }
+        __atomic_store_n(cq_head_, head, __ATOMIC_RELEASE);
+        return count;
+    }
+
+private:
+    // MARK: Data members:
+
+    int           fd_{-1};
+    void*         rings_{nullptr};
+    std::size_t   rings_size_{0};
+    io_uring_sqe* sqes_{nullptr};
+    std::size_t   sqes_size_{0};
+    unsigned      sq_entries_{0};
+    unsigned*     sq_head_{nullptr};
+    unsigned*     sq_tail_{nullptr};
+    unsigned      sq_mask_{0};
+    unsigned*     sq_array_{nullptr};
+    unsigned*     cq_head_{nullptr};
+    unsigned*     cq_tail_{nullptr};
+    unsigned      cq_mask_{0};
+    io_uring_cqe* cqes_{nullptr};
+    unsigned      to_submit_{0};
+
+};  // IoUringRing
+
+}  // namespace detail
+
+/// @brief Defines Linux platform-specific single-threaded executor based on `io_uring` mechanism.
+///
+/// Awaitable callbacks are registered as one-shot `IORING_OP_POLL_ADD` requests, so (unlike `epoll_ctl`)
+/// their (de)registration costs no separate system call - all pending requests are submitted together with
+/// the wait for completions (with nanosecond resolution of the timeout) by a single `io_uring_enter` call.
+///
+/// A request is re-armed on its completion, but the new one reaches the kernel only with the next poll - so after
+/// the scheduled callback has run. Hence the triggers are level-triggered (as with `epoll`): a callback which
+/// leaves some data in its fd is called again. Multishot requests are deliberately not in use - they complete
+/// only on new wake-ups of the fd (edge-like), and so would stall such callbacks.
+///
+/// Falls back at runtime to `epoll` if `io_uring` is not available (kernel older than 5.11, disabled by
+/// `kernel.io_uring_disabled` sysctl, or denied by a seccomp filter of a container) - see `isIoUringBackend`.
+///
+class IoUringSingleThreadedExecutor final : public libcyphal::platform::SingleThreadedExecutor,
+                                            public IPosixExecutorExtension,
+                                            public ExecutorProfiler
+{
+public:
+    IoUringSingleThreadedExecutor()
+        : ring_{RingEntries}
+        , epollfd_{ring_.isValid() ? -1 : ::epoll_create1(0)}
+        , total_awaitables_{0}
+    {
+    }
+
+    IoUringSingleThreadedExecutor(const IoUringSingleThreadedExecutor&)                = delete;
+    IoUringSingleThreadedExecutor(IoUringSingleThreadedExecutor&&) noexcept            = delete;
+    IoUringSingleThreadedExecutor& operator=(const IoUringSingleThreadedExecutor&)     = delete;
+    IoUringSingleThreadedExecutor& operator=(IoUringSingleThreadedExecutor&&) noexcept = delete;
+
+    ~IoUringSingleThreadedExecutor() override
+    {
+        if (epollfd_ >= 0)
+        {
+            ::close(epollfd_);
+        }
+    }
+
+    /// Gets whether `io_uring` is in use (vs the `epoll` fallback).
+    ///
+    bool isIoUringBackend() const noexcept
+    {
+        return ring_.isValid();
+    }
+
+    /// Gets total number of awaitable callbacks which have been made ready (scheduled) by the polling so far.
+    ///
+    /// F.e. the engine busy-poll loop uses it to tell an idle poll from a productive one.
+    ///
+    std::uint64_t readyAwaitablesCount() const noexcept
+    {
+        return ready_awaitables_;
+    }
+
+    /// Sets dispatch mode of ready awaitable callbacks - only the scheduled one is supported by this executor
+    /// (see `EpollSingleThreadedExecutor::setDispatch`), and so the drain budget is ignored.
+    ///
+    /// @return `false` if the direct mode is requested.
+    ///
+    bool setDispatch(const bool is_direct, const libcyphal::Duration) noexcept
+    {
+        return !is_direct;
+    }
+
+    CETL_NODISCARD cetl::optional<PollFailure> pollAwaitableResourcesFor(
+        const cetl::optional<libcyphal::Duration> timeout) const override
+    {
+        CETL_DEBUG_ASSERT((total_awaitables_ > 0) || timeout,
+                          "Infinite timeout without awaitables means that we will sleep forever.");
+
+        if ((total_awaitables_ == 0) && !timeout)
+        {
+            return libcyphal::ArgumentError{};
+        }
+
+        return ring_.isValid() ? pollRing(timeout) : pollEpoll(timeout);
+    }
+
+protected:
+    // MARK: - IPosixExecutorExtension
+
+    CETL_NODISCARD Callback::Any registerAwaitableCallback(Callback::Function&&    function,
+                                                           const Trigger::Variant& trigger) override
+    {
+        AwaitableNode new_cb_node{*this, std::move(function)};
+
+        cetl::visit(  //
+            cetl::make_overloaded(
+                [&new_cb_node](const Trigger::Readable& readable) {
+                    //
+                    new_cb_node.setup(readable.fd, POLLIN);
+                },
+                [&new_cb_node](const Trigger::Writable& writable) {
+                    //
+                    new_cb_node.setup(writable.fd, POLLOUT);
+                },
+                [&new_cb_node](const Trigger::Event& event) {
+                    //
+                    new_cb_node.setup(event.fd, POLLIN, true);
+                }),
+            trigger);
+
+        insertCallbackNode(new_cb_node);
+        return {std::move(new_cb_node)};
+    }
+
+    // MARK: - RTTI
+
+    CETL_NODISCARD void* _cast_(const cetl::type_id& id) & noexcept override
+    {
+        if (id == IPosixExecutorExtension::_get_type_id_())
+        {
+            return static_cast<IPosixExecutorExtension*>(this);
+        }
+        if (id == ExecutorProfiler::_get_type_id_())
+        {
+            return static_cast<ExecutorProfiler*>(this);
+        }
+        return Base::_cast_(id);
+    }
+    CETL_NODISCARD const void* _cast_(const cetl::type_id& id) const& noexcept override
+    {
+        if (id == IPosixExecutorExtension::_get_type_id_())
+        {
+            return static_cast<const IPosixExecutorExtension*>(this);
+        }
+        if (id == ExecutorProfiler::_get_type_id_())
+        {
+            return static_cast<const ExecutorProfiler*>(this);
+        }
+        return Base::_cast_(id);
+    }
+
+private:
+    using Base = SingleThreadedExecutor;
+    using Self = IoUringSingleThreadedExecutor;
+
+    // `poll` and `epoll` event bits are interchangeable for the triggers in use.
+    static_assert((POLLIN == EPOLLIN) && (POLLOUT == EPOLLOUT), "");
+
+    /// No Sonar cpp:S4963 b/c `AwaitableNode` supports move operation.
+    ///
+    class AwaitableNode final : public CallbackNode  // NOSONAR cpp:S4963
+    {
+    public:
+        AwaitableNode(Self& executor, Callback::Function&& function)
+            : CallbackNode{executor, std::move(function)}
+            , fd_{-1}
+            , events_{0}
+            , user_data_{0}
+            , is_event_{false}
+        {
+        }
+
+        ~AwaitableNode() override
+        {
+            if (fd_ >= 0)
+            {
+                getExecutor().removeAwaitable(*this);
+            }
+        }
+
+        AwaitableNode(AwaitableNode&& other) noexcept
+            : CallbackNode(std::move(other))
+            , fd_{std::exchange(other.fd_, -1)}
+            , events_{std::exchange(other.events_, 0)}
+            , user_data_{std::exchange(other.user_data_, 0)}
+            , is_event_{other.is_event_}
+        {
+            if (fd_ >= 0)
+            {
+                getExecutor().relinkAwaitable(*this);
+            }
+        }
+
+        AwaitableNode(const AwaitableNode&)                      = delete;
+        AwaitableNode& operator=(const AwaitableNode&)           = delete;
+        AwaitableNode& operator=(AwaitableNode&& other) noexcept = delete;
+
+        int fd() const noexcept
+        {
+            return fd_;
+        }
+
+        std::uint32_t events() const noexcept
+        {
+            return events_;
+        }
+
+        std::uint64_t userData() const noexcept
+        {
+            return user_data_;
+        }
+
+        /// Whether the fd is drained when found ready (see `Trigger::Event`).
+        ///
+        bool isEvent() const noexcept
+        {
+            return is_event_;
+        }
+
+        void setup(const int fd, const std::uint32_t events, const bool is_event = false) noexcept
+        {
+            CETL_DEBUG_ASSERT(fd >= 0, "");
+            CETL_DEBUG_ASSERT(events != 0, "");
+
+            fd_       = fd;
+            events_   = events;
+            is_event_ = is_event;
+            getExecutor().addAwaitable(*this);
+        }
+
+    private:
+        friend class IoUringSingleThreadedExecutor;
+
+        Self& getExecutor() noexcept
+        {
+            // No lint b/c we know for sure that the executor is of type `Self`.
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-static-cast-downcast)
+            return static_cast<Self&>(executor());
+        }
+
+        // MARK: Data members:
+
+        int           fd_;
+        std::uint32_t events_;
+        std::uint64_t user_data_;
+        bool          is_event_;
+
+    };  // AwaitableNode
+
+    /// Defines a registration slot of an awaitable node.
+    ///
+    /// Poll requests are referenced (by their `user_data`) via slot index and generation (instead of the node
+    /// address), so that late completions of already removed requests are safely recognized and ignored.
+    ///
+    struct Slot
+    {
+        AwaitableNode* node;
+        std::uint32_t  generation;
+    };
+
+    static std::uint64_t makeUserData(const std::uint32_t index, const std::uint32_t generation) noexcept
+    {
+        return (static_cast<std::uint64_t>(generation) << 32U) | index;
+    }
+
+    static constexpr std::uint64_t ignoredUserData() noexcept
+    {
+        return std::numeric_limits<std::uint64_t>::max();
+    }
+
+    void addAwaitable(AwaitableNode& node)
+    {
+        total_awaitables_++;
+
+        if (!ring_.isValid())
+        {
+            ::epoll_event ev{node.events(), {&node}};
+            ::epoll_ctl(epollfd_, EPOLL_CTL_ADD, node.fd(), &ev);
+            return;
+        }
+
+        std::uint32_t index = 0;
+        if (free_slots_.empty())
+        {
+            index = static_cast<std::uint32_t>(slots_.size());
+            slots_.push_back(Slot{nullptr, 0});
+        }
+        else
+        {
+            index = free_slots_.back();
+            free_slots_.pop_back();
+        }
+        Slot& slot      = slots_[index];
+        slot.node       = &node;
+        node.user_data_ = makeUserData(index, slot.generation);
+
+        armPoll(node);
+    }
+
+    void relinkAwaitable(AwaitableNode& node) noexcept
+    {
+        if (!ring_.isValid())
+        {
+            ::epoll_event ev{node.events(), {&node}};
+            ::epoll_ctl(epollfd_, EPOLL_CTL_MOD, node.fd(), &ev);
+            return;
+        }
+
+        slots_[static_cast<std::uint32_t>(node.userData())].node = &node;
+    }
+
+    void removeAwaitable(const AwaitableNode& node)
+    {
+        total_awaitables_--;
+
+        if (!ring_.isValid())
+        {
+            ::epoll_ctl(epollfd_, EPOLL_CTL_DEL, node.fd(), nullptr);
+            return;
+        }
+
+        const auto index = static_cast<std::uint32_t>(node.userData());
+        Slot&      slot  = slots_[index];
+        slot.node        = nullptr;
+        slot.generation++;
+        free_slots_.push_back(index);
+
+        io_uring_sqe sqe{};
+        sqe.opcode    = IORING_OP_POLL_REMOVE;
+        sqe.fd        = -1;
+        sqe.addr      = node.userData();
+        sqe.user_data = ignoredUserData();
+        (void) ring_.push(sqe);
+    }
+
+    void armPoll(const AwaitableNode& node) const noexcept
+    {
+        io_uring_sqe sqe{};
+        sqe.opcode        = IORING_OP_POLL_ADD;
+        sqe.fd            = node.fd();
+        sqe.poll32_events = toPoll32Events(node.events());
+        sqe.user_data     = node.userData();
+        (void) ring_.push(sqe);
+    }
+
+    static std::uint32_t toPoll32Events(const std::uint32_t events) noexcept
+    {
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+        // The kernel expects half-words of the mask to be swapped on big endian machines.
+        return (events << 16U) | (events >> 16U);
+#else
+        return events;
+#endif
+    }
+
+    cetl::optional<PollFailure> pollRing(const cetl::optional<libcyphal::Duration> timeout) const
+    {
+        // Any possible negative timeout will be treated as zero (return immediately from the `io_uring_enter`).
+        //
+        __kernel_timespec ts{};
+        if (timeout)
+        {
+            const auto timeout_ns = std::max(static_cast<std::chrono::nanoseconds::rep>(0),
+                                             std::chrono::duration_cast<std::chrono::nanoseconds>(*timeout).count());
+            ts.tv_sec             = timeout_ns / std::nano::den;
+            ts.tv_nsec            = timeout_ns % std::nano::den;
+        }
+
+        const int enter_result = ring_.enter(1, timeout ? &ts : nullptr);
+        if ((enter_result < 0) && (enter_result != -ETIME) && (enter_result != -EINTR))
+        {
+            return libcyphal::transport::PlatformError{PosixPlatformError{-enter_result}};
+        }
+
+        const auto now_time = now();
+        (void) ring_.drainCompletions(
+            [this, now_time](const std::uint64_t user_data, const std::int32_t res, const std::uint32_t) {
+                //
+                onCompletion(user_data, res, now_time);
+            });
+
+        return cetl::nullopt;
+    }
+
+    void onCompletion(const std::uint64_t        user_data,
+                      const std::int32_t         res,
+                      const libcyphal::TimePoint now_time) const
+    {
+        if (user_data == ignoredUserData())
+        {
+            return;
+        }
+
+        // Ignore late completions of already removed (or even reused) slots.
+        //
+        const auto index = static_cast<std::uint32_t>(user_data);
+        if ((index >= slots_.size()) || (slots_[index].node == nullptr) ||
+            (makeUserData(index, slots_[index].generation) != user_data))
+        {
+            return;
+        }
+        AwaitableNode& node = *slots_[index].node;
+
+        if (node.isEvent())
+        {
+            drainEvent(node.fd());
+        }
+        node.schedule(Callback::Schedule::Once{now_time});
+        ++ready_awaitables_;
+
+        // The one-shot request has to be re-armed - unless it has failed.
+        //
+        if (res >= 0)
+        {
+            armPoll(node);
+        }
+    }
+
+    cetl::optional<PollFailure> pollEpoll(const cetl::optional<libcyphal::Duration> timeout) const
+    {
+        if (total_awaitables_ == 0)
+        {
+            std::this_thread::sleep_for(*timeout);
+            return cetl::nullopt;
+        }
+
+        // Make sure that timeout is within the range of `::epoll_wait()`'s `int` timeout parameter.
+        // Any possible negative timeout will be treated as zero (return immediately from the `::epoll_wait`).
+        //
+        int clamped_timeout_ms = -1;  // "infinite" timeout
+        if (timeout)
+        {
+            using PollDuration = std::chrono::milliseconds;
+
+            clamped_timeout_ms = static_cast<int>(  //
+                std::max(static_cast<PollDuration::rep>(0),
+                         std::min(std::chrono::duration_cast<PollDuration>(*timeout).count(),
+                                  static_cast<PollDuration::rep>(std::numeric_limits<int>::max()))));
+        }
+
+        std::array<epoll_event, MaxEpollEvents> evs{};
+        const int epoll_result = ::epoll_wait(epollfd_, evs.data(), evs.size(), clamped_timeout_ms);
+        if (epoll_result < 0)
+        {
+            const auto err = errno;
+            if (err == EINTR)
+            {
+                return cetl::nullopt;
+            }
+            return libcyphal::transport::PlatformError{PosixPlatformError{err}};
+        }
+        const auto epoll_nfds = static_cast<std::size_t>(epoll_result);
+
+        const auto now_time = now();
+        for (std::size_t index = 0; index < epoll_nfds; ++index)
+        {
+            const epoll_event& ev = evs[index];
+            if (auto* const cb_interface = static_cast<AwaitableNode*>(ev.data.ptr))
+            {
+                if (cb_interface->isEvent())
+                {
+                    drainEvent(cb_interface->fd());
+                }
+                cb_interface->schedule(Callback::Schedule::Once{now_time});
+                ++ready_awaitables_;
+            }
+        }
+
+        return cetl::nullopt;
+    }
+
+    // MARK: - Data members:
+
+    static constexpr unsigned RingEntries    = 256;
+    static constexpr int      MaxEpollEvents = 16;
+
+    mutable detail::IoUringRing ring_;
+    int                         epollfd_;
+    std::size_t                 total_awaitables_;
+    mutable std::uint64_t       ready_awaitables_{0};
+    std::vector<Slot>           slots_;
+    std::vector<std::uint32_t>  free_slots_;
+
+};  // IoUringSingleThreadedExecutor
+
+}  // namespace Linux
+}  // namespace platform
+}  // namespace ocvsmd
+
+#endif  // OCVSMD_PLATFORM_LINUX_IO_URING_SINGLE_THREADED_EXECUTOR_HPP_INCLUDED
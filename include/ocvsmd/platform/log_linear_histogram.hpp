@@ -0,0 +1,154 @@
+//
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#ifndef OCVSMD_PLATFORM_LOG_LINEAR_HISTOGRAM_HPP_INCLUDED
+#define OCVSMD_PLATFORM_LOG_LINEAR_HISTOGRAM_HPP_INCLUDED
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+namespace ocvsmd
+{
+namespace platform
+{
+
+/// Defines histogram of non-negative integer values (f.e. durations in nanoseconds) with log-linear buckets.
+///
+/// Each power-of-two range of values ("octave") is split into `subBuckets()` linear buckets, so relative
+/// error of any reported value is within 1/`subBuckets()` (25%) - across the whole 64-bit range,
+/// with fixed (and small) memory footprint, and with just a few arithmetic operations per `record`.
+///
+/// Not thread-safe.
+///
+class LogLinearHistogram final
+{
+public:
+    static constexpr std::size_t subBucketsBits() noexcept
+    {
+        return SubBucketsBits;
+    }
+    static constexpr std::size_t subBuckets() noexcept
+    {
+        return SubBuckets;
+    }
+    static constexpr std::size_t bucketsCount() noexcept
+    {
+        return BucketsCount;
+    }
+
+    /// Gets index of the bucket of the given value.
+    ///
+    static std::size_t bucketIndex(const std::uint64_t value) noexcept
+    {
+        if (value < subBuckets())
+        {
+            return static_cast<std::size_t>(value);
+        }
+        const auto msb   = static_cast<std::size_t>(63 - __builtin_clzll(value));
+        const auto shift = msb - subBucketsBits();
+        return ((shift + 1) * subBuckets()) + static_cast<std::size_t>((value >> shift) & (subBuckets() - 1));
+    }
+
+    /// Gets the smallest value of the given bucket.
+    ///
+    static std::uint64_t bucketLowerBound(const std::size_t index) noexcept
+    {
+        if (index < subBuckets())
+        {
+            return index;
+        }
+        const auto shift = (index / subBuckets()) - 1;
+        return static_cast<std::uint64_t>(subBuckets() + (index % subBuckets())) << shift;
+    }
+
+    /// Gets the largest value of the given bucket.
+    ///
+    static std::uint64_t bucketUpperBound(const std::size_t index) noexcept
+    {
+        if (index + 1 >= bucketsCount())
+        {
+            return std::numeric_limits<std::uint64_t>::max();
+        }
+        return bucketLowerBound(index + 1) - 1;
+    }
+
+    void record(const std::uint64_t value) noexcept
+    {
+        ++buckets_[bucketIndex(value)];
+        ++count_;
+        sum_ += value;
+        max_ = std::max(max_, value);
+    }
+
+    void reset() noexcept
+    {
+        buckets_.fill(0);
+        count_ = 0;
+        sum_   = 0;
+        max_   = 0;
+    }
+
+    std::uint64_t count() const noexcept
+    {
+        return count_;
+    }
+
+    std::uint64_t sum() const noexcept
+    {
+        return sum_;
+    }
+
+    std::uint64_t max() const noexcept
+    {
+        return max_;
+    }
+
+    std::uint64_t bucketCount(const std::size_t index) const noexcept
+    {
+        return buckets_[index];
+    }
+
+    /// Gets (upper bound of) the value at the given percentile (0...100).
+    ///
+    /// The result is capped by the maximum recorded value; zero if there are no values at all.
+    ///
+    std::uint64_t percentile(const double percent) const noexcept
+    {
+        if (count_ == 0)
+        {
+            return 0;
+        }
+        const auto    target     = static_cast<std::uint64_t>(static_cast<double>(count_) * percent / 100.0);
+        std::uint64_t cumulative = 0;
+        for (std::size_t index = 0; index < bucketsCount(); ++index)
+        {
+            cumulative += buckets_[index];
+            if ((cumulative > target) || (cumulative == count_))
+            {
+                return std::min(bucketUpperBound(index), max_);
+            }
+        }
+        return max_;
+    }
+
+private:
+    static constexpr std::size_t SubBucketsBits = 2;
+    static constexpr std::size_t SubBuckets     = std::size_t{1} << SubBucketsBits;
+    static constexpr std::size_t BucketsCount   = (64 - SubBucketsBits + 1) * SubBuckets;
+
+    std::array<std::uint64_t, BucketsCount> buckets_{};
+    std::uint64_t                           count_{0};
+    std::uint64_t                           sum_{0};
+    std::uint64_t                           max_{0};
+
+};  // LogLinearHistogram
+
+}  // namespace platform
+}  // namespace ocvsmd
+
+#endif  // OCVSMD_PLATFORM_LOG_LINEAR_HISTOGRAM_HPP_INCLUDED
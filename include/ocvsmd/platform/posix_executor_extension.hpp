@@ -14,6 +14,9 @@
 #include <libcyphal/transport/errors.hpp>
 #include <libcyphal/types.hpp>
 
+#include <cstdint>
+#include <unistd.h>
+
 namespace ocvsmd
 {
 namespace platform
@@ -42,8 +45,17 @@ public:
         {
             int fd;
         };
+        /// Defines readable event descriptor - an `eventfd`, or a read end of a non-blocking "self-pipe".
+        ///
+        /// The executor drains (resets) the event right when it's found ready - so the callback doesn't have to,
+        /// and any signal which comes later (f.e. while the callback is running) is never lost.
+        ///
+        struct Event
+        {
+            int fd;
+        };
 
-        using Variant = cetl::variant<Readable, Writable>;
+        using Variant = cetl::variant<Readable, Writable, Event>;
     };
 
     CETL_NODISCARD virtual libcyphal::IExecutor::Callback::Any registerAwaitableCallback(
@@ -66,6 +78,16 @@ protected:
     IPosixExecutorExtension()  = default;
     ~IPosixExecutorExtension() = default;
 
+    /// Drains a ready event descriptor (see `Trigger::Event`) - reads until it would block.
+    ///
+    static void drainEvent(const int fd) noexcept
+    {
+        std::uint64_t value = 0;
+        while (::read(fd, &value, sizeof(value)) > 0)
+        {
+        }
+    }
+
 };  // IPosixExecutorExtension
 
 }  // namespace platform
@@ -0,0 +1,103 @@
+//
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#ifndef OCVSMD_PLUGIN_PLUGIN_HPP_INCLUDED
+#define OCVSMD_PLUGIN_PLUGIN_HPP_INCLUDED
+
+#include <cetl/pf17/cetlpf.hpp>
+#include <libcyphal/executor.hpp>
+#include <libcyphal/presentation/presentation.hpp>
+
+#include <cstdint>
+
+namespace ocvsmd
+{
+namespace plugin
+{
+
+/// Defines version of the in-process plugin ABI.
+///
+/// The daemon refuses to load a plugin which reports a different version.
+/// Bump it on any incompatible change of `Context` or `IPlugin` (including their layout and virtual tables).
+///
+/// Note that the ABI is only as stable as the libcyphal/CETL headers behind it - a plugin must be built
+/// against the same versions of these libraries (and with the same C++ standard) as the daemon itself.
+///
+constexpr std::uint32_t AbiVersion = 1;
+
+/// Defines context given to a plugin on its creation.
+///
+/// Contains references to the core engine components - the same ones the engine IPC services use.
+/// All of them (as well as the context itself, including its `params` string) are owned by the daemon engine
+/// and outlive the plugin - so the plugin may keep the context (or its members) for its whole lifetime.
+/// The plugin is created, called back and destroyed on the engine thread only,
+/// so there is no need for any synchronization while using these components.
+///
+/// Note that the daemon doesn't enforce any CPU budget on plugins - callbacks of plugin subscribers, servers
+/// and timers run on the shared engine executor, and are not attributed to a particular plugin. A plugin doing
+/// heavy work should offload it (f.e. to its own thread), so that it doesn't stall the engine loop.
+///
+struct Context
+{
+    cetl::pmr::memory_resource&            memory;
+    libcyphal::IExecutor&                  executor;
+    libcyphal::presentation::Presentation& presentation;
+
+    /// Raw (not interpreted by the daemon) plugin parameters string from the configuration file.
+    const char* params;
+
+};  // Context
+
+/// Defines interface of an in-process plugin instance.
+///
+/// A plugin typically creates its libcyphal subscribers, publishers, clients and servers on construction
+/// (using given `Context::presentation`), and keeps them alive until its destruction.
+///
+class IPlugin
+{
+public:
+    IPlugin(const IPlugin&)                = delete;
+    IPlugin(IPlugin&&) noexcept            = delete;
+    IPlugin& operator=(const IPlugin&)     = delete;
+    IPlugin& operator=(IPlugin&&) noexcept = delete;
+
+    virtual ~IPlugin() = default;
+
+    /// Gets human-readable name of the plugin (for logging purposes).
+    ///
+    /// The returned string should be valid for the whole lifetime of the plugin instance.
+    ///
+    virtual const char* name() const noexcept = 0;
+
+protected:
+    IPlugin() = default;
+
+};  // IPlugin
+
+}  // namespace plugin
+}  // namespace ocvsmd
+
+extern "C"
+{
+    /// Reports the plugin ABI version the shared object was built with. Must return `ocvsmd::plugin::AbiVersion`.
+    ///
+    using OcvsmdPluginAbiVersionFn = std::uint32_t (*)();
+
+    /// Creates a new plugin instance. Returns `nullptr` on failure.
+    ///
+    using OcvsmdPluginCreateFn = ocvsmd::plugin::IPlugin* (*) (const ocvsmd::plugin::Context& context);
+
+    /// Destroys the plugin instance previously made by the create function of the same shared object.
+    ///
+    using OcvsmdPluginDestroyFn = void (*)(ocvsmd::plugin::IPlugin* plugin);
+}
+
+/// Names of the C-linkage entry points which every plugin shared object must export.
+///
+#define OCVSMD_PLUGIN_ABI_VERSION_SYMBOL "ocvsmdPluginAbiVersion"
+#define OCVSMD_PLUGIN_CREATE_SYMBOL "ocvsmdPluginCreate"
+#define OCVSMD_PLUGIN_DESTROY_SYMBOL "ocvsmdPluginDestroy"
+
+#endif  // OCVSMD_PLUGIN_PLUGIN_HPP_INCLUDED
@@ -432,7 +432,7 @@ private:
         {
             if (const auto gateway = tag_to_gw->second.lock())
             {
-                logger_->trace("Route Ch Msg (tag={}, seq={}).", route_ch_msg.tag, route_ch_msg.sequence);
+                SPDLOG_LOGGER_TRACE(logger_, "Route Ch Msg (tag={}, seq={}).", route_ch_msg.tag, route_ch_msg.sequence);
 
                 return gateway->event(detail::Gateway::Event::Message{route_ch_msg.sequence, msg_real_payload});
             }
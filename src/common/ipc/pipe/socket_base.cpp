@@ -108,7 +108,7 @@ sdk::OptError SocketBase::receiveData(IoState& io_state) const
                 {
                     // No data available yet - that's ok, the next attempt will try to read again.
                     //
-                    logger_->trace("Msg header read is not ready (fd={}).", io_state.fd.get());
+                    SPDLOG_LOGGER_TRACE(logger_, "Msg header read is not ready (fd={}).", io_state.fd.get());
                     return sdk::OptError{};
                 }
 
@@ -185,7 +185,7 @@ sdk::OptError SocketBase::receiveData(IoState& io_state) const
                 {
                     // No data available yet - that's ok, the next attempt will try to read again.
                     //
-                    logger_->trace("Msg payload read is not ready (fd={}).", io_state.fd.get());
+                    SPDLOG_LOGGER_TRACE(logger_, "Msg payload read is not ready (fd={}).", io_state.fd.get());
                     return sdk::OptError{};
                 }
 
@@ -11,6 +11,7 @@
 #include "io/socket_address.hpp"
 #include "io/socket_buffer.hpp"
 #include "logging.hpp"
+#include "ocvsmd/platform/executor_profiler.hpp"
 #include "ocvsmd/platform/posix_executor_extension.hpp"
 #include "ocvsmd/platform/posix_utils.hpp"
 #include "ocvsmd/sdk/defines.hpp"
@@ -43,6 +44,7 @@ constexpr int MaxConnections = 32;
 SocketServer::SocketServer(libcyphal::IExecutor& executor, const io::SocketAddress& address)
     : socket_address_{address}
     , posix_executor_ext_{cetl::rtti_cast<platform::IPosixExecutorExtension*>(&executor)}
+    , profiler_{cetl::rtti_cast<platform::ExecutorProfiler*>(&executor)}
     , unique_client_id_counter_{0}
 {
     CETL_DEBUG_ASSERT(posix_executor_ext_ != nullptr, "");
@@ -129,6 +131,7 @@ sdk::OptError SocketServer::send(const ClientId client_id, io::SocketBuffer& soc
 void SocketServer::handleAccept()
 {
     CETL_DEBUG_ASSERT(server_fd_.get() != -1, "");
+    const platform::ExecutorProfiler::Scope scope{profiler_, platform::ExecutorProfiler::Category::IpcAccept};
 
     io::SocketAddress client_address;
     if (auto client_fd = client_address.accept(server_fd_))
@@ -152,6 +155,7 @@ void SocketServer::handleAccept()
         //
         client_context->state().on_rx_msg_payload = [this, new_client_id](const io::Payload payload) {
             //
+            const platform::ExecutorProfiler::Scope scope{profiler_, platform::ExecutorProfiler::Category::Service};
             return event_handler_(Event::Message{new_client_id, payload});
         };
 
@@ -163,6 +167,8 @@ void SocketServer::handleAccept()
 
 void SocketServer::handleClientRequest(const ClientId client_id)
 {
+    const platform::ExecutorProfiler::Scope scope{profiler_, platform::ExecutorProfiler::Category::IpcRead};
+
     auto* const client_context = tryFindClientContext(client_id);
     CETL_DEBUG_ASSERT(client_context, "");
     auto& state = client_context->state();
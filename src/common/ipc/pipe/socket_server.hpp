@@ -10,6 +10,7 @@
 #include "io/io.hpp"
 #include "io/socket_address.hpp"
 #include "io/socket_buffer.hpp"
+#include "ocvsmd/platform/executor_profiler.hpp"
 #include "ocvsmd/platform/posix_executor_extension.hpp"
 #include "ocvsmd/sdk/defines.hpp"
 #include "server_pipe.hpp"
@@ -55,6 +56,7 @@ private:
     io::OwnedFd                                      server_fd_;
     io::SocketAddress                                socket_address_;
     platform::IPosixExecutorExtension* const         posix_executor_ext_;
+    platform::ExecutorProfiler* const                profiler_;
     ClientId                                         unique_client_id_counter_;
     EventHandler                                     event_handler_;
     libcyphal::IExecutor::Callback::Any              accept_callback_;
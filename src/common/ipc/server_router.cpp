@@ -419,10 +419,11 @@ private:
             {
                 if (auto gateway = tag_to_gw->second.lock())
                 {
-                    logger_->trace("Route Ch Msg (cl={}, tag={}, seq={}).",
-                                   client_id,
-                                   route_ch_msg.tag,
-                                   route_ch_msg.sequence);
+                    SPDLOG_LOGGER_TRACE(logger_,
+                                        "Route Ch Msg (cl={}, tag={}, seq={}).",
+                                        client_id,
+                                        route_ch_msg.tag,
+                                        route_ch_msg.sequence);
 
                     return gateway->event(detail::Gateway::Event::Message{route_ch_msg.sequence, msg_real_payload});
                 }
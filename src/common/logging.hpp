@@ -15,7 +15,10 @@
 #include <spdlog/logger.h>
 #include <spdlog/spdlog.h>
 
+#include <chrono>
+#include <cstddef>
 #include <memory>
+#include <mutex>
 #include <string>
 
 namespace ocvsmd
@@ -49,9 +52,92 @@ inline LoggerPtr getLogger(const std::string& name) noexcept
     return logger;
 }
 
+/// Limits rate of log messages - f.e. of a single call site on a hot path (see `OCVSMD_LOG_RATE_LIMITED`).
+///
+/// At most `burst` messages are passed per `interval`; the rest are suppressed (and counted),
+/// so that the next passed message could report how many similar messages were suppressed.
+/// Thread-safe.
+///
+class LogRateLimiter final
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr std::size_t DefaultBurst = 5;
+
+    explicit LogRateLimiter(const Clock::duration interval = std::chrono::seconds{1},
+                            const std::size_t     burst    = DefaultBurst) noexcept
+        : interval_{interval}
+        , burst_{burst}
+    {
+    }
+
+    /// Decides whether a message should be passed (logged) at the given time.
+    ///
+    /// @param now The current time.
+    /// @param suppressed The number of messages suppressed since the previous passed one.
+    ///                   Assigned only if the message is passed.
+    /// @return `true` if the message should be passed.
+    ///
+    bool tryPass(const Clock::time_point now, std::size_t& suppressed) noexcept
+    {
+        const std::lock_guard<std::mutex> lock{mutex_};
+
+        if ((passed_ == 0) || (now - window_start_ >= interval_))
+        {
+            window_start_ = now;
+            passed_       = 0;
+        }
+        if (passed_ >= burst_)
+        {
+            ++suppressed_;
+            return false;
+        }
+
+        ++passed_;
+        suppressed  = suppressed_;
+        suppressed_ = 0;
+        return true;
+    }
+
+private:
+    std::mutex            mutex_;
+    const Clock::duration interval_;
+    const std::size_t     burst_;
+    Clock::time_point     window_start_;
+    std::size_t           passed_{0};
+    std::size_t           suppressed_{0};
+
+};  // LogRateLimiter
+
 }  // namespace common
 }  // namespace ocvsmd
 
+/// Logs a message (like `logger.log(level, fmt, args...)`) with rate limiting of the call site.
+///
+/// Intended for messages which could be repeated on hot paths (f.e. per every received message) -
+/// so that a storm of similar messages doesn't flood the log (and the logging queue).
+/// Suppressed messages are counted, and reported by the next passed message of the call site.
+///
+#define OCVSMD_LOG_RATE_LIMITED(logger, level, ...)                                                                 \
+    do                                                                                                              \
+    {                                                                                                               \
+        if ((logger).should_log(level))                                                                             \
+        {                                                                                                           \
+            static ::ocvsmd::common::LogRateLimiter ocvsmd_log_rate_limiter_;                                       \
+            std::size_t                             ocvsmd_log_suppressed_ = 0;                                     \
+            if (ocvsmd_log_rate_limiter_.tryPass(::ocvsmd::common::LogRateLimiter::Clock::now(),                    \
+                                                 ocvsmd_log_suppressed_))                                           \
+            {                                                                                                       \
+                if (ocvsmd_log_suppressed_ > 0)                                                                     \
+                {                                                                                                   \
+                    (logger).log(level, "Suppressed {} similar messages.", ocvsmd_log_suppressed_);                 \
+                }                                                                                                   \
+                (logger).log(level, __VA_ARGS__);                                                                   \
+            }                                                                                                       \
+        }                                                                                                           \
+    } while (false)
+
 #if (__cplusplus < CETL_CPP_STANDARD_17)
 template <>
 struct fmt::formatter<cetl::string_view> : formatter<string_view>
@@ -0,0 +1,40 @@
+//
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#ifndef OCVSMD_COMMON_SVC_DIAG_MEDIA_HEALTH_SPEC_HPP_INCLUDED
+#define OCVSMD_COMMON_SVC_DIAG_MEDIA_HEALTH_SPEC_HPP_INCLUDED
+
+#include "ocvsmd/common/svc/diag/MediaHealth_0_1.hpp"
+
+namespace ocvsmd
+{
+namespace common
+{
+namespace svc
+{
+namespace diag
+{
+
+/// Defines IPC internal housekeeping specification for the `MediaHealth` service.
+///
+struct MediaHealthSpec
+{
+    using Request  = MediaHealth::Request_0_1;
+    using Response = MediaHealth::Response_0_1;
+
+    constexpr auto static svc_full_name()
+    {
+        return "ocvsmd.svc.diag.media_health";
+    }
+
+    MediaHealthSpec() = delete;
+};
+
+}  // namespace diag
+}  // namespace svc
+}  // namespace common
+}  // namespace ocvsmd
+
+#endif  // OCVSMD_COMMON_SVC_DIAG_MEDIA_HEALTH_SPEC_HPP_INCLUDED
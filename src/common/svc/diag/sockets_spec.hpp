@@ -0,0 +1,40 @@
+//
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#ifndef OCVSMD_COMMON_SVC_DIAG_SOCKETS_SPEC_HPP_INCLUDED
+#define OCVSMD_COMMON_SVC_DIAG_SOCKETS_SPEC_HPP_INCLUDED
+
+#include "ocvsmd/common/svc/diag/Sockets_0_1.hpp"
+
+namespace ocvsmd
+{
+namespace common
+{
+namespace svc
+{
+namespace diag
+{
+
+/// Defines IPC internal housekeeping specification for the `Sockets` service.
+///
+struct SocketsSpec
+{
+    using Request  = Sockets::Request_0_1;
+    using Response = Sockets::Response_0_1;
+
+    constexpr auto static svc_full_name()
+    {
+        return "ocvsmd.svc.diag.sockets";
+    }
+
+    SocketsSpec() = delete;
+};
+
+}  // namespace diag
+}  // namespace svc
+}  // namespace common
+}  // namespace ocvsmd
+
+#endif  // OCVSMD_COMMON_SVC_DIAG_SOCKETS_SPEC_HPP_INCLUDED
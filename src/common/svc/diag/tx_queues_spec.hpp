@@ -0,0 +1,40 @@
+//
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#ifndef OCVSMD_COMMON_SVC_DIAG_TX_QUEUES_SPEC_HPP_INCLUDED
+#define OCVSMD_COMMON_SVC_DIAG_TX_QUEUES_SPEC_HPP_INCLUDED
+
+#include "ocvsmd/common/svc/diag/TxQueues_0_1.hpp"
+
+namespace ocvsmd
+{
+namespace common
+{
+namespace svc
+{
+namespace diag
+{
+
+/// Defines IPC internal housekeeping specification for the `TxQueues` service.
+///
+struct TxQueuesSpec
+{
+    using Request  = TxQueues::Request_0_1;
+    using Response = TxQueues::Response_0_1;
+
+    constexpr auto static svc_full_name()
+    {
+        return "ocvsmd.svc.diag.tx_queues";
+    }
+
+    TxQueuesSpec() = delete;
+};
+
+}  // namespace diag
+}  // namespace svc
+}  // namespace common
+}  // namespace ocvsmd
+
+#endif  // OCVSMD_COMMON_SVC_DIAG_TX_QUEUES_SPEC_HPP_INCLUDED
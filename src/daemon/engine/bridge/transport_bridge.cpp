@@ -0,0 +1,224 @@
+//
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "transport_bridge.hpp"
+
+#include "config.hpp"
+#include "engine_helpers.hpp"
+#include "logging.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+#include <libcyphal/executor.hpp>
+#include <libcyphal/presentation/presentation.hpp>
+#include <libcyphal/presentation/publisher.hpp>
+#include <libcyphal/presentation/subscriber.hpp>
+#include <libcyphal/transport/scattered_buffer.hpp>
+#include <libcyphal/transport/transport.hpp>
+#include <libcyphal/transport/types.hpp>
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace ocvsmd
+{
+namespace daemon
+{
+namespace engine
+{
+namespace bridge
+{
+namespace
+{
+
+class TransportBridgeImpl final : public TransportBridge, libcyphal::transport::ScatteredBuffer::IFragmentsVisitor
+{
+public:
+    explicit TransportBridgeImpl(libcyphal::IExecutor& executor)
+        : executor_{executor}
+    {
+    }
+
+    ~TransportBridgeImpl() override
+    {
+        for (const auto direction : {Direction::UdpToCan, Direction::CanToUdp})
+        {
+            const auto& counters = getCounters(direction);
+            logger_->debug("Bridge {} stats (forwarded={}, bytes={}, skipped_own={}, failed={}).",
+                           (direction == Direction::UdpToCan) ? "UDP→CAN" : "CAN→UDP",
+                           counters.forwarded,
+                           counters.forwarded_bytes,
+                           counters.skipped_own,
+                           counters.failed);
+        }
+    }
+
+    TransportBridgeImpl(const TransportBridgeImpl&)                = delete;
+    TransportBridgeImpl(TransportBridgeImpl&&) noexcept            = delete;
+    TransportBridgeImpl& operator=(const TransportBridgeImpl&)     = delete;
+    TransportBridgeImpl& operator=(TransportBridgeImpl&&) noexcept = delete;
+
+    bool addRoute(const Direction                direction,
+                  const Side&                    src_side,
+                  const Side&                    dst_side,
+                  const Config::Pipeline::PortId subject_id,
+                  const std::size_t              extent_bytes)
+    {
+        using CyMakeFailure = libcyphal::presentation::Presentation::MakeFailure;
+
+        auto cy_pub_result = dst_side.presentation.makePublisher<void>(subject_id);
+        if (const auto* const cy_failure = cetl::get_if<CyMakeFailure>(&cy_pub_result))
+        {
+            logger_->error("Bridge: failed to make publisher (subj_id={}, err={}).",
+                           subject_id,
+                           cyFailureToOptError(*cy_failure));
+            return false;
+        }
+
+        auto  route_ptr = std::make_unique<Route>(counters_[static_cast<std::size_t>(direction)],
+                                                 src_side.transport,
+                                                 cetl::get<CyRawPublisher>(std::move(cy_pub_result)));
+        auto& route     = *route_ptr;
+
+        auto cy_sub_result = src_side.presentation.makeSubscriber(  //
+            subject_id,
+            extent_bytes,
+            [this, &route](const auto& arg) {
+                //
+                handleMessage(route, arg.raw_message, arg.metadata);
+            });
+        if (const auto* const cy_failure = cetl::get_if<CyMakeFailure>(&cy_sub_result))
+        {
+            logger_->error("Bridge: failed to make subscriber (subj_id={}, err={}).",
+                           subject_id,
+                           cyFailureToOptError(*cy_failure));
+            return false;
+        }
+        route.cy_subscriber.emplace(cetl::get<CyRawSubscriber>(std::move(cy_sub_result)));
+
+        routes_.push_back(std::move(route_ptr));
+        return true;
+    }
+
+    // TransportBridge
+
+    const Counters& getCounters(const Direction direction) const noexcept override
+    {
+        return counters_[static_cast<std::size_t>(direction)];
+    }
+
+private:
+    using CyRawPublisher    = libcyphal::presentation::Publisher<void>;
+    using CyRawSubscriber   = libcyphal::presentation::Subscriber<void>;
+    using CyScatteredBuff   = libcyphal::transport::ScatteredBuffer;
+    using CyMsgRxMetadata   = libcyphal::transport::MessageRxMetadata;
+    using CyPayloadFragment = libcyphal::transport::PayloadFragment;
+
+    struct Route
+    {
+        Route(Counters& cntrs, libcyphal::transport::ITransport& src_transport, CyRawPublisher&& publisher)
+            : counters{cntrs}
+            , source_transport{src_transport}
+            , cy_publisher{std::move(publisher)}
+        {
+        }
+
+        // NOLINTBEGIN(*-non-private-member-variables-in-classes)
+        Counters&                         counters;
+        libcyphal::transport::ITransport& source_transport;
+        CyRawPublisher                    cy_publisher;
+        cetl::optional<CyRawSubscriber>   cy_subscriber;
+        // NOLINTEND(*-non-private-member-variables-in-classes)
+
+    };  // Route
+
+    void handleMessage(Route& route, const CyScatteredBuff& raw_msg_buff, const CyMsgRxMetadata& metadata)
+    {
+        constexpr auto TxTimeout = std::chrono::milliseconds{100};
+
+        // Skip own messages (f.e. the ones forwarded in the opposite direction, and then looped back).
+        //
+        const auto own_node_id = route.source_transport.getLocalNodeId();
+        if (own_node_id && (metadata.publisher_node_id == own_node_id))
+        {
+            ++route.counters.skipped_own;
+            return;
+        }
+
+        // Forward reassembled fragments as is - no payload copying.
+        // Note that `fragments_` capacity is reused across messages, so normally there is no allocation here.
+        //
+        fragments_.clear();
+        raw_msg_buff.forEachFragment(*this);
+
+        route.cy_publisher.setPriority(metadata.rx_meta.base.priority);
+        const auto deadline = executor_.now() + TxTimeout;
+        if (const auto cy_failure = route.cy_publisher.publish(deadline, {fragments_.data(), fragments_.size()}))
+        {
+            ++route.counters.failed;
+            OCVSMD_LOG_RATE_LIMITED(*logger_,
+                                    spdlog::level::debug,
+                                    "Bridge: failed to forward message (err={}).",
+                                    cyFailureToOptError(*cy_failure));
+            return;
+        }
+        ++route.counters.forwarded;
+        route.counters.forwarded_bytes += raw_msg_buff.size();
+    }
+
+    // IFragmentsVisitor
+
+    void onNext(const CyPayloadFragment fragment) override
+    {
+        if ((fragment.data() != nullptr) && !fragment.empty())
+        {
+            fragments_.push_back(fragment);
+        }
+    }
+
+    libcyphal::IExecutor&               executor_;
+    std::array<Counters, 2>             counters_{};
+    std::vector<std::unique_ptr<Route>> routes_;
+    std::vector<CyPayloadFragment>      fragments_;
+    common::LoggerPtr                   logger_{common::getLogger("engine")};
+
+};  // TransportBridgeImpl
+
+}  // namespace
+
+TransportBridge::Ptr TransportBridge::make(libcyphal::IExecutor& executor,
+                                           const Side&           udp_side,
+                                           const Side&           can_side,
+                                           const Config::Bridge& config)
+{
+    auto bridge = std::make_unique<TransportBridgeImpl>(executor);
+    for (const auto subject_id : config.udp_to_can)
+    {
+        if (!bridge->addRoute(Direction::UdpToCan, udp_side, can_side, subject_id, config.extent))
+        {
+            return nullptr;
+        }
+    }
+    for (const auto subject_id : config.can_to_udp)
+    {
+        if (!bridge->addRoute(Direction::CanToUdp, can_side, udp_side, subject_id, config.extent))
+        {
+            return nullptr;
+        }
+    }
+
+    common::getLogger("engine")->info("Bridge is up (udp_to_can={}, can_to_udp={}).",
+                                      config.udp_to_can.size(),
+                                      config.can_to_udp.size());
+    return bridge;
+}
+
+}  // namespace bridge
+}  // namespace engine
+}  // namespace daemon
+}  // namespace ocvsmd
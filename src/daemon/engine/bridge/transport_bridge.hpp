@@ -0,0 +1,95 @@
+//
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#ifndef OCVSMD_DAEMON_ENGINE_BRIDGE_TRANSPORT_BRIDGE_HPP_INCLUDED
+#define OCVSMD_DAEMON_ENGINE_BRIDGE_TRANSPORT_BRIDGE_HPP_INCLUDED
+
+#include "config.hpp"
+
+#include <cetl/cetl.hpp>
+#include <cetl/pf17/cetlpf.hpp>
+#include <libcyphal/executor.hpp>
+#include <libcyphal/presentation/presentation.hpp>
+#include <libcyphal/transport/transport.hpp>
+
+#include <cstdint>
+#include <memory>
+
+namespace ocvsmd
+{
+namespace daemon
+{
+namespace engine
+{
+namespace bridge
+{
+
+/// @brief Defines Cyphal/UDP ↔ Cyphal/CAN bridge of subjects.
+///
+/// The bridge subscribes (as raw messages) to configured subjects on one transport,
+/// and republishes received messages on the other transport. Reassembled payload fragments
+/// of received messages are passed to the target publisher as is - without any intermediate copying.
+///
+/// Messages published by the daemon itself (on the source side) are never forwarded,
+/// so a subject could be safely bridged in both directions.
+///
+class TransportBridge
+{
+public:
+    using Ptr = std::unique_ptr<TransportBridge>;
+
+    /// Defines direction of forwarding.
+    ///
+    enum class Direction : std::uint8_t
+    {
+        UdpToCan,
+        CanToUdp,
+    };
+
+    /// Defines counters of a single direction.
+    ///
+    struct Counters
+    {
+        std::uint64_t forwarded{0};
+        std::uint64_t forwarded_bytes{0};
+        std::uint64_t skipped_own{0};
+        std::uint64_t failed{0};
+    };
+
+    struct Side
+    {
+        libcyphal::presentation::Presentation& presentation;
+        libcyphal::transport::ITransport&      transport;
+    };
+
+    /// Makes a new bridge according to its configuration.
+    ///
+    /// @return `nullptr` if any of Cyphal ports can't be made.
+    ///
+    CETL_NODISCARD static Ptr make(libcyphal::IExecutor& executor,
+                                   const Side&           udp_side,
+                                   const Side&           can_side,
+                                   const Config::Bridge& config);
+
+    TransportBridge(const TransportBridge&)                = delete;
+    TransportBridge(TransportBridge&&) noexcept            = delete;
+    TransportBridge& operator=(const TransportBridge&)     = delete;
+    TransportBridge& operator=(TransportBridge&&) noexcept = delete;
+
+    virtual ~TransportBridge() = default;
+
+    virtual const Counters& getCounters(const Direction direction) const noexcept = 0;
+
+protected:
+    TransportBridge() = default;
+
+};  // TransportBridge
+
+}  // namespace bridge
+}  // namespace engine
+}  // namespace daemon
+}  // namespace ocvsmd
+
+#endif  // OCVSMD_DAEMON_ENGINE_BRIDGE_TRANSPORT_BRIDGE_HPP_INCLUDED
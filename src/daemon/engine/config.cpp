@@ -11,10 +11,14 @@
 #include <toml.hpp>
 
 #include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <exception>
 #include <fstream>
+#include <functional>
 #include <ios>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <utility>
 #include <vector>
@@ -38,6 +42,8 @@ public:
         : file_path_{std::move(file_path)}
         , root_{std::move(root)}
         , is_dirty_{false}
+        , save_sequence_{0}
+        , writer_{std::make_shared<Writer>()}
     {
     }
 
@@ -45,22 +51,35 @@ public:
 
     void save() override
     {
-        if (is_dirty_)
+        if (const auto write = prepareSave())
         {
-            try
-            {
-                root_["__meta__"]["last_modified"] = std::chrono::system_clock::now();
+            write();
+        }
+    }
 
-                const auto    cfg_str = format(root_);
-                std::ofstream file{file_path_, std::ios_base::out | std::ios_base::binary};
-                file << cfg_str;
+    auto prepareSave() -> std::function<void()> override
+    {
+        if (!is_dirty_)
+        {
+            return {};
+        }
+        try
+        {
+            root_["__meta__"]["last_modified"] = std::chrono::system_clock::now();
 
-                is_dirty_ = false;
+            auto cfg_str = format(root_);
+            is_dirty_    = false;
+            ++save_sequence_;
 
-            } catch (const std::exception& ex)
-            {
-                spdlog::error("Failed to save config. Error: {}", file_path_, ex.what());
-            }
+            return [writer = writer_, file_path = file_path_, sequence = save_sequence_, cfg_str = std::move(cfg_str)] {
+                //
+                writer->write(file_path, sequence, cfg_str);
+            };
+
+        } catch (const std::exception& ex)
+        {
+            spdlog::error("Failed to save config '{}'. Error: {}", file_path_, ex.what());
+            return {};
         }
     }
 
@@ -87,11 +106,170 @@ public:
         is_dirty_ = true;
     }
 
+    auto getCyphalAppTransferIdsFile() const -> cetl::optional<std::string> override
+    {
+        return findImpl<std::string>("cyphal", "application", "transfer_ids_file");
+    }
+
     auto getCyphalTransportInterfaces() const -> std::vector<std::string> override
     {
         return find_or(root_, "cyphal", "transport", "interfaces", std::vector<std::string>{});
     }
 
+    auto getCyphalTransportRxTimestamps() const -> CyphalTransport::RxTimestamps override
+    {
+        const auto source = find_or(root_, "cyphal", "transport", "rx_timestamps", std::string{"executor"});
+        if (source == "kernel")
+        {
+            return CyphalTransport::RxTimestamps::Kernel;
+        }
+        if (source != "executor")
+        {
+            spdlog::warn("Unknown RX timestamps source '{}' - using 'executor'.", source);
+        }
+        return CyphalTransport::RxTimestamps::Executor;
+    }
+
+    auto getCyphalTransportUdpTxQueue() const -> CyphalTransport::TxQueue override
+    {
+        constexpr std::size_t DefaultCapacity = 16;
+
+        return findTxQueueImpl("udp", DefaultCapacity);
+    }
+
+    auto getCyphalTransportUdpRxMode() const -> CyphalTransport::UdpRxMode override
+    {
+        const auto mode = find_or(root_, "cyphal", "transport", "udp", "rx_mode", std::string{"dedicated"});
+        if (mode == "shared")
+        {
+            return CyphalTransport::UdpRxMode::Shared;
+        }
+        if (mode != "dedicated")
+        {
+            spdlog::warn("Unknown UDP RX mode '{}' - using 'dedicated'.", mode);
+        }
+        return CyphalTransport::UdpRxMode::Dedicated;
+    }
+
+    auto getCyphalTransportCanTxQueue() const -> CyphalTransport::TxQueue override
+    {
+        // Capacity is chosen to fit at least 2 max-sized (313 bytes) messages (with 8 bytes of the CRC)
+        // at 7 bytes per a Classic CAN frame.
+        constexpr std::size_t DefaultCapacity = 2 * ((313 + 8) / 7);
+
+        return findTxQueueImpl("can", DefaultCapacity);
+    }
+
+    auto getMemoryPool() const -> MemoryPool override
+    {
+        constexpr std::size_t DefaultBlocksPerChunk = 32;
+        constexpr std::size_t DefaultPreallocBlocks = 32;
+
+        // Classes fit CAN frames, small UDP frames, and full (MTU-sized) UDP frames - together with their
+        // transport TX queue item headers.
+        const std::vector<std::size_t> default_block_sizes{128, 512, 2048};  // NOLINT(*-magic-numbers)
+
+        return {find_or(root_, "memory", "pool", "block_sizes", default_block_sizes),
+                find_or(root_, "memory", "pool", "blocks_per_chunk", DefaultBlocksPerChunk),
+                find_or(root_, "memory", "pool", "prealloc_blocks", DefaultPreallocBlocks)};
+    }
+
+    auto getRunMode() const -> RunMode override
+    {
+        constexpr std::uint32_t DefaultSpinUs  = 100;
+        constexpr std::uint32_t DefaultYieldUs = 1000;
+
+        RunMode run_mode{RunMode::Kind::Blocking,
+                         std::chrono::microseconds{find_or(root_, "engine", "busy_poll", "spin_us", DefaultSpinUs)},
+                         std::chrono::microseconds{find_or(root_, "engine", "busy_poll", "yield_us", DefaultYieldUs)}};
+
+        const auto kind = find_or(root_, "engine", "run_mode", std::string{"blocking"});
+        if (kind == "busy_poll")
+        {
+            run_mode.kind = RunMode::Kind::BusyPoll;
+        }
+        else if (kind != "blocking")
+        {
+            spdlog::warn("Unknown engine run mode '{}' - using 'blocking'.", kind);
+        }
+        return run_mode;
+    }
+
+    auto getThreading() const -> Threading override
+    {
+        const auto threading = find_or(root_, "engine", "threading", std::string{"single"});
+        if (threading == "dedicated_ipc")
+        {
+            return Threading::DedicatedIpc;
+        }
+        if (threading != "single")
+        {
+            spdlog::warn("Unknown engine threading '{}' - using 'single'.", threading);
+        }
+        return Threading::Single;
+    }
+
+    auto getDispatch() const -> Dispatch override
+    {
+        constexpr std::uint32_t DefaultDrainBudgetUs = 100;
+
+        Dispatch dispatch{false,
+                          std::chrono::microseconds{find_or(root_, "engine", "drain_budget_us", DefaultDrainBudgetUs)}};
+
+        const auto kind = find_or(root_, "engine", "dispatch", std::string{"scheduled"});
+        if (kind == "direct")
+        {
+            dispatch.direct = true;
+        }
+        else if (kind != "scheduled")
+        {
+            spdlog::warn("Unknown engine dispatch '{}' - using 'scheduled'.", kind);
+        }
+        return dispatch;
+    }
+
+    auto getWorkerThreads() const -> std::size_t override
+    {
+        constexpr std::size_t DefaultWorkerThreads = 2;
+
+        return find_or(root_, "engine", "worker_threads", DefaultWorkerThreads);
+    }
+
+    auto getProfiling() const -> Profiling override
+    {
+        constexpr std::uint32_t DefaultCallbackBudgetUs = 10000;
+
+        return {find_or(root_, "engine", "profiling", "enabled", true),
+                std::chrono::microseconds{
+                    find_or(root_, "engine", "profiling", "callback_budget_us", DefaultCallbackBudgetUs)}};
+    }
+
+    auto getRuntime() const -> Runtime override
+    {
+        constexpr int DefaultSchedPriority = 10;
+
+        Runtime runtime{Runtime::SchedPolicy::Other,
+                        find_or(root_, "runtime", "sched_priority", DefaultSchedPriority),
+                        find_or(root_, "runtime", "cpu_affinity", std::vector<std::size_t>{}),
+                        find_or(root_, "runtime", "mlockall", false),
+                        find_or(root_, "runtime", "prefault", false)};
+
+        const auto sched_policy = find_or(root_, "runtime", "sched_policy", std::string{"other"});
+        if (sched_policy == "fifo")
+        {
+            runtime.sched_policy = Runtime::SchedPolicy::Fifo;
+        }
+        else if (sched_policy == "rr")
+        {
+            runtime.sched_policy = Runtime::SchedPolicy::RoundRobin;
+        }
+        else if (sched_policy != "other")
+        {
+            spdlog::warn("Unknown runtime scheduling policy '{}' - using 'other'.", sched_policy);
+        }
+        return runtime;
+    }
+
     auto getFileServerRoots() const -> std::vector<std::string> override
     {
         return find_or(root_, "file_server", "roots", std::vector<std::string>{});
@@ -124,7 +302,144 @@ public:
         return findImpl<std::string>("logging", "flush_level");
     }
 
+    auto getLoggingQueueSize() const -> std::size_t override
+    {
+        constexpr std::size_t DefaultQueueSize = 8192;
+
+        return find_or(root_, "logging", "queue_size", DefaultQueueSize);
+    }
+
+    auto getPlugins() const -> std::vector<Plugin> override
+    {
+        std::vector<Plugin> plugins;
+        if (!root_.contains("plugins"))
+        {
+            return plugins;
+        }
+        try
+        {
+            for (const auto& toml_plugin : root_.at("plugins").as_array())
+            {
+                plugins.push_back({toml::find<std::string>(toml_plugin, "path"),
+                                   find_or(toml_plugin, "params", std::string{})});
+            }
+
+        } catch (const std::exception& ex)
+        {
+            spdlog::error("Failed to read plugins config. Error: {}", ex.what());
+        }
+        return plugins;
+    }
+
+    auto getPipelines() const -> std::vector<Pipeline> override
+    {
+        constexpr std::size_t   DefaultExtent       = 1024;
+        constexpr std::uint32_t DefaultDedupTimeout = 2000;  // ms
+        constexpr std::uint8_t  DefaultPriority     = 4;     // nominal
+
+        std::vector<Pipeline> pipelines;
+        if (!root_.contains("pipelines"))
+        {
+            return pipelines;
+        }
+        try
+        {
+            for (const auto& toml_pipeline : root_.at("pipelines").as_array())
+            {
+                Pipeline pipeline{find_or(toml_pipeline, "name", std::string{}),
+                                  toml::find<std::vector<Pipeline::PortId>>(toml_pipeline, "sources"),
+                                  find_or(toml_pipeline, "extent", DefaultExtent),
+                                  toml::find<Pipeline::PortId>(toml_pipeline, "target"),
+                                  {}};
+                if (toml_pipeline.contains("stages"))
+                {
+                    for (const auto& toml_stage : toml_pipeline.at("stages").as_array())
+                    {
+                        pipeline.stages.push_back(
+                            {toml::find<std::string>(toml_stage, "type"),
+                             find_or(toml_stage, "node_ids", std::vector<CyphalApp::NodeId>{}),
+                             find_or(toml_stage, "max_rate_hz", 0.0),
+                             find_or(toml_stage, "timeout_ms", DefaultDedupTimeout),
+                             find_or(toml_stage, "priority", DefaultPriority)});
+                    }
+                }
+                pipelines.push_back(std::move(pipeline));
+            }
+
+        } catch (const std::exception& ex)
+        {
+            spdlog::error("Failed to read pipelines config. Error: {}", ex.what());
+        }
+        return pipelines;
+    }
+
+    auto getFederations() const -> std::vector<Federation> override
+    {
+        constexpr std::size_t DefaultExtent        = 1024;
+        constexpr std::size_t DefaultQueueCapacity = 64;
+
+        std::vector<Federation> federations;
+        if (!root_.contains("federation"))
+        {
+            return federations;
+        }
+        try
+        {
+            for (const auto& toml_federation : root_.at("federation").as_array())
+            {
+                federations.push_back({toml::find<std::string>(toml_federation, "peer"),
+                                       toml::find<std::vector<Pipeline::PortId>>(toml_federation, "subjects"),
+                                       find_or(toml_federation, "extent", DefaultExtent),
+                                       find_or(toml_federation, "queue_capacity", DefaultQueueCapacity)});
+            }
+
+        } catch (const std::exception& ex)
+        {
+            spdlog::error("Failed to read federation config. Error: {}", ex.what());
+        }
+        return federations;
+    }
+
+    auto getBridge() const -> cetl::optional<Bridge> override
+    {
+        constexpr std::size_t DefaultExtent = 1024;
+
+        if (!root_.contains("bridge"))
+        {
+            return cetl::nullopt;
+        }
+        try
+        {
+            const auto& toml_bridge = root_.at("bridge");
+            return Bridge{toml::find<CyphalApp::NodeId>(toml_bridge, "can_node_id"),
+                          find_or(toml_bridge, "udp_to_can", std::vector<Pipeline::PortId>{}),
+                          find_or(toml_bridge, "can_to_udp", std::vector<Pipeline::PortId>{}),
+                          find_or(toml_bridge, "extent", DefaultExtent)};
+
+        } catch (const std::exception& ex)
+        {
+            spdlog::error("Failed to read bridge config. Error: {}", ex.what());
+            return cetl::nullopt;
+        }
+    }
+
 private:
+    CyphalTransport::TxQueue findTxQueueImpl(const char* const transport, const std::size_t default_capacity) const
+    {
+        constexpr std::size_t DefaultMemoryCap = 1024UL * 1024UL;
+
+        const CyphalTransport::TxQueue tx_queue{
+            find_or(root_, "cyphal", "transport", transport, "tx_queue_capacity", default_capacity),
+            find_or(root_, "cyphal", "transport", transport, "tx_queue_adaptive", false),
+            find_or(root_, "cyphal", "transport", transport, "tx_queue_memory_cap", DefaultMemoryCap)};
+        if (tx_queue.capacity == 0)
+        {
+            spdlog::warn("Zero '{}' TX queue capacity - using {}.", transport, default_capacity);
+            return {default_capacity, tx_queue.adaptive, tx_queue.memory_cap};
+        }
+        return tx_queue;
+    }
+
     template <typename T, typename... Keys>
     cetl::optional<T> findImpl(Keys&&... keys) const
     {
@@ -138,9 +453,42 @@ private:
         }
     }
 
-    std::string file_path_;
-    TomlValue   root_;
-    bool        is_dirty_;
+    /// Writes formatted config snapshots to the file.
+    ///
+    /// Writes may come from different threads (see `prepareSave`) - so they are serialized,
+    /// and an older snapshot never overwrites a newer one.
+    ///
+    struct Writer
+    {
+        std::mutex    mutex;
+        std::uint64_t last_sequence{0};
+
+        void write(const std::string& file_path, const std::uint64_t sequence, const std::string& cfg_str)
+        {
+            const std::lock_guard<std::mutex> lock{mutex};
+            if (sequence <= last_sequence)
+            {
+                return;
+            }
+            last_sequence = sequence;
+
+            try
+            {
+                std::ofstream file{file_path, std::ios_base::out | std::ios_base::binary};
+                file << cfg_str;
+
+            } catch (const std::exception& ex)
+            {
+                spdlog::error("Failed to save config '{}'. Error: {}", file_path, ex.what());
+            }
+        }
+    };
+
+    std::string             file_path_;
+    TomlValue               root_;
+    bool                    is_dirty_;
+    std::uint64_t           save_sequence_;
+    std::shared_ptr<Writer> writer_;
 
 };  // ConfigImpl
 
@@ -10,7 +10,10 @@
 #include <cetl/pf17/cetlpf.hpp>
 
 #include <array>
+#include <chrono>
+#include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <string>
 #include <vector>
@@ -33,6 +36,142 @@ public:
         using UniqueId = std::array<std::uint8_t, 16>;  // NOLINT(*-magic-numbers)
     };
 
+    struct CyphalTransport
+    {
+        /// Defines source of timestamps of received frames.
+        ///
+        enum class RxTimestamps : std::uint8_t
+        {
+            Executor,  ///< 'executor' - the executor time of the wakeup (default).
+            Kernel,    ///< 'kernel' - the kernel arrival time of the frame.
+        };
+
+        /// Defines how UDP transport receives datagrams of its multicast groups ('[cyphal.transport.udp] rx_mode').
+        ///
+        enum class UdpRxMode : std::uint8_t
+        {
+            Dedicated,  ///< 'dedicated' - a system socket per group (per interface) (default).
+            Shared,     ///< 'shared' - a single system socket per interface, demultiplexed by the daemon.
+        };
+
+        /// Defines TX queue settings of a transport ('[cyphal.transport.udp]' or '[cyphal.transport.can]').
+        ///
+        struct TxQueue
+        {
+            std::size_t capacity;    ///< Per media capacity (in frames).
+            bool        adaptive;    ///< Whether the capacity grows under burst (up to the memory cap).
+            std::size_t memory_cap;  ///< Max total bytes of queued frames (of all media) in the adaptive mode.
+        };
+    };
+
+    /// Defines settings of the size-class block pools of transport payloads ('[memory.pool]').
+    ///
+    struct MemoryPool
+    {
+        std::vector<std::size_t> block_sizes;
+        std::size_t              blocks_per_chunk;
+        std::size_t              prealloc_blocks;  ///< Per size class.
+    };
+
+    /// Defines run mode of the engine loop ('[engine] run_mode', and '[engine.busy_poll]').
+    ///
+    struct RunMode
+    {
+        enum class Kind : std::uint8_t
+        {
+            Blocking,  ///< 'blocking' - the loop blocks in polling of awaitable resources (default).
+            BusyPoll,  ///< 'busy_poll' - the loop spins over zero-timeout polls (with backoff when idle).
+        };
+
+        Kind                      kind;
+        std::chrono::microseconds spin_for;   ///< Idle time to keep spinning (before yielding).
+        std::chrono::microseconds yield_for;  ///< Idle time to keep yielding (before blocking).
+    };
+
+    /// Defines threading model of the engine ('[engine] threading').
+    ///
+    enum class Threading : std::uint8_t
+    {
+        Single,        ///< 'single' - everything runs on the engine thread (default).
+        DedicatedIpc,  ///< 'dedicated_ipc' - IPC sockets are served by their own thread.
+    };
+
+    /// Defines dispatch of ready I/O callbacks by the executor ('[engine] dispatch', and '[engine] drain_budget_us').
+    ///
+    struct Dispatch
+    {
+        bool                      direct;        ///< 'direct' - executed by the poll; 'scheduled' - by the next spin.
+        std::chrono::microseconds drain_budget;  ///< Zero limits a poll to a single batch of events.
+    };
+
+    /// Defines settings of the executor callbacks profiling ('[engine.profiling]').
+    ///
+    struct Profiling
+    {
+        bool                      enabled;
+        std::chrono::microseconds callback_budget;  ///< Zero disables the stall watchdog.
+    };
+
+    /// Defines real-time settings of the daemon process ('[runtime]').
+    ///
+    struct Runtime
+    {
+        enum class SchedPolicy : std::uint8_t
+        {
+            Other,       ///< 'other' - the default time-sharing scheduling (default).
+            Fifo,        ///< 'fifo' - `SCHED_FIFO` real-time scheduling.
+            RoundRobin,  ///< 'rr' - `SCHED_RR` real-time scheduling.
+        };
+
+        SchedPolicy              sched_policy;
+        int                      sched_priority;  ///< Real-time priority (ignored by 'other' policy).
+        std::vector<std::size_t> cpu_affinity;    ///< Empty means no affinity (all CPUs).
+        bool                     lock_memory;     ///< Whether to lock all (current and future) pages - `mlockall`.
+        bool                     prefault;        ///< Whether to pre-fault stack, heap and memory pools.
+    };
+
+    struct Plugin
+    {
+        std::string path;
+        std::string params;
+    };
+
+    struct Pipeline
+    {
+        using PortId = std::uint16_t;
+
+        struct Stage
+        {
+            std::string                    type;
+            std::vector<CyphalApp::NodeId> node_ids;     // 'node_filter'
+            double                         max_rate_hz;  // 'rate_limit'
+            std::uint32_t                  timeout_ms;   // 'dedup'
+            std::uint8_t                   priority;     // 'priority'
+        };
+
+        std::string         name;
+        std::vector<PortId> sources;
+        std::size_t         extent;
+        PortId              target;
+        std::vector<Stage>  stages;
+    };
+
+    struct Federation
+    {
+        std::string                   peer;
+        std::vector<Pipeline::PortId> subjects;
+        std::size_t                   extent;
+        std::size_t                   queue_capacity;
+    };
+
+    struct Bridge
+    {
+        CyphalApp::NodeId             can_node_id;
+        std::vector<Pipeline::PortId> udp_to_can;
+        std::vector<Pipeline::PortId> can_to_udp;
+        std::size_t                   extent;
+    };
+
     CETL_NODISCARD static Ptr make(std::string file_path);
 
     Config(const Config&)                = delete;
@@ -42,13 +181,35 @@ public:
 
     virtual ~Config() = default;
 
+    /// Saves the config (if modified) - synchronously.
+    ///
     virtual void save() = 0;
 
+    /// Prepares saving of the config (if modified) - the config is formatted right away,
+    /// but writing of the file is left to the returned function, which could be called from any thread
+    /// (f.e. by a worker - see `threading::WorkerPool`). Empty function means that there is nothing to save.
+    ///
+    CETL_NODISCARD virtual auto prepareSave() -> std::function<void()> = 0;
+
     CETL_NODISCARD virtual auto getCyphalAppNodeId() const -> cetl::optional<CyphalApp::NodeId>     = 0;
     CETL_NODISCARD virtual auto getCyphalAppUniqueId() const -> cetl::optional<CyphalApp::UniqueId> = 0;
     virtual void                setCyphalAppUniqueId(const CyphalApp::UniqueId& unique_id)          = 0;
+    CETL_NODISCARD virtual auto getCyphalAppTransferIdsFile() const -> cetl::optional<std::string>  = 0;
+
+    CETL_NODISCARD virtual auto getCyphalTransportInterfaces() const -> std::vector<std::string>        = 0;
+    CETL_NODISCARD virtual auto getCyphalTransportRxTimestamps() const -> CyphalTransport::RxTimestamps = 0;
+    CETL_NODISCARD virtual auto getCyphalTransportUdpTxQueue() const -> CyphalTransport::TxQueue        = 0;
+    CETL_NODISCARD virtual auto getCyphalTransportUdpRxMode() const -> CyphalTransport::UdpRxMode       = 0;
+    CETL_NODISCARD virtual auto getCyphalTransportCanTxQueue() const -> CyphalTransport::TxQueue        = 0;
 
-    CETL_NODISCARD virtual auto getCyphalTransportInterfaces() const -> std::vector<std::string> = 0;
+    CETL_NODISCARD virtual auto getMemoryPool() const -> MemoryPool = 0;
+
+    CETL_NODISCARD virtual auto getRunMode() const -> RunMode           = 0;
+    CETL_NODISCARD virtual auto getThreading() const -> Threading       = 0;
+    CETL_NODISCARD virtual auto getDispatch() const -> Dispatch         = 0;
+    CETL_NODISCARD virtual auto getWorkerThreads() const -> std::size_t = 0;
+    CETL_NODISCARD virtual auto getProfiling() const -> Profiling       = 0;
+    CETL_NODISCARD virtual auto getRuntime() const -> Runtime           = 0;
 
     CETL_NODISCARD virtual auto getFileServerRoots() const -> std::vector<std::string>    = 0;
     virtual void                setFileServerRoots(const std::vector<std::string>& roots) = 0;
@@ -58,6 +219,15 @@ public:
     CETL_NODISCARD virtual auto getLoggingFile() const -> cetl::optional<std::string>       = 0;
     CETL_NODISCARD virtual auto getLoggingLevel() const -> cetl::optional<std::string>      = 0;
     CETL_NODISCARD virtual auto getLoggingFlushLevel() const -> cetl::optional<std::string> = 0;
+    CETL_NODISCARD virtual auto getLoggingQueueSize() const -> std::size_t                  = 0;
+
+    CETL_NODISCARD virtual auto getPlugins() const -> std::vector<Plugin> = 0;
+
+    CETL_NODISCARD virtual auto getPipelines() const -> std::vector<Pipeline> = 0;
+
+    CETL_NODISCARD virtual auto getFederations() const -> std::vector<Federation> = 0;
+
+    CETL_NODISCARD virtual auto getBridge() const -> cetl::optional<Bridge> = 0;
 
 protected:
     Config() = default;
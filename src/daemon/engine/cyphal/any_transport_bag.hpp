@@ -6,10 +6,15 @@
 #ifndef OCVSMD_DAEMON_ENGINE_CYPHAL_ANY_TRANSPORT_BAG_HPP_INCLUDED
 #define OCVSMD_DAEMON_ENGINE_CYPHAL_ANY_TRANSPORT_BAG_HPP_INCLUDED
 
+#include "platform/media_health.hpp"
+#include "platform/socket_stats.hpp"
+#include "platform/tx_queue_memory_resource.hpp"
+
 #include <libcyphal/transport/transport.hpp>
 #include <libcyphal/types.hpp>
 
 #include <memory>
+#include <vector>
 
 namespace ocvsmd
 {
@@ -37,6 +42,18 @@ public:
 
     virtual Transport& getTransport() const = 0;
 
+    /// Gets health reports of all media (interfaces) of the transport - in the order of their media indices.
+    ///
+    virtual std::vector<platform::MediaHealthReport> getMediaHealthReports() const = 0;
+
+    /// Gets socket reports (buffer sizes, kernel drops) of all media of the transport - in the order of their indices.
+    ///
+    virtual std::vector<platform::MediaSocketsReport> getMediaSocketsReports() const = 0;
+
+    /// Gets statistics of TX queues (of all media) of the transport.
+    ///
+    virtual platform::TxQueueMemoryResource::Stats getTxQueueStats() const = 0;
+
 protected:
     AnyTransportBag() = default;
 
@@ -10,6 +10,9 @@
 #include "config.hpp"
 #include "engine_helpers.hpp"
 #include "platform/can/can_media.hpp"
+#include "platform/media_health.hpp"
+#include "platform/pool_memory_resource.hpp"
+#include "platform/tx_queue_memory_resource.hpp"
 #include "transport_helpers.hpp"
 
 #include <cetl/pf17/cetlpf.hpp>
@@ -22,6 +25,7 @@
 #include <cstddef>
 #include <memory>
 #include <utility>
+#include <vector>
 
 namespace ocvsmd
 {
@@ -50,6 +54,21 @@ public:
         return *transport_;
     }
 
+    std::vector<platform::MediaHealthReport> getMediaHealthReports() const override
+    {
+        return media_collection_.getHealthReports();
+    }
+
+    std::vector<platform::MediaSocketsReport> getMediaSocketsReports() const override
+    {
+        return media_collection_.getSocketsReports();
+    }
+
+    platform::TxQueueMemoryResource::Stats getTxQueueStats() const override
+    {
+        return tx_queue_mr_.getStats();
+    }
+
     static Ptr make(cetl::pmr::memory_resource& memory, libcyphal::IExecutor& executor, const Config::Ptr& config)
     {
         CETL_DEBUG_ASSERT(config, "");
@@ -67,7 +86,11 @@ public:
         }
         common::getLogger("io")->trace("Attempting to create CAN transport (ifaces=[{}])…", can_ifaces);
 
-        auto transport_bag = std::make_unique<CanTransportBag>(Spec{}, memory, executor);
+        const bool kernel_timestamps =
+            config->getCyphalTransportRxTimestamps() == Config::CyphalTransport::RxTimestamps::Kernel;
+        const auto pool_config = config->getMemoryPool();
+        auto transport_bag =
+            std::make_unique<CanTransportBag>(Spec{}, memory, executor, kernel_timestamps, pool_config);
 
         auto& media_collection = transport_bag->media_collection_;
         media_collection.parse(can_ifaces);
@@ -76,7 +99,29 @@ public:
             return nullptr;
         }
 
-        auto maybe_transport = makeTransport({memory}, executor, media_collection.span(), TxQueueCapacity);
+        // Preallocated pool keeps steady state TX and RX traffic off the general memory resource.
+        //
+        if (!transport_bag->pool_mr_.reserve(pool_config.prealloc_blocks))
+        {
+            common::getLogger("io")->warn("Failed to preallocate CAN memory pool (blocks={}).",
+                                          pool_config.prealloc_blocks);
+        }
+        if (config->getRuntime().prefault)
+        {
+            transport_bag->pool_mr_.prefault();
+        }
+
+        const auto tx_queue = config->getCyphalTransportCanTxQueue();
+        transport_bag->tx_queue_mr_.configure(tx_queue.capacity * media_collection.count(),
+                                              tx_queue.adaptive,
+                                              tx_queue.memory_cap);
+
+        // RX payloads (of reassembled transfers) are released by libcanard via the "payload" resource.
+        //
+        auto maybe_transport = makeTransport({memory, nullptr, nullptr, &transport_bag->pool_mr_},
+                                             executor,
+                                             media_collection.span(),
+                                             TransportHelpers::txCapacityOf(tx_queue));
         if (const auto* const failure = cetl::get_if<libcyphal::transport::FactoryFailure>(&maybe_transport))
         {
             const auto opt_error = cyFailureToOptError(*failure);
@@ -90,31 +135,37 @@ public:
         // Otherwise, the default Cyphal behavior will fail/interrupt current and future transfers
         // if some of its media encounter transient failures - thus breaking the whole redundancy goal,
         // namely, maintain communication if at least one of the interfaces is still up and running.
+        // Failures are not lost though - each media tracks its own health (see `platform::MediaHealth`),
+        // and TX queue overflows are counted (see `platform::TxQueueMemoryResource`).
         //
-        transport_bag->transport_->setTransientErrorHandler([](auto&) { return cetl::nullopt; });
+        transport_bag->transport_->setTransientErrorHandler(
+            TransportHelpers::CanTxQueueOverflowCounter{transport_bag->tx_queue_mr_});
         // transport_bag->transport_->setTransientErrorHandler(TransportHelpers::CanTransientErrorReporter{});
 
         common::getLogger("io")->debug("Created CAN transport (ifaces={}).", media_collection.count());
         return transport_bag;
     }
 
-    CanTransportBag(Spec, cetl::pmr::memory_resource& memory, libcyphal::IExecutor& executor)
+    CanTransportBag(Spec,
+                    cetl::pmr::memory_resource& memory,
+                    libcyphal::IExecutor&       executor,
+                    const bool                  kernel_timestamps,
+                    const Config::MemoryPool&   pool_config)
         : memory_{memory}
         , executor_{executor}
-        , media_collection_{memory, executor, memory}
+        , pool_mr_{memory, pool_config.block_sizes, pool_config.blocks_per_chunk}
+        , tx_queue_mr_{pool_mr_}
+        , media_collection_{memory, executor, tx_queue_mr_, kernel_timestamps}
     {
     }
 
 private:
     using TransportPtr = libcyphal::UniquePtr<libcyphal::transport::can::ICanTransport>;
 
-    // Our current max `SerializationBufferSizeBytes` is 313 bytes (for `uavcan.node.GetInfo.Response.1.0`)
-    // Assuming CAN classic presentation MTU of 7 bytes (plus a bit of overhead like CRC and stuff),
-    // let's calculate the required TX queue capacity, and make it twice to accommodate 2 such messages.
-    static constexpr std::size_t TxQueueCapacity = 2 * (313U + 8U) / 7U;
-
     cetl::pmr::memory_resource&       memory_;
     libcyphal::IExecutor&             executor_;
+    platform::PoolMemoryResource      pool_mr_;
+    platform::TxQueueMemoryResource   tx_queue_mr_;
     platform::can::CanMediaCollection media_collection_;
     TransportPtr                      transport_;
 
@@ -8,10 +8,12 @@
 #include "file_provider.hpp"
 #include "logging.hpp"
 #include "svc/file_server/list_roots_spec.hpp"
+#include "threading/worker_pool.hpp"
 
 #include <cetl/pf17/cetlpf.hpp>
 #include <libcyphal/presentation/presentation.hpp>
 #include <libcyphal/presentation/server.hpp>
+#include <libcyphal/transport/types.hpp>
 
 #include <uavcan/file/Error_1_0.hpp>
 #include <uavcan/file/GetInfo_0_2.hpp>
@@ -21,13 +23,16 @@
 #include <spdlog/spdlog.h>
 
 #include <algorithm>
+#include <chrono>
 #include <cstddef>
+#include <cstdint>
 #include <fstream>
 #include <ios>
 #include <memory>
 #include <stdlib.h>  // NOLINT ::realpath
 #include <string>
 #include <sys/stat.h>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -60,7 +65,8 @@ class FileProviderImpl final : public FileProvider
 public:
     static Ptr make(cetl::pmr::memory_resource&            memory,
                     libcyphal::presentation::Presentation& presentation,
-                    Config::Ptr                            config)
+                    Config::Ptr                            config,
+                    threading::WorkerPool&                 worker_pool)
     {
         auto read_srv     = makeServer<Svc::Read>("Read", presentation);
         auto get_info_srv = makeServer<Svc::GetInfo>("GetInfo", presentation);
@@ -70,16 +76,19 @@ public:
         }
         return std::make_unique<FileProviderImpl>(memory,
                                                   std::move(config),
+                                                  worker_pool,
                                                   std::move(*read_srv),
                                                   std::move(*get_info_srv));
     }
 
     FileProviderImpl(cetl::pmr::memory_resource& memory,
                      Config::Ptr                 config,
+                     threading::WorkerPool&      worker_pool,
                      Svc::Read::Server&&         read_srv,
                      Svc::GetInfo::Server&&      get_info_srv)
         : memory_{memory}
         , config_{std::move(config)}
+        , worker_pool_{worker_pool}
         , read_srv_{std::move(read_srv)}
         , get_info_srv_{std::move(get_info_srv)}
     {
@@ -109,13 +118,13 @@ public:
             }
         }
 
-        setupOnRequestCallback<Svc::GetInfo>(get_info_srv_, [this](const auto& arg) {
+        setupOnRequestCallback<Svc::GetInfo>(get_info_srv_, [this](const FileRequest& request) {
             //
-            return serveGetInfoRequest(arg);
+            return serveGetInfoRequest(request);
         });
-        setupOnRequestCallback<Svc::Read>(read_srv_, [this](const auto& arg) {
+        setupOnRequestCallback<Svc::Read>(read_srv_, [this](const FileRequest& request) {
             //
-            return serveReadRequest(arg);
+            return serveReadRequest(request);
         });
     }
 
@@ -154,19 +163,53 @@ public:
         if (it != roots_.end())
         {
             roots_.erase(it);
-            config_->setFileServerRoots(roots_);
+            updateRoots();
         }
     }
 
     void pushRoot(const std::string& path, const bool back) override
     {
         roots_.insert(back ? roots_.end() : roots_.begin(), path);
-        config_->setFileServerRoots(roots_);
+        updateRoots();
     }
 
 private:
     using Presentation = libcyphal::presentation::Presentation;
 
+    /// Defines a file request - as it's served by a worker (see `setupOnRequestCallback`).
+    ///
+    /// Everything is copied from the original request b/c the latter lives only during its callback,
+    /// and the roots might be changed (on the executor thread) while the request is being served.
+    ///
+    struct FileRequest
+    {
+        std::vector<std::string>     roots;
+        std::string                  path;
+        std::uint64_t                offset;
+        libcyphal::transport::NodeId remote_node_id;
+    };
+
+    FileRequest makeFileRequest(const Svc::GetInfo::CallbackArg& arg) const
+    {
+        return {roots_, stringFrom(arg.request.path), 0, arg.metadata.remote_node_id};
+    }
+
+    FileRequest makeFileRequest(const Svc::Read::CallbackArg& arg) const
+    {
+        return {roots_, stringFrom(arg.request.path), arg.request.offset, arg.metadata.remote_node_id};
+    }
+
+    /// Updates roots in the config, and persists it (by a worker).
+    ///
+    void updateRoots()
+    {
+        config_->setFileServerRoots(roots_);
+        if (auto write_config = config_->prepareSave())
+        {
+            worker_pool_.post(std::move(write_config), {});
+        }
+    }
+
     template <typename Service>
     static auto makeServer(const cetl::string_view role,
                            Presentation&           presentation) -> cetl::optional<typename Service::Server>
@@ -181,13 +224,31 @@ private:
         return cetl::get<typename Service::Server>(std::move(maybe_server));
     }
 
+    /// Sets up request callback of a server - the request is served by a worker,
+    /// and then its response is sent (via the continuation) back on the executor thread.
+    ///
     template <typename Service, typename Handler>
     void setupOnRequestCallback(typename Service::Server& server, Handler&& handler)
     {
-        server.setOnRequestCallback([handle = std::forward<Handler>(handler)](const auto& arg, auto& continuation) {
+        server.setOnRequestCallback([this, handle = std::forward<Handler>(handler)](const auto& arg,
+                                                                                     auto&       continuation) {
             //
-            constexpr auto timeout = std::chrono::milliseconds{100};
-            continuation(arg.approx_now + timeout, handle(arg));
+            using Continuation = std::decay_t<decltype(continuation)>;
+
+            constexpr auto timeout  = std::chrono::milliseconds{100};
+            const auto     deadline = arg.approx_now + timeout;
+
+            // The continuation is shared b/c completion functions of the worker pool have to be copyable.
+            auto shared_continuation = std::make_shared<Continuation>(std::move(continuation));
+            worker_pool_.submit(
+                [handle, request = makeFileRequest(arg)] {
+                    //
+                    return handle(request);
+                },
+                [shared_continuation, deadline](const typename Service::Response& response) {
+                    //
+                    (*shared_continuation)(deadline, response);
+                });
         });
     }
 
@@ -258,11 +319,11 @@ private:
         return cetl::nullopt;
     }
 
-    cetl::optional<std::pair<std::string, struct stat>> findFirstValidFile(const std::string& request_path) const
+    static cetl::optional<std::pair<std::string, struct stat>> findFirstValidFile(const FileRequest& request)
     {
-        for (const auto& root : roots_)
+        for (const auto& root : request.roots)
         {
-            if (const auto real_path = buildAndValidateRootWithPath(root, request_path))
+            if (const auto real_path = buildAndValidateRootWithPath(root, request.path))
             {
                 // As "best effort" strategy, we skip anything we can't even `stat`.
                 //
@@ -277,20 +338,21 @@ private:
         return cetl::nullopt;
     }
 
-    Svc::GetInfo::Response serveGetInfoRequest(const Svc::GetInfo::CallbackArg& arg) const
+    /// Serves 'GetInfo' request - on a worker thread.
+    ///
+    Svc::GetInfo::Response serveGetInfoRequest(const FileRequest& request) const
     {
         Svc::GetInfo::Response response{&memory_};
 
         // Find the first valid file candidate in the list of roots.
         //
-        const auto request_path  = stringFrom(arg.request.path);
-        const auto path_and_stat = findFirstValidFile(request_path);
+        const auto path_and_stat = findFirstValidFile(request);
         if (!path_and_stat)
         {
             logger_->warn(  //
                 "'GetInfo' file not found (node={}, path='{}').",
-                arg.metadata.remote_node_id,
-                request_path);
+                request.remote_node_id,
+                request.path);
 
             response._error.value = uavcan::file::Error_1_0::NOT_FOUND;
             return response;
@@ -300,8 +362,8 @@ private:
 
         logger_->debug(  //
             "'GetInfo' found file info (node={}, path='{}', size={}, real='{}').",
-            arg.metadata.remote_node_id,
-            request_path,
+            request.remote_node_id,
+            request.path,
             file_stat.st_size,
             file_path);
 
@@ -315,7 +377,9 @@ private:
         return response;
     }
 
-    Svc::Read::Response serveReadRequest(const Svc::Read::CallbackArg& arg) const
+    /// Serves 'Read' request - on a worker thread.
+    ///
+    Svc::Read::Response serveReadRequest(const FileRequest& request) const
     {
         using DataType             = Svc::Read::Response::_traits_::TypeOf::data;
         constexpr auto MaxDataSize = DataType::_traits_::ArrayCapacity::value;
@@ -325,15 +389,14 @@ private:
 
         // Find the first valid file candidate in the list of roots.
         //
-        const auto request_path  = stringFrom(arg.request.path);
-        const auto path_and_stat = findFirstValidFile(request_path);
+        const auto path_and_stat = findFirstValidFile(request);
         if (!path_and_stat)
         {
             logger_->warn(  //
                 "'Read' file not found (node={}, path='{}', off=0x{:X}).",
-                arg.metadata.remote_node_id,
-                request_path,
-                arg.request.offset);
+                request.remote_node_id,
+                request.path,
+                request.offset);
 
             response._error.value = uavcan::file::Error_1_0::NOT_FOUND;
             return response;
@@ -343,13 +406,13 @@ private:
 
         // Don't allow reading beyond the end of the file.
         //
-        if (arg.request.offset >= file_stat.st_size)
+        if (request.offset >= file_stat.st_size)
         {
             logger_->debug(  //
                 "'Read' eof (node={}, path='{}', off=0x{:X}, eof=0x{:X}, real='{}').",
-                arg.metadata.remote_node_id,
-                request_path,
-                arg.request.offset,
+                request.remote_node_id,
+                request.path,
+                request.offset,
                 file_stat.st_size,
                 file_path);
 
@@ -365,14 +428,14 @@ private:
         // (f.e. LRU + flush on change of roots and maybe on some expiration period; refresh on 'GetInfo').
         //
         auto&      buffer        = response.data.value;
-        const auto bytes_to_read = std::min<std::size_t>(file_stat.st_size - arg.request.offset, MaxDataSize);
+        const auto bytes_to_read = std::min<std::size_t>(file_stat.st_size - request.offset, MaxDataSize);
         buffer.resize(bytes_to_read);
         try
         {
             std::ifstream file{file_path.c_str(), std::ios::binary};
             file.exceptions(std::ifstream::failbit | std::ifstream::badbit);
 
-            file.seekg(static_cast<std::streamoff>(arg.request.offset));
+            file.seekg(static_cast<std::streamoff>(request.offset));
             file.read(reinterpret_cast<char*>(buffer.data()), bytes_to_read);  // NOLINT
 
             // The read count should be the same as `bytes_to_read` but let's be sure.
@@ -385,22 +448,22 @@ private:
             // It's still possible to do the flooding (if one keeps reading the first/last chunk over and over),
             // but it's an edge case (anyway, we have a log file limit and rotation policy in place).
             //
-            if ((arg.request.offset + buffer.size()) >= file_stat.st_size)  // last?
+            if ((request.offset + buffer.size()) >= file_stat.st_size)  // last?
             {
                 logger_->debug(  //
                     "'Read' last (node={}, path='{}', off=0x{:X}, eof=0x{:X}, real='{}').",
-                    arg.metadata.remote_node_id,
-                    request_path,
-                    arg.request.offset,
+                    request.remote_node_id,
+                    request.path,
+                    request.offset,
                     file_stat.st_size,
                     file_path);
             }
-            else if (arg.request.offset == 0)  // first?
+            else if (request.offset == 0)  // first?
             {
                 logger_->debug(  //
                     "'Read' first (node={}, path='{}', eof=0x{:X}, real='{}')…",
-                    arg.metadata.remote_node_id,
-                    request_path,
+                    request.remote_node_id,
+                    request.path,
                     file_stat.st_size,
                     file_path);
             }
@@ -409,9 +472,9 @@ private:
         {
             logger_->warn(  //
                 "'Read' failed (node={}, path='{}', off=0x{:X}, eof=0x{:X}, real='{}', err={}): {}.",
-                arg.metadata.remote_node_id,
-                request_path,
-                arg.request.offset,
+                request.remote_node_id,
+                request.path,
+                request.offset,
                 file_stat.st_size,
                 file_path,
                 ex.code().value(),
@@ -425,6 +488,7 @@ private:
 
     cetl::pmr::memory_resource& memory_;
     Config::Ptr                 config_;
+    threading::WorkerPool&      worker_pool_;
     Svc::Read::Server           read_srv_;
     Svc::GetInfo::Server        get_info_srv_;
     common::LoggerPtr           logger_{common::getLogger("engine")};
@@ -436,9 +500,10 @@ private:
 
 FileProvider::Ptr FileProvider::make(cetl::pmr::memory_resource&            memory,
                                      libcyphal::presentation::Presentation& presentation,
-                                     Config::Ptr                            config)
+                                     Config::Ptr                            config,
+                                     threading::WorkerPool&                 worker_pool)
 {
-    return FileProviderImpl::make(memory, presentation, std::move(config));
+    return FileProviderImpl::make(memory, presentation, std::move(config), worker_pool);
 }
 
 }  // namespace cyphal
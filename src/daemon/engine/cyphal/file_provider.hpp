@@ -7,6 +7,7 @@
 #define OCVSMD_DAEMON_ENGINE_CYPHAL_FILE_PROVIDER_HPP_INCLUDED
 
 #include "config.hpp"
+#include "threading/worker_pool.hpp"
 
 #include <cetl/cetl.hpp>
 #include <cetl/pf17/cetlpf.hpp>
@@ -31,6 +32,9 @@ namespace cyphal
 /// - 'Read'
 /// - 'GetInfo'
 ///
+/// File system access (of the requests, and of the config persistence on change of roots)
+/// is done by the worker pool - so that slow storage doesn't stall the engine loop.
+///
 class FileProvider
 {
 public:
@@ -38,7 +42,8 @@ public:
 
     CETL_NODISCARD static Ptr make(cetl::pmr::memory_resource&            memory,
                                    libcyphal::presentation::Presentation& presentation,
-                                   Config::Ptr                            config);
+                                   Config::Ptr                            config,
+                                   threading::WorkerPool&                 worker_pool);
 
     FileProvider(const FileProvider&)                = delete;
     FileProvider(FileProvider&&) noexcept            = delete;
@@ -0,0 +1,205 @@
+//
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "transfer_id_map.hpp"
+
+#include "logging.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fcntl.h>
+#include <memory>
+#include <string>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace ocvsmd
+{
+namespace daemon
+{
+namespace engine
+{
+namespace cyphal
+{
+namespace
+{
+
+constexpr std::uint32_t TableMagic   = 0x4D444954U;  // 'TIDM' (little-endian)
+constexpr std::uint32_t TableVersion = 1;
+
+/// Maps (and creates if needed) the given file of the given size.
+///
+/// @return `nullptr` on failure.
+///
+void* mapFile(const std::string& file_path, const std::size_t size)
+{
+    // NOLINTNEXTLINE(*-vararg)
+    const int fd = ::open(file_path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, S_IRUSR | S_IWUSR);
+    if (fd < 0)
+    {
+        common::getLogger("engine")->warn("Failed to open transfer IDs file '{}' (err={}).", file_path, errno);
+        return nullptr;
+    }
+
+    void*       mapped = nullptr;
+    struct stat file_stat{};
+    if ((::fstat(fd, &file_stat) == 0) &&
+        ((static_cast<std::size_t>(file_stat.st_size) == size) || (::ftruncate(fd, static_cast<off_t>(size)) == 0)))
+    {
+        mapped = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if (mapped == MAP_FAILED)  // NOLINT(*-cstyle-cast, *-pro-type-cast)
+        {
+            mapped = nullptr;
+        }
+    }
+    if (mapped == nullptr)
+    {
+        common::getLogger("engine")->warn("Failed to map transfer IDs file '{}' (err={}).", file_path, errno);
+    }
+
+    // The mapping stays valid after the descriptor is closed.
+    ::close(fd);
+    return mapped;
+}
+
+}  // namespace
+
+TransferIdMap::Ptr TransferIdMap::make(const cetl::optional<std::string>& file_path)
+{
+    void* mapped = nullptr;
+    if (file_path && !file_path->empty())
+    {
+        mapped = mapFile(*file_path, tableSize());
+    }
+
+    auto transfer_id_map = std::make_unique<TransferIdMap>(Spec{}, mapped, (mapped != nullptr) ? tableSize() : 0);
+    if (transfer_id_map->isPersistent())
+    {
+        transfer_id_map->logger_->debug("Mapped transfer IDs file (path='{}', sessions={}).",
+                                        *file_path,
+                                        transfer_id_map->size());
+    }
+    return transfer_id_map;
+}
+
+TransferIdMap::TransferIdMap(Spec, void* const mapped, const std::size_t mapped_size)
+    : header_{nullptr}
+    , entries_{nullptr}
+    , mapped_size_{mapped_size}
+{
+    auto* table = static_cast<cetl::byte*>(mapped);
+    if (table == nullptr)
+    {
+        local_storage_.resize(tableSize());
+        table = local_storage_.data();
+    }
+    // NOLINTBEGIN(*-reinterpret-cast)
+    header_  = reinterpret_cast<Header*>(table);
+    entries_ = reinterpret_cast<Entry*>(table + sizeof(Header));
+    // NOLINTEND(*-reinterpret-cast)
+
+    resetIfIncompatible();
+}
+
+TransferIdMap::~TransferIdMap()
+{
+    if (isPersistent())
+    {
+        ::munmap(header_, mapped_size_);
+    }
+}
+
+std::size_t TransferIdMap::size() const noexcept
+{
+    std::size_t result = 0;
+    for (std::size_t index = 0; index < capacity(); ++index)
+    {
+        result += (entries_[index].is_used != 0) ? 1 : 0;
+    }
+    return result;
+}
+
+auto TransferIdMap::getIdFor(const SessionSpec& session_spec) const noexcept -> TransferId
+{
+    const auto        key   = makeKey(session_spec);
+    const auto* const entry = probe(key);
+    return ((entry != nullptr) && (entry->is_used != 0)) ? entry->transfer_id : 0;
+}
+
+void TransferIdMap::setIdFor(const SessionSpec& session_spec, const TransferId transfer_id) noexcept
+{
+    const auto  key   = makeKey(session_spec);
+    auto* const entry = probe(key);
+    if (entry == nullptr)
+    {
+        if (!is_full_logged_)
+        {
+            is_full_logged_ = true;
+            logger_->warn("Transfer IDs map is full (capacity={}).", capacity());
+        }
+        return;
+    }
+
+    // The "used" flag is written last - so that a crash in between leaves a new entry free.
+    entry->key         = key;
+    entry->transfer_id = transfer_id;
+    entry->is_used     = 1;
+}
+
+std::uint32_t TransferIdMap::makeKey(const SessionSpec& session_spec) noexcept
+{
+    const auto port_id = static_cast<std::uint32_t>(session_spec.port_id);
+    const auto node_id = static_cast<std::uint32_t>(session_spec.node_id);
+    return (port_id << 16U) | node_id;
+}
+
+auto TransferIdMap::probe(const std::uint32_t key) const noexcept -> Entry*
+{
+    constexpr std::uint32_t CapacityBits = 10;
+    constexpr std::uint32_t GoldenRatio  = 0x9E3779B1U;  // Fibonacci hashing - the top bits are the best mixed.
+    static_assert((1U << CapacityBits) == capacity(), "Capacity must be a power of two.");
+
+    const std::size_t mask  = capacity() - 1U;
+    std::size_t       index = static_cast<std::uint32_t>(key * GoldenRatio) >> (32U - CapacityBits);
+    for (std::size_t step = 0; step < capacity(); ++step)
+    {
+        auto& entry = entries_[index];
+        if ((entry.is_used == 0) || (entry.key == key))
+        {
+            return &entry;
+        }
+        index = (index + 1U) & mask;
+    }
+    return nullptr;
+}
+
+void TransferIdMap::resetIfIncompatible() noexcept
+{
+    if ((header_->magic == TableMagic) && (header_->version == TableVersion) && (header_->capacity == capacity()) &&
+        (header_->entry_size == sizeof(Entry)))
+    {
+        return;
+    }
+
+    if (isPersistent())
+    {
+        logger_->info("Resetting incompatible (or new) transfer IDs file.");
+    }
+    std::memset(entries_, 0, capacity() * sizeof(Entry));
+    header_->capacity   = static_cast<std::uint32_t>(capacity());
+    header_->entry_size = static_cast<std::uint32_t>(sizeof(Entry));
+    header_->version    = TableVersion;
+    header_->magic      = TableMagic;
+}
+
+}  // namespace cyphal
+}  // namespace engine
+}  // namespace daemon
+}  // namespace ocvsmd
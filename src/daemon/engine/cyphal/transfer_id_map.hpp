@@ -0,0 +1,147 @@
+//
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#ifndef OCVSMD_DAEMON_ENGINE_CYPHAL_TRANSFER_ID_MAP_HPP_INCLUDED
+#define OCVSMD_DAEMON_ENGINE_CYPHAL_TRANSFER_ID_MAP_HPP_INCLUDED
+
+#include "logging.hpp"
+
+#include <cetl/cetl.hpp>
+#include <cetl/pf17/cetlpf.hpp>
+#include <libcyphal/transport/transfer_id_map.hpp>
+#include <libcyphal/transport/types.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace ocvsmd
+{
+namespace daemon
+{
+namespace engine
+{
+namespace cyphal
+{
+
+/// @brief Defines storage of the next transfer IDs of output sessions (publishers and clients).
+///
+/// Internally, it's a fixed capacity open-addressing (linear probing) flat table - one cache line holds
+/// several entries, and lookup of a session doesn't chase any pointers.
+///
+/// The table could be backed by a memory-mapped file - then transfer IDs survive daemon restarts and upgrades,
+/// so that subscribers on the network don't discard our first transfers (after restart) as duplicates.
+/// The mapped table is used as is (no startup scan or deserialization); an incompatible or corrupted file
+/// (f.e. of a different capacity) is just reset. Without the file, the table lives in the process memory.
+///
+/// Note that libcyphal stores the next transfer ID of a session when the session is destroyed,
+/// so IDs are persisted on graceful shutdown (or on release of a publisher or client).
+///
+class TransferIdMap final : public libcyphal::transport::ITransferIdMap
+{
+    /// Defines private specification for making interface unique ptr.
+    ///
+    struct Spec
+    {
+        explicit Spec() = default;
+    };
+
+public:
+    using Ptr        = std::unique_ptr<TransferIdMap>;
+    using TransferId = libcyphal::transport::TransferId;
+
+    /// Max number of sessions in the map (power of two).
+    ///
+    static constexpr std::size_t capacity() noexcept
+    {
+        return 1024;  // NOLINT(*-magic-numbers)
+    }
+
+    /// Makes a new map.
+    ///
+    /// @param file_path Optional path to the backing file (created if missing).
+    ///                  If the file can't be mapped, the map falls back to the process memory.
+    ///
+    CETL_NODISCARD static Ptr make(const cetl::optional<std::string>& file_path);
+
+    /// @param mapped Memory-mapped table (of `mapped_size` bytes), or `nullptr` for the process memory one.
+    ///
+    TransferIdMap(Spec, void* const mapped, const std::size_t mapped_size);
+
+    TransferIdMap(const TransferIdMap&)                = delete;
+    TransferIdMap(TransferIdMap&&) noexcept            = delete;
+    TransferIdMap& operator=(const TransferIdMap&)     = delete;
+    TransferIdMap& operator=(TransferIdMap&&) noexcept = delete;
+
+    ~TransferIdMap() override;
+
+    /// Gets number of sessions currently in the map.
+    ///
+    std::size_t size() const noexcept;
+
+    /// Checks whether the map is backed by a memory-mapped file.
+    ///
+    bool isPersistent() const noexcept
+    {
+        return mapped_size_ > 0;
+    }
+
+    // MARK: ITransferIdMap
+
+    TransferId getIdFor(const SessionSpec& session_spec) const noexcept override;
+    void       setIdFor(const SessionSpec& session_spec, const TransferId transfer_id) noexcept override;
+
+private:
+    /// Defines header of the table (as stored in the file).
+    ///
+    struct Header
+    {
+        std::uint32_t magic;
+        std::uint32_t version;
+        std::uint32_t capacity;
+        std::uint32_t entry_size;
+    };
+
+    /// Defines a single (16 bytes) entry of the table.
+    ///
+    struct Entry
+    {
+        std::uint32_t key;  ///< `(port_id << 16) | node_id`; valid only if `is_used`.
+        std::uint32_t is_used;
+        TransferId    transfer_id;
+    };
+
+    static constexpr std::size_t tableSize() noexcept
+    {
+        return sizeof(Header) + (capacity() * sizeof(Entry));
+    }
+
+    static std::uint32_t makeKey(const SessionSpec& session_spec) noexcept;
+
+    /// Finds entry of the given key, or the first free entry (where the key could be inserted).
+    ///
+    /// @return `nullptr` if there is no such key, and the table is full.
+    ///
+    Entry* probe(const std::uint32_t key) const noexcept;
+
+    void resetIfIncompatible() noexcept;
+
+    Header*                 header_;
+    Entry*                  entries_;
+    std::size_t             mapped_size_;
+    std::vector<cetl::byte> local_storage_;
+    bool                    is_full_logged_{false};
+    common::LoggerPtr       logger_{common::getLogger("engine")};
+
+};  // TransferIdMap
+
+}  // namespace cyphal
+}  // namespace engine
+}  // namespace daemon
+}  // namespace ocvsmd
+
+#endif  // OCVSMD_DAEMON_ENGINE_CYPHAL_TRANSFER_ID_MAP_HPP_INCLUDED
@@ -6,7 +6,9 @@
 #ifndef OCVSMD_DAEMON_ENGINE_CYPHAL_TRANSPORT_HELPERS_HPP_INCLUDED
 #define OCVSMD_DAEMON_ENGINE_CYPHAL_TRANSPORT_HELPERS_HPP_INCLUDED
 
+#include "config.hpp"
 #include "logging.hpp"
+#include "platform/tx_queue_memory_resource.hpp"
 
 #include <cetl/pf17/cetlpf.hpp>
 #include <libcyphal/errors.hpp>
@@ -16,6 +18,9 @@
 
 #include <spdlog/fmt/fmt.h>
 
+#include <algorithm>
+#include <cstddef>
+
 namespace ocvsmd
 {
 namespace daemon
@@ -61,8 +66,48 @@ struct TransportHelpers
 
     };  // Printers
 
+    /// Gets per media TX queue capacity to be given to libcyphal.
+    ///
+    /// In the adaptive mode, depth of the queues is limited by the `platform::TxQueueMemoryResource` instead,
+    /// so libcyphal capacity is just big enough to never be the binding limit (one byte per frame at least).
+    ///
+    static std::size_t txCapacityOf(const Config::CyphalTransport::TxQueue& tx_queue)
+    {
+        return tx_queue.adaptive ? std::max(tx_queue.capacity, tx_queue.memory_cap) : tx_queue.capacity;
+    }
+
+    /// Checks whether the given failure means that a TX frame didn't fit into a TX queue.
+    ///
+    static bool isTxQueueOverflow(const libcyphal::transport::AnyFailure& failure)
+    {
+        return cetl::holds_alternative<libcyphal::transport::CapacityError>(failure) ||
+               cetl::holds_alternative<libcyphal::MemoryError>(failure);
+    }
+
 #ifdef __linux__
 
+    /// Counts TX queue overflows (see `platform::TxQueueMemoryResource`), and "swallows" all transient failures.
+    ///
+    struct CanTxQueueOverflowCounter
+    {
+        using Report = libcyphal::transport::can::ICanTransport::TransientErrorReport;
+
+        cetl::optional<libcyphal::transport::AnyFailure> operator()(const Report::Variant& report_var) const
+        {
+            if (const auto* const tx_push = cetl::get_if<Report::CanardTxPush>(&report_var))
+            {
+                if (isTxQueueOverflow(tx_push->failure))
+                {
+                    tx_queue_mr.noteOverflow();
+                }
+            }
+            return cetl::nullopt;
+        }
+
+        platform::TxQueueMemoryResource& tx_queue_mr;  // NOLINT(*-avoid-const-or-ref-data-members)
+
+    };  // CanTxQueueOverflowCounter
+
     struct CanTransientErrorReporter
     {
         using Report = libcyphal::transport::can::ICanTransport::TransientErrorReport;
@@ -115,6 +160,42 @@ struct TransportHelpers
 
 #endif  // __linux__
 
+    /// Counts TX queue overflows (see `platform::TxQueueMemoryResource`), and "swallows" all transient failures.
+    ///
+    struct UdpTxQueueOverflowCounter
+    {
+        using Report = libcyphal::transport::udp::IUdpTransport::TransientErrorReport;
+
+        cetl::optional<libcyphal::transport::AnyFailure> operator()(const Report::Variant& report_var) const
+        {
+            if (const auto* const tx_publish = cetl::get_if<Report::UdpardTxPublish>(&report_var))
+            {
+                count(tx_publish->failure);
+            }
+            else if (const auto* const tx_request = cetl::get_if<Report::UdpardTxRequest>(&report_var))
+            {
+                count(tx_request->failure);
+            }
+            else if (const auto* const tx_respond = cetl::get_if<Report::UdpardTxRespond>(&report_var))
+            {
+                count(tx_respond->failure);
+            }
+            return cetl::nullopt;
+        }
+
+        platform::TxQueueMemoryResource& tx_queue_mr;  // NOLINT(*-avoid-const-or-ref-data-members)
+
+    private:
+        void count(const libcyphal::transport::AnyFailure& failure) const
+        {
+            if (isTxQueueOverflow(failure))
+            {
+                tx_queue_mr.noteOverflow();
+            }
+        }
+
+    };  // UdpTxQueueOverflowCounter
+
     struct UdpTransientErrorReporter
     {
         using Report = libcyphal::transport::udp::IUdpTransport::TransientErrorReport;
@@ -9,6 +9,10 @@
 #include "any_transport_bag.hpp"
 #include "config.hpp"
 #include "logging.hpp"
+#include "platform/fixed_block_memory_resource.hpp"
+#include "platform/media_health.hpp"
+#include "platform/pool_memory_resource.hpp"
+#include "platform/tx_queue_memory_resource.hpp"
 #include "platform/udp/udp_media.hpp"
 #include "transport_helpers.hpp"
 
@@ -23,6 +27,7 @@
 #include <cstddef>
 #include <string>
 #include <utility>
+#include <vector>
 
 namespace ocvsmd
 {
@@ -51,6 +56,21 @@ public:
         return *transport_;
     }
 
+    std::vector<platform::MediaHealthReport> getMediaHealthReports() const override
+    {
+        return media_collection_.getHealthReports();
+    }
+
+    std::vector<platform::MediaSocketsReport> getMediaSocketsReports() const override
+    {
+        return media_collection_.getSocketsReports();
+    }
+
+    platform::TxQueueMemoryResource::Stats getTxQueueStats() const override
+    {
+        return tx_queue_mr_.getStats();
+    }
+
     static Ptr make(cetl::pmr::memory_resource& memory, libcyphal::IExecutor& executor, const Config::Ptr& config)
     {
         CETL_DEBUG_ASSERT(config, "");
@@ -68,7 +88,12 @@ public:
         }
         common::getLogger("io")->trace("Attempting to create UDP transport (ifaces=[{}])…", udp_ifaces);
 
-        auto transport_bag = std::make_unique<UdpTransportBag>(Spec{}, memory, executor);
+        const bool kernel_timestamps =
+            config->getCyphalTransportRxTimestamps() == Config::CyphalTransport::RxTimestamps::Kernel;
+        const bool shared_rx   = config->getCyphalTransportUdpRxMode() == Config::CyphalTransport::UdpRxMode::Shared;
+        const auto pool_config = config->getMemoryPool();
+        auto transport_bag =
+            std::make_unique<UdpTransportBag>(Spec{}, memory, executor, kernel_timestamps, shared_rx, pool_config);
 
         auto& media_collection = transport_bag->media_collection_;
         media_collection.parse(udp_ifaces);
@@ -77,7 +102,33 @@ public:
             return nullptr;
         }
 
-        auto maybe_transport = makeTransport({memory}, executor, media_collection.span(), TxQueueCapacity);
+        // Preallocated pools keep steady state TX and RX traffic off the general memory resource.
+        //
+        if (!transport_bag->pool_mr_.reserve(pool_config.prealloc_blocks) ||
+            !transport_bag->rx_payload_mr_.reserve(pool_config.prealloc_blocks))
+        {
+            common::getLogger("io")->warn("Failed to preallocate UDP memory pools (blocks={}).",
+                                          pool_config.prealloc_blocks);
+        }
+        if (config->getRuntime().prefault)
+        {
+            transport_bag->pool_mr_.prefault();
+            transport_bag->rx_payload_mr_.prefault();
+        }
+
+        const auto tx_queue = config->getCyphalTransportUdpTxQueue();
+        transport_bag->tx_queue_mr_.configure(tx_queue.capacity * media_collection.count(),
+                                              tx_queue.adaptive,
+                                              tx_queue.memory_cap);
+
+        // RX datagram buffers (and so reassembled payloads) are released by libudpard via the "payload" resource.
+        // Its small per-frame RX fragment descriptors are served by the block pool.
+        //
+        auto maybe_transport =
+            makeTransport({memory, nullptr, &transport_bag->pool_mr_, &transport_bag->rx_payload_mr_},
+                          executor,
+                          media_collection.span(),
+                          TransportHelpers::txCapacityOf(tx_queue));
         if (const auto* const failure = cetl::get_if<libcyphal::transport::FactoryFailure>(&maybe_transport))
         {
             const auto opt_error = cyFailureToOptError(*failure);
@@ -91,30 +142,44 @@ public:
         // Otherwise, the default Cyphal behavior will fail/interrupt current and future transfers
         // if some of its media encounter transient failures - thus breaking the whole redundancy goal,
         // namely, maintain communication if at least one of the interfaces is still up and running.
+        // Failures are not lost though - each media tracks its own health (see `platform::MediaHealth`),
+        // and TX queue overflows are counted (see `platform::TxQueueMemoryResource`).
         //
-        transport_bag->transport_->setTransientErrorHandler([](auto&) { return cetl::nullopt; });
+        transport_bag->transport_->setTransientErrorHandler(
+            TransportHelpers::UdpTxQueueOverflowCounter{transport_bag->tx_queue_mr_});
         // transport_bag->transport_->setTransientErrorHandler(TransportHelpers::UdpTransientErrorReporter{});
 
         common::getLogger("io")->debug("Created UDP transport (ifaces={})", media_collection.count());
         return transport_bag;
     }
 
-    UdpTransportBag(Spec, cetl::pmr::memory_resource& memory, libcyphal::IExecutor& executor)
+    UdpTransportBag(Spec,
+                    cetl::pmr::memory_resource& memory,
+                    libcyphal::IExecutor&       executor,
+                    const bool                  kernel_timestamps,
+                    const bool                  shared_rx,
+                    const Config::MemoryPool&   pool_config)
         : memory_{memory}
         , executor_{executor}
-        , media_collection_{memory, executor, memory}
+        , pool_mr_{memory, pool_config.block_sizes, pool_config.blocks_per_chunk}
+        , tx_queue_mr_{pool_mr_}
+        , rx_payload_mr_{memory, platform::udp::UdpRxSocket::BufferSize, RxBlocksPerChunk}
+        , media_collection_{memory, executor, tx_queue_mr_, rx_payload_mr_, kernel_timestamps, shared_rx}
     {
     }
 
 private:
     using TransportPtr = libcyphal::UniquePtr<libcyphal::transport::udp::IUdpTransport>;
 
-    static constexpr std::size_t TxQueueCapacity = 16;
+    static constexpr std::size_t RxBlocksPerChunk = 32;
 
-    cetl::pmr::memory_resource&       memory_;
-    libcyphal::IExecutor&             executor_;
-    platform::udp::UdpMediaCollection media_collection_;
-    TransportPtr                      transport_;
+    cetl::pmr::memory_resource&        memory_;
+    libcyphal::IExecutor&              executor_;
+    platform::PoolMemoryResource       pool_mr_;
+    platform::TxQueueMemoryResource    tx_queue_mr_;
+    platform::FixedBlockMemoryResource rx_payload_mr_;
+    platform::udp::UdpMediaCollection  media_collection_;
+    TransportPtr                       transport_;
 
 };  // UdpTransportBag
 
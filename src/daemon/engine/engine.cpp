@@ -5,21 +5,31 @@
 
 #include "engine.hpp"
 
+#include "bridge/transport_bridge.hpp"
 #include "config.hpp"
 #include "cyphal/can_transport_bag.hpp"
 #include "cyphal/file_provider.hpp"
 #include "cyphal/udp_transport_bag.hpp"
 #include "engine_helpers.hpp"
+#include "federation/federation_link.hpp"
 #include "io/socket_address.hpp"
 #include "ipc/pipe/server_pipe.hpp"
 #include "ipc/pipe/socket_server.hpp"
 #include "ipc/server_router.hpp"
+#include "ocvsmd/platform/executor_profiler.hpp"
+#include "ocvsmd/platform/log_linear_histogram.hpp"
+#include "ocvsmd/platform/posix_executor_extension.hpp"
+#include "pipeline/pipeline.hpp"
+#include "plugin/plugin_host.hpp"
+#include "svc/diag/services.hpp"
 #include "svc/file_server/services.hpp"
 #include "svc/node/services.hpp"
 #include "svc/relay/services.hpp"
 #include "svc/svc_helpers.hpp"
+#include "threading/threaded_server_pipe.hpp"
 
 #include <cetl/pf17/cetlpf.hpp>
+#include <cetl/rtti.hpp>
 #include <libcyphal/application/node.hpp>
 #include <libcyphal/types.hpp>
 
@@ -28,6 +38,7 @@
 #include <algorithm>
 #include <chrono>
 #include <cstdint>
+#include <cstddef>
 #include <functional>
 #include <limits>
 #include <memory>
@@ -51,12 +62,59 @@ cetl::optional<std::string> Engine::init()
 {
     logger_->trace("Initializing engine...");
 
+#ifdef PLATFORM_USE_IO_URING
+    if (!executor_.isIoUringBackend())
+    {
+        logger_->warn("io_uring is not available - falling back to epoll executor.");
+    }
+#endif
+
+    // 0. Register the wake-up event - the engine loop is tickless (see `runWhile`).
+    //
+    if (!wakeup_event_.isValid())
+    {
+        return "Failed to create engine wake-up event.";
+    }
+    auto* const posix_executor_ext = cetl::rtti_cast<ocvsmd::platform::IPosixExecutorExtension*>(&executor_);
+    CETL_DEBUG_ASSERT(posix_executor_ext != nullptr, "");
+    wakeup_callback_ = posix_executor_ext->registerAwaitableCallback(  //
+        [](const auto&) {
+            //
+            // Nothing to do here - the event is drained by the executor, and the loop predicate
+            // is re-evaluated by the next iteration of the engine loop.
+        },
+        ocvsmd::platform::IPosixExecutorExtension::Trigger::Event{wakeup_event_.fd()});
+    //
+    setupProfiling();
+    //
+    const auto run_mode = config_->getRunMode();
+    if (run_mode.kind == Config::RunMode::Kind::BusyPoll)
+    {
+        logger_->info("Engine runs in busy-poll mode (spin={}us, yield={}us).",
+                      run_mode.spin_for.count(),
+                      run_mode.yield_for.count());
+        busy_poll_backoff_.emplace(run_mode.spin_for, run_mode.yield_for);
+    }
+    //
+    const auto dispatch = config_->getDispatch();
+    if (!executor_.setDispatch(dispatch.direct, dispatch.drain_budget))
+    {
+        logger_->warn("Direct dispatch is not supported by the executor - using 'scheduled'.");
+    }
+    else if (dispatch.direct)
+    {
+        logger_->info("Engine dispatches ready I/O callbacks directly (drain_budget={}us).",
+                      dispatch.drain_budget.count());
+    }
+
     // 1. Create the transport layer object (try first UDP, then CAN).
     //    Set the local node ID if configured.
     //
+    bool is_udp_primary = false;
     if (auto maybe_udp_transport_bag = cyphal::UdpTransportBag::make(memory_, executor_, config_))
     {
         any_transport_bag_ = std::move(maybe_udp_transport_bag);
+        is_udp_primary     = true;
     }
     else
     {
@@ -77,11 +135,31 @@ cetl::optional<std::string> Engine::init()
     {
         any_transport_bag_->getTransport().setLocalNodeId(node_id.value());
     }
+    //    If bridge is configured (and UDP is the primary transport) then create the secondary CAN transport too.
+    //
+    const auto bridge_config = config_->getBridge();
+#ifdef __linux__
+    if (bridge_config && is_udp_primary)
+    {
+        bridge_transport_bag_ = cyphal::CanTransportBag::make(memory_, executor_, config_);
+        if (!bridge_transport_bag_)
+        {
+            std::string msg = "Failed to create Cyphal/CAN transport for the bridge.";
+            logger_->error(msg);
+            return msg;
+        }
+        bridge_transport_bag_->getTransport().setLocalNodeId(bridge_config->can_node_id);
+    }
+#else
+    (void) is_udp_primary;
+#endif  // __linux__
 
     // 2. Create the presentation layer object.
+    //    Transfer IDs of its output sessions are (optionally) persisted across restarts.
     //
+    transfer_id_map_ = cyphal::TransferIdMap::make(config_->getCyphalAppTransferIdsFile());
     presentation_.emplace(memory_, executor_, any_transport_bag_->getTransport());
-    presentation_->setTransferIdMap(&transfer_id_map_);
+    presentation_->setTransferIdMap(transfer_id_map_.get());
 
     // 3. Create the node object with name.
     //
@@ -103,9 +181,18 @@ cetl::optional<std::string> Engine::init()
         .setSoftwareVcsRevisionId(VCS_REVISION_ID)
         .setUniqueId(getUniqueId());
 
-    // 5. Bring up various providers.
+    // 5. Bring up the worker pool, and various providers.
+    //    The pool is destroyed first (see `worker_pool_` member) - so that none of its pending completions
+    //    (or the work in progress) outlive components which have posted them.
     //
-    file_provider_ = cyphal::FileProvider::make(memory_, *presentation_, config_);
+    worker_pool_ = threading::WorkerPool::make(executor_, config_->getWorkerThreads());
+    if (worker_pool_ == nullptr)
+    {
+        std::string msg = "Failed to create worker pool.";
+        logger_->error(msg);
+        return msg;
+    }
+    file_provider_ = cyphal::FileProvider::make(memory_, *presentation_, config_, *worker_pool_);
     if (file_provider_ == nullptr)
     {
         std::string msg = "Failed to create cyphal file provider.";
@@ -136,7 +223,15 @@ cetl::optional<std::string> Engine::init()
             return cetl::optional<std::string>{err_str};
         }
         const auto socket_address = cetl::get<ParseResult::Success>(maybe_socket_address);
-        server_pipe               = std::make_unique<common::ipc::pipe::SocketServer>(executor_, socket_address);
+        if (config_->getThreading() == Config::Threading::DedicatedIpc)
+        {
+            logger_->info("Serving IPC connection on a dedicated thread.");
+            server_pipe = std::make_unique<threading::ThreadedServerPipe>(executor_, socket_address);
+        }
+        else
+        {
+            server_pipe = std::make_unique<common::ipc::pipe::SocketServer>(executor_, socket_address);
+        }
     }
     //
     ipc_router_ = common::ipc::ServerRouter::make(memory_, std::move(server_pipe));
@@ -145,6 +240,7 @@ cetl::optional<std::string> Engine::init()
     svc::node::registerAllServices(svc_context);
     svc::relay::registerAllServices(svc_context);
     svc::file_server::registerAllServices(svc_context, *file_provider_);
+    svc::diag::registerAllServices(svc_context, *any_transport_bag_, bridge_transport_bag_.get());
     //
     if (const auto opt_error = ipc_router_->start())
     {
@@ -153,34 +249,190 @@ cetl::optional<std::string> Engine::init()
         return cetl::optional<std::string>{err_str};
     }
 
+    // 7. Bring up the Cyphal/UDP ↔ Cyphal/CAN bridge (if configured).
+    //    The CAN side has its own presentation layer and node (with the same info, but different node ID).
+    //    Its transfer IDs are kept in a separate map (and file) b/c the UDP and CAN node IDs might be equal,
+    //    and so sessions of the same subject would collide in a shared map.
+    //
+    if (bridge_transport_bag_)
+    {
+        auto bridge_transfer_ids_file = config_->getCyphalAppTransferIdsFile();
+        if (bridge_transfer_ids_file)
+        {
+            *bridge_transfer_ids_file += ".can";
+        }
+        bridge_transfer_id_map_ = cyphal::TransferIdMap::make(bridge_transfer_ids_file);
+        bridge_presentation_.emplace(memory_, executor_, bridge_transport_bag_->getTransport());
+        bridge_presentation_->setTransferIdMap(bridge_transfer_id_map_.get());
+
+        auto maybe_bridge_node = libcyphal::application::Node::make(*bridge_presentation_);
+        if (const auto* const failure = cetl::get_if<libcyphal::application::Node::MakeFailure>(&maybe_bridge_node))
+        {
+            const auto err_str = fmt::format("Failed to create bridge node (err={}).", cyFailureToOptError(*failure));
+            logger_->error(err_str);
+            return cetl::optional<std::string>{err_str};
+        }
+        bridge_node_.emplace(cetl::get<libcyphal::application::Node>(std::move(maybe_bridge_node)));
+        auto& bridge_info_prov = bridge_node_->getInfoProvider();
+        bridge_info_prov  //
+            .setName(NODE_NAME)
+            .setSoftwareVersion(VERSION_MAJOR, VERSION_MINOR)
+            .setSoftwareVcsRevisionId(VCS_REVISION_ID)
+            .setUniqueId(getUniqueId());
+
+        transport_bridge_ = bridge::TransportBridge::make(  //
+            executor_,
+            {*presentation_, any_transport_bag_->getTransport()},
+            {*bridge_presentation_, bridge_transport_bag_->getTransport()},
+            *bridge_config);
+        if (!transport_bridge_)
+        {
+            std::string msg = "Failed to create Cyphal/UDP ↔ Cyphal/CAN bridge.";
+            logger_->error(msg);
+            return msg;
+        }
+    }
+
+    // 8. Bring up configured pipelines (if any).
+    //    An invalid pipeline is logged and skipped - it doesn't prevent the engine from running.
+    //
+    for (const auto& pipeline_cfg : config_->getPipelines())
+    {
+        if (auto pipeline = pipeline::Pipeline::make(executor_, *presentation_, pipeline_cfg))
+        {
+            pipelines_.push_back(std::move(pipeline));
+        }
+    }
+
+    // 9. Bring up federation links with peer daemons (if any).
+    //    Peers are connected asynchronously, so their unavailability doesn't block the engine.
+    //
+    for (const auto& federation_cfg : config_->getFederations())
+    {
+        if (auto link = federation::FederationLink::make(memory_, executor_, *presentation_, federation_cfg))
+        {
+            federation_links_.push_back(std::move(link));
+        }
+    }
+
+    // 10. Load in-process plugins (if any).
+    //    Done last b/c plugins may depend on everything above (presentation, node, etc.).
+    //
+    plugin_host_ = plugin::PluginHost::make(memory_, executor_, *presentation_, config_);
+
     logger_->debug("Engine is initialized.");
     return cetl::nullopt;
 }
 
 void Engine::runWhile(const std::function<bool()>& loop_predicate)
 {
-    using std::chrono_literals::operator""s;
+    using Profiler = ocvsmd::platform::ExecutorProfiler;
 
     libcyphal::Duration worst_lateness{0};
     while (loop_predicate())
     {
+        const auto spin_start  = Profiler::Clock::now();
         const auto spin_result = executor_.spinOnce();
-        worst_lateness         = std::max(worst_lateness, spin_result.worst_lateness);
+        executor_.recordSpin(Profiler::Clock::now() - spin_start, spin_result.worst_lateness);
+        worst_lateness = std::max(worst_lateness, spin_result.worst_lateness);
 
-        // Poll awaitable resources but awake at least once per second.
-        libcyphal::Duration timeout{1s};
+        if (is_stats_dump_requested_.exchange(false))
+        {
+            logExecutorStats();
+        }
+
+        // Poll awaitable resources until the next scheduled callback (if any) - there is no periodic wake-up,
+        // so an idle engine sleeps until some I/O, or until the `wakeUp` call (f.e. by a signal handler).
+        //
+        cetl::optional<libcyphal::Duration> timeout;
         if (spin_result.next_exec_time.has_value())
         {
-            timeout = std::min(timeout, spin_result.next_exec_time.value() - executor_.now());
+            timeout = spin_result.next_exec_time.value() - executor_.now();
+        }
+        //
+        // In the busy-poll mode, the poll doesn't block (unless the loop has been idle for a while) -
+        // see `platform::BusyPollBackoff` for details.
+        //
+        if (busy_poll_backoff_)
+        {
+            timeout = busy_poll_backoff_->apply(executor_.readyAwaitablesCount(), executor_.now(), timeout);
         }
 
-        if (const auto poll_failure = executor_.pollAwaitableResourcesFor(cetl::make_optional(timeout)))
+        if (const auto poll_failure = executor_.pollAwaitableResourcesFor(timeout))
         {
             spdlog::warn("Failed to poll awaitable resources (err={}).", cyFailureToOptError(*poll_failure));
         }
     }
     spdlog::debug("Run loop predicate is fulfilled (worst_lateness={}us).",
                   std::chrono::duration_cast<std::chrono::microseconds>(worst_lateness).count());
+    if (executor_.isProfilingEnabled())
+    {
+        logExecutorStats();
+    }
+}
+
+void Engine::wakeUp() const noexcept
+{
+    wakeup_event_.signal();
+}
+
+void Engine::requestStatsDump() const noexcept
+{
+    is_stats_dump_requested_ = true;
+    wakeup_event_.signal();
+}
+
+void Engine::setupProfiling()
+{
+    using Profiler = ocvsmd::platform::ExecutorProfiler;
+
+    const auto profiling = config_->getProfiling();
+    executor_.setProfilingEnabled(profiling.enabled);
+    executor_.setCallbackBudget(profiling.callback_budget);
+    executor_.setStallHandler([this](const char* const what, const Profiler::Duration duration) {
+        //
+        logger_->warn("Executor stall (what='{}', duration={}us, budget={}us).",
+                      what,
+                      std::chrono::duration_cast<std::chrono::microseconds>(duration).count(),
+                      std::chrono::duration_cast<std::chrono::microseconds>(executor_.callbackBudget()).count());
+    });
+}
+
+void Engine::logExecutorStats() const
+{
+    using Profiler = ocvsmd::platform::ExecutorProfiler;
+
+    const auto log_stats = [this](const char* const what, const Profiler::Stats& stats) {
+        //
+        const auto& histogram = stats.histogram;
+        if (histogram.count() > 0)
+        {
+            logger_->info("Executor '{}' stats (count={}, p50={}ns, p99={}ns, p99.9={}ns, max={}ns, over_budget={}).",
+                          what,
+                          histogram.count(),
+                          histogram.percentile(50.0),  // NOLINT(*-magic-numbers)
+                          histogram.percentile(99.0),  // NOLINT(*-magic-numbers)
+                          histogram.percentile(99.9),  // NOLINT(*-magic-numbers)
+                          histogram.max(),
+                          stats.over_budget);
+        }
+    };
+
+    for (std::size_t index = 0; index < Profiler::categoriesCount(); ++index)
+    {
+        const auto category = static_cast<Profiler::Category>(index);
+        log_stats(Profiler::categoryName(category), executor_.callbackStats(category));
+    }
+    log_stats("spin", executor_.spinStats());
+
+    const auto& lateness = executor_.latenessHistogram();
+    logger_->info("Executor scheduling lateness (late_spins={}, p50={}us, p90={}us, p99={}us, p99.9={}us, max={}us).",
+                  lateness.count(),
+                  lateness.percentile(50.0) / 1000U,  // NOLINT(*-magic-numbers)
+                  lateness.percentile(90.0) / 1000U,  // NOLINT(*-magic-numbers)
+                  lateness.percentile(99.0) / 1000U,  // NOLINT(*-magic-numbers)
+                  lateness.percentile(99.9) / 1000U,  // NOLINT(*-magic-numbers)
+                  lateness.max() / 1000U);            // NOLINT(*-magic-numbers)
 }
 
 Engine::UniqueId Engine::getUniqueId() const
@@ -6,24 +6,33 @@
 #ifndef OCVSMD_DAEMON_ENGINE_HPP_INCLUDED
 #define OCVSMD_DAEMON_ENGINE_HPP_INCLUDED
 
+#include "bridge/transport_bridge.hpp"
 #include "config.hpp"
 #include "cyphal/any_transport_bag.hpp"
 #include "cyphal/file_provider.hpp"
+#include "cyphal/transfer_id_map.hpp"
+#include "federation/federation_link.hpp"
 #include "logging.hpp"
 #include "ocvsmd/platform/defines.hpp"
+#include "pipeline/pipeline.hpp"
+#include "platform/busy_poll_backoff.hpp"
+#include "platform/wakeup_event.hpp"
+#include "plugin/plugin_host.hpp"
+#include "threading/worker_pool.hpp"
 
 #include <ipc/server_router.hpp>
 
 #include <cetl/cetl.hpp>
 #include <cetl/pf17/cetlpf.hpp>
 #include <libcyphal/application/node.hpp>
+#include <libcyphal/executor.hpp>
 #include <libcyphal/presentation/presentation.hpp>
-#include <libcyphal/transport/transfer_id_map.hpp>
 #include <libcyphal/transport/types.hpp>
 
+#include <atomic>
 #include <functional>
 #include <string>
-#include <unordered_map>
+#include <vector>
 
 namespace ocvsmd
 {
@@ -40,43 +49,50 @@ public:
     CETL_NODISCARD cetl::optional<std::string> init();
     void                                       runWhile(const std::function<bool()>& loop_predicate);
 
-private:
-    using UniqueId = Config::CyphalApp::UniqueId;
-
-    class TransferIdMap final : public libcyphal::transport::ITransferIdMap
-    {
-        using TransferId = libcyphal::transport::TransferId;
-        using Map        = std::unordered_map<SessionSpec, TransferId>;
-
-        // ITransferIdMap
+    /// Wakes up the engine loop (see `runWhile`) - so that its predicate is re-evaluated.
+    ///
+    /// The loop doesn't wake up periodically when there is nothing to do, so this method should be called
+    /// whenever the predicate may change its result (f.e. from a termination signal handler).
+    /// Async-signal-safe, and thread-safe.
+    ///
+    void wakeUp() const noexcept;
 
-        TransferId getIdFor(const SessionSpec& session_spec) const noexcept override
-        {
-            const auto it = session_spec_to_transfer_id_.find(session_spec);
-            return it != session_spec_to_transfer_id_.end() ? it->second : 0;
-        }
+    /// Requests the engine loop to log (at its next spin) statistics of the executor profiler.
+    ///
+    /// Async-signal-safe, and thread-safe (f.e. it's called by the `SIGUSR1` signal handler).
+    ///
+    void requestStatsDump() const noexcept;
 
-        void setIdFor(const SessionSpec& session_spec, const TransferId transfer_id) noexcept override
-        {
-            session_spec_to_transfer_id_[session_spec] = transfer_id;
-        }
-
-        Map session_spec_to_transfer_id_;
-
-    };  // TransferIdMap
+private:
+    using UniqueId = Config::CyphalApp::UniqueId;
 
     UniqueId getUniqueId() const;
+    void     setupProfiling();
+    void     logExecutorStats() const;
 
     Config::Ptr                                           config_;
     common::LoggerPtr                                     logger_{common::getLogger("engine")};
-    platform::SingleThreadedExecutor                      executor_;
+    ocvsmd::platform::SingleThreadedExecutor              executor_;
+    platform::WakeupEvent                                 wakeup_event_;
+    mutable std::atomic<bool>                             is_stats_dump_requested_{false};
+    cetl::optional<platform::BusyPollBackoff>             busy_poll_backoff_;
+    libcyphal::IExecutor::Callback::Any                   wakeup_callback_;
     cetl::pmr::memory_resource&                           memory_{*cetl::pmr::get_default_resource()};
     cyphal::AnyTransportBag::Ptr                          any_transport_bag_;
-    TransferIdMap                                         transfer_id_map_;
+    cyphal::AnyTransportBag::Ptr                          bridge_transport_bag_;
+    cyphal::TransferIdMap::Ptr                            transfer_id_map_;
+    cyphal::TransferIdMap::Ptr                            bridge_transfer_id_map_;
     cetl::optional<libcyphal::presentation::Presentation> presentation_;
+    cetl::optional<libcyphal::presentation::Presentation> bridge_presentation_;
     cetl::optional<libcyphal::application::Node>          node_;
+    cetl::optional<libcyphal::application::Node>          bridge_node_;
+    bridge::TransportBridge::Ptr                          transport_bridge_;
     cyphal::FileProvider::Ptr                             file_provider_;
     common::ipc::ServerRouter::Ptr                        ipc_router_;
+    std::vector<pipeline::Pipeline::Ptr>                  pipelines_;
+    std::vector<federation::FederationLink::Ptr>          federation_links_;
+    plugin::PluginHost::Ptr                               plugin_host_;
+    threading::WorkerPool::Ptr                            worker_pool_;  // Last - so destroyed first (see `init`).
 
 };  // Engine
 
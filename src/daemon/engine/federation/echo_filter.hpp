@@ -0,0 +1,132 @@
+//
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#ifndef OCVSMD_DAEMON_ENGINE_FEDERATION_ECHO_FILTER_HPP_INCLUDED
+#define OCVSMD_DAEMON_ENGINE_FEDERATION_ECHO_FILTER_HPP_INCLUDED
+
+#include <cetl/pf17/cetlpf.hpp>
+#include <libcyphal/transport/scattered_buffer.hpp>
+#include <libcyphal/types.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace ocvsmd
+{
+namespace daemon
+{
+namespace engine
+{
+namespace federation
+{
+
+/// Calculates 64-bit FNV-1a digest of a (potentially fragmented) message payload.
+///
+/// In use instead of an "origin tag" of a bridged message (which Cyphal messages don't have), so that
+/// the very same message coming back (echoed) from the other side could be recognized, and so not bridged again.
+///
+class PayloadDigest final : public libcyphal::transport::ScatteredBuffer::IFragmentsVisitor
+{
+public:
+    static std::uint64_t of(const libcyphal::transport::ScatteredBuffer& buffer)
+    {
+        PayloadDigest digest;
+        buffer.forEachFragment(digest);
+        return digest.value_;
+    }
+
+    static std::uint64_t of(const libcyphal::transport::PayloadFragment fragment)
+    {
+        PayloadDigest digest;
+        digest.onNext(fragment);
+        return digest.value_;
+    }
+
+private:
+    PayloadDigest() = default;
+
+    // IFragmentsVisitor
+
+    void onNext(const libcyphal::transport::PayloadFragment fragment) override
+    {
+        constexpr std::uint64_t Prime = 0x100000001B3ULL;
+
+        for (const auto byte : fragment)
+        {
+            value_ ^= static_cast<std::uint8_t>(byte);
+            value_ *= Prime;
+        }
+    }
+
+    std::uint64_t value_{0xCBF29CE484222325ULL};
+
+};  // PayloadDigest
+
+/// Remembers digests of recently bridged messages (in a fixed size ring),
+/// and recognizes their echoes arriving back within the given timeout.
+///
+/// Note that it's a heuristic - messages carry no origin tag, so an echo is recognized by its payload only.
+/// As a result, a genuinely new message from the other side, which happens to have exactly the same payload
+/// as a message just bridged towards that side, is dropped as well (once per the bridged message).
+///
+class EchoFilter final
+{
+public:
+    EchoFilter(const std::size_t capacity, const libcyphal::Duration timeout)
+        : timeout_{timeout}
+        , ring_(capacity)
+    {
+    }
+
+    /// Remembers the digest of a message which is about to be bridged to the other side.
+    ///
+    void remember(const std::uint64_t digest, const libcyphal::TimePoint now)
+    {
+        if (ring_.empty())
+        {
+            return;
+        }
+        ring_[next_] = {digest, now};
+        next_        = (next_ + 1) % ring_.size();
+    }
+
+    /// Checks whether the digest belongs to a recently remembered (and not yet expired) message.
+    ///
+    /// A matching entry is forgotten, so that the same digest is treated as an echo only once
+    /// per each bridged message - genuinely repeated messages (with the same payload) still pass.
+    ///
+    bool consume(const std::uint64_t digest, const libcyphal::TimePoint now)
+    {
+        for (auto& entry : ring_)
+        {
+            if (entry.timestamp && (entry.digest == digest) && ((now - *entry.timestamp) < timeout_))
+            {
+                entry.timestamp.reset();
+                return true;
+            }
+        }
+        return false;
+    }
+
+private:
+    struct Entry
+    {
+        std::uint64_t                        digest{0};
+        cetl::optional<libcyphal::TimePoint> timestamp;
+    };
+
+    const libcyphal::Duration timeout_;
+    std::vector<Entry>        ring_;
+    std::size_t               next_{0};
+
+};  // EchoFilter
+
+}  // namespace federation
+}  // namespace engine
+}  // namespace daemon
+}  // namespace ocvsmd
+
+#endif  // OCVSMD_DAEMON_ENGINE_FEDERATION_ECHO_FILTER_HPP_INCLUDED
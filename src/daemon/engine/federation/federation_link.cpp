@@ -0,0 +1,453 @@
+//
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "federation_link.hpp"
+
+#include "config.hpp"
+#include "echo_filter.hpp"
+#include "engine_helpers.hpp"
+#include "logging.hpp"
+
+#include <ocvsmd/sdk/daemon.hpp>
+#include <ocvsmd/sdk/defines.hpp>
+#include <ocvsmd/sdk/execution.hpp>
+#include <ocvsmd/sdk/node_pub_sub.hpp>
+
+#include <cetl/pf17/cetlpf.hpp>
+#include <libcyphal/executor.hpp>
+#include <libcyphal/presentation/presentation.hpp>
+#include <libcyphal/presentation/publisher.hpp>
+#include <libcyphal/presentation/subscriber.hpp>
+#include <libcyphal/transport/scattered_buffer.hpp>
+#include <libcyphal/transport/types.hpp>
+#include <libcyphal/types.hpp>
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace ocvsmd
+{
+namespace daemon
+{
+namespace engine
+{
+namespace federation
+{
+namespace
+{
+
+class FederationLinkImpl final : public FederationLink
+{
+public:
+    FederationLinkImpl(cetl::pmr::memory_resource& memory,
+                       libcyphal::IExecutor&       executor,
+                       const Config::Federation&   config,
+                       PeerFactory&&               peer_factory)
+        : memory_{memory}
+        , executor_{executor}
+        , peer_factory_{std::move(peer_factory)}
+        , peer_{config.peer}
+        , extent_{config.extent}
+        , queue_capacity_{config.queue_capacity}
+    {
+        timer_callback_ = executor_.registerCallback([this](const auto&) {
+            //
+            handleTimer();
+        });
+    }
+
+    ~FederationLinkImpl() override
+    {
+        for (const auto& bridge : bridges_)
+        {
+            logger_->debug("Federation '{}' subject {} stats (to_peer={}, from_peer={}, dropped={}, echoes={}).",
+                           peer_,
+                           bridge->subject_id,
+                           bridge->to_peer,
+                           bridge->from_peer,
+                           bridge->dropped,
+                           bridge->echoes);
+            resetPeerSide(*bridge);
+        }
+        peer_daemon_.reset();
+    }
+
+    FederationLinkImpl(const FederationLinkImpl&)                = delete;
+    FederationLinkImpl(FederationLinkImpl&&) noexcept            = delete;
+    FederationLinkImpl& operator=(const FederationLinkImpl&)     = delete;
+    FederationLinkImpl& operator=(FederationLinkImpl&&) noexcept = delete;
+
+    bool addSubject(libcyphal::presentation::Presentation& presentation, const Config::Pipeline::PortId subject_id)
+    {
+        using CyMakeFailure = libcyphal::presentation::Presentation::MakeFailure;
+
+        auto  bridge_ptr = std::make_unique<Bridge>(subject_id);
+        auto& bridge     = *bridge_ptr;
+
+        auto cy_pub_result = presentation.makePublisher<void>(subject_id);
+        if (const auto* const cy_failure = cetl::get_if<CyMakeFailure>(&cy_pub_result))
+        {
+            logger_->error("Federation '{}': failed to make publisher (subj_id={}, err={}).",
+                           peer_,
+                           subject_id,
+                           cyFailureToOptError(*cy_failure));
+            return false;
+        }
+        bridge.cy_publisher.emplace(cetl::get<CyRawPublisher>(std::move(cy_pub_result)));
+
+        auto cy_sub_result = presentation.makeSubscriber(  //
+            subject_id,
+            extent_,
+            [this, &bridge](const auto& arg) {
+                //
+                handleLocalMessage(bridge, arg.raw_message, arg.metadata);
+            });
+        if (const auto* const cy_failure = cetl::get_if<CyMakeFailure>(&cy_sub_result))
+        {
+            logger_->error("Federation '{}': failed to make subscriber (subj_id={}, err={}).",
+                           peer_,
+                           subject_id,
+                           cyFailureToOptError(*cy_failure));
+            return false;
+        }
+        bridge.cy_subscriber.emplace(cetl::get<CyRawSubscriber>(std::move(cy_sub_result)));
+
+        bridges_.push_back(std::move(bridge_ptr));
+        return true;
+    }
+
+    void start()
+    {
+        reconnect_deadline_ = executor_.now();
+        scheduleTimer(*reconnect_deadline_);
+    }
+
+private:
+    using CyRawPublisher  = libcyphal::presentation::Publisher<void>;
+    using CyRawSubscriber = libcyphal::presentation::Subscriber<void>;
+    using CyScatteredBuff = libcyphal::transport::ScatteredBuffer;
+    using CyMsgRxMetadata = libcyphal::transport::MessageRxMetadata;
+
+    static constexpr std::size_t EchoCapacity = 32;
+
+    struct Pending
+    {
+        sdk::OwnedMutablePayload payload;
+        sdk::CyphalPriority      priority;
+    };
+
+    struct Bridge
+    {
+        explicit Bridge(const Config::Pipeline::PortId subj_id)
+            : subject_id{subj_id}
+            , to_peer_echoes{EchoCapacity, std::chrono::seconds{1}}
+            , to_local_echoes{EchoCapacity, std::chrono::seconds{1}}
+        {
+        }
+
+        // NOLINTBEGIN(*-non-private-member-variables-in-classes)
+        const Config::Pipeline::PortId subject_id;
+
+        // Local side - live as long as the link.
+        cetl::optional<CyRawPublisher>  cy_publisher;
+        cetl::optional<CyRawSubscriber> cy_subscriber;
+
+        // Peer side - reset on every reconnect.
+        sdk::Publisher::Ptr                                     peer_publisher;
+        sdk::Subscriber::Ptr                                    peer_subscriber;
+        sdk::SenderOf<sdk::Daemon::MakePublisher::Result>::Ptr  make_pub_sender;
+        sdk::SenderOf<sdk::Daemon::MakeSubscriber::Result>::Ptr make_sub_sender;
+        sdk::SenderOf<sdk::Subscriber::RawReceive::Result>::Ptr receive_sender;
+        sdk::SenderOf<sdk::OptError>::Ptr                       publish_sender;
+        cetl::optional<sdk::CyphalPriority>                     peer_priority;
+        bool                                                    is_publishing{false};
+
+        std::deque<Pending> queue;
+        EchoFilter          to_peer_echoes;
+        EchoFilter          to_local_echoes;
+
+        std::uint64_t to_peer{0};
+        std::uint64_t from_peer{0};
+        std::uint64_t dropped{0};
+        std::uint64_t echoes{0};
+        // NOLINTEND(*-non-private-member-variables-in-classes)
+
+    };  // Bridge
+
+    void scheduleTimer(const libcyphal::TimePoint exec_time)
+    {
+        timer_callback_.schedule(libcyphal::IExecutor::Callback::Schedule::Once{exec_time});
+    }
+
+    void requestReconnect()
+    {
+        if (!reconnect_deadline_)
+        {
+            logger_->debug("Federation '{}': (re)connecting to peer in 1s.", peer_);
+
+            // Reconnect is deferred b/c we might be in the middle of a callback of the peer's SDK objects.
+            reconnect_deadline_ = executor_.now() + std::chrono::seconds{1};
+            scheduleTimer(*reconnect_deadline_);
+        }
+    }
+
+    void handleTimer()
+    {
+        if (reconnect_deadline_)
+        {
+            // The timer is also rescheduled to "now" (f.e. by a late completion of the previous peer's publish),
+            // so here the pending reconnect deadline is restored - otherwise the backoff would be defeated.
+            // There is nothing to pump either - the peer side is going to be reset anyway.
+            //
+            if (executor_.now() < *reconnect_deadline_)
+            {
+                scheduleTimer(*reconnect_deadline_);
+                return;
+            }
+            reconnect_deadline_.reset();
+            connect();
+        }
+        for (const auto& bridge : bridges_)
+        {
+            pumpToPeer(*bridge);
+        }
+    }
+
+    void connect()
+    {
+        for (const auto& bridge : bridges_)
+        {
+            resetPeerSide(*bridge);
+        }
+        peer_daemon_ = peer_factory_(memory_, executor_, peer_);
+        if (!peer_daemon_)
+        {
+            requestReconnect();
+            return;
+        }
+
+        for (const auto& bridge_ptr : bridges_)
+        {
+            auto& bridge = *bridge_ptr;
+
+            bridge.make_pub_sender = peer_daemon_->makePublisher(bridge.subject_id);
+            bridge.make_pub_sender->submit([this, &bridge](sdk::Daemon::MakePublisher::Result&& result) {
+                //
+                if (auto* const publisher = cetl::get_if<sdk::Daemon::MakePublisher::Success>(&result))
+                {
+                    bridge.peer_publisher = std::move(*publisher);
+                    scheduleTimer(executor_.now());
+                    return;
+                }
+                requestReconnect();
+            });
+
+            bridge.make_sub_sender = peer_daemon_->makeSubscriber(bridge.subject_id, extent_);
+            bridge.make_sub_sender->submit([this, &bridge](sdk::Daemon::MakeSubscriber::Result&& result) {
+                //
+                if (auto* const subscriber = cetl::get_if<sdk::Daemon::MakeSubscriber::Success>(&result))
+                {
+                    bridge.peer_subscriber = std::move(*subscriber);
+                    armPeerReceive(bridge);
+                    return;
+                }
+                requestReconnect();
+            });
+        }
+    }
+
+    /// Initiates reception of the next message from the peer subscriber.
+    ///
+    /// Has to be done right after each successful reception - otherwise following messages are missed.
+    ///
+    void armPeerReceive(Bridge& bridge)
+    {
+        bridge.receive_sender = bridge.peer_subscriber->rawReceive();
+        bridge.receive_sender->submit([this, &bridge](sdk::Subscriber::RawReceive::Result&& rx_result) {
+            //
+            handlePeerMessage(bridge, std::move(rx_result));
+        });
+    }
+
+    static void resetPeerSide(Bridge& bridge)
+    {
+        bridge.publish_sender.reset();
+        bridge.receive_sender.reset();
+        bridge.make_pub_sender.reset();
+        bridge.make_sub_sender.reset();
+        bridge.peer_publisher.reset();
+        bridge.peer_subscriber.reset();
+        bridge.peer_priority.reset();
+        bridge.is_publishing = false;
+    }
+
+    void handleLocalMessage(Bridge& bridge, const CyScatteredBuff& raw_msg_buff, const CyMsgRxMetadata& metadata)
+    {
+        const auto now = executor_.now();
+        if (bridge.to_local_echoes.consume(PayloadDigest::of(raw_msg_buff), now))
+        {
+            ++bridge.echoes;
+            return;
+        }
+
+        // The message has to be copied b/c it's queued (and then sent asynchronously).
+        //
+        const auto size = raw_msg_buff.size();
+        // NOLINTNEXTLINE(*-avoid-c-arrays)
+        sdk::OwnedMutablePayload payload{size, std::make_unique<cetl::byte[]>(size)};
+        (void) raw_msg_buff.copy(0, payload.data.get(), size);
+
+        if (bridge.queue.size() >= queue_capacity_)
+        {
+            // Drop the oldest - the freshest data is the most valuable one for the peer.
+            bridge.queue.pop_front();
+            ++bridge.dropped;
+        }
+        if (queue_capacity_ > 0)
+        {
+            const auto priority = static_cast<sdk::CyphalPriority>(metadata.rx_meta.base.priority);
+            bridge.queue.push_back({std::move(payload), priority});
+        }
+
+        pumpToPeer(bridge);
+    }
+
+    void pumpToPeer(Bridge& bridge)
+    {
+        constexpr auto PeerTxTimeout = std::chrono::seconds{1};
+
+        if (bridge.is_publishing || !bridge.peer_publisher || bridge.queue.empty() || reconnect_deadline_)
+        {
+            return;
+        }
+
+        // The pending message stays queued until its publishing is submitted -
+        // so that it's not lost if the peer publisher fails (and so has to be reconnected) before that.
+        //
+        auto& pending = bridge.queue.front();
+        if (bridge.peer_priority != pending.priority)
+        {
+            if (const auto opt_error = bridge.peer_publisher->setPriority(pending.priority))
+            {
+                requestReconnect();
+                return;
+            }
+            bridge.peer_priority = pending.priority;
+        }
+
+        const libcyphal::transport::PayloadFragment fragment{pending.payload.data.get(), pending.payload.size};
+        bridge.to_peer_echoes.remember(PayloadDigest::of(fragment), executor_.now());
+
+        bridge.is_publishing  = true;
+        bridge.publish_sender = bridge.peer_publisher->rawPublish(std::move(pending.payload), PeerTxTimeout);
+        bridge.publish_sender->submit([this, &bridge](const sdk::OptError opt_error) {
+            //
+            bridge.is_publishing = false;
+            if (opt_error)
+            {
+                logger_->debug("Federation '{}': failed to publish to peer (subj_id={}, err={}).",
+                               peer_,
+                               bridge.subject_id,
+                               *opt_error);
+                requestReconnect();
+                return;
+            }
+            ++bridge.to_peer;
+
+            // Next pending message is sent from the timer callback - not from within this sender's callback.
+            scheduleTimer(executor_.now());
+        });
+        bridge.queue.pop_front();
+    }
+
+    void handlePeerMessage(Bridge& bridge, sdk::Subscriber::RawReceive::Result&& rx_result)
+    {
+        constexpr auto LocalTxTimeout = std::chrono::milliseconds{100};
+
+        if (cetl::get_if<sdk::Subscriber::RawReceive::Failure>(&rx_result) != nullptr)
+        {
+            requestReconnect();
+            return;
+        }
+        // The message is moved out first b/c re-arming destroys the completed receive operation
+        // (which has delivered this result).
+        //
+        const auto rx_msg = cetl::get<sdk::Subscriber::RawReceive::Success>(std::move(rx_result));
+        armPeerReceive(bridge);
+
+        const auto                                  now = executor_.now();
+        const libcyphal::transport::PayloadFragment fragment{rx_msg.payload.data.get(), rx_msg.payload.size};
+        const auto                                  digest = PayloadDigest::of(fragment);
+        if (bridge.to_peer_echoes.consume(digest, now))
+        {
+            ++bridge.echoes;
+            return;
+        }
+        bridge.to_local_echoes.remember(digest, now);
+
+        const std::array<libcyphal::transport::PayloadFragment, 1> fragments{{fragment}};
+        bridge.cy_publisher->setPriority(static_cast<libcyphal::transport::Priority>(rx_msg.priority));
+        if (const auto cy_failure = bridge.cy_publisher->publish(now + LocalTxTimeout, fragments))
+        {
+            OCVSMD_LOG_RATE_LIMITED(*logger_,
+                                    spdlog::level::debug,
+                                    "Federation '{}': failed to publish locally (subj_id={}, err={}).",
+                                    peer_,
+                                    bridge.subject_id,
+                                    cyFailureToOptError(*cy_failure));
+            return;
+        }
+        ++bridge.from_peer;
+    }
+
+    cetl::pmr::memory_resource&          memory_;
+    libcyphal::IExecutor&                executor_;
+    const PeerFactory                    peer_factory_;
+    const std::string                    peer_;
+    const std::size_t                    extent_;
+    const std::size_t                    queue_capacity_;
+    common::LoggerPtr                    logger_{common::getLogger("engine")};
+    std::vector<std::unique_ptr<Bridge>> bridges_;
+    sdk::Daemon::Ptr                     peer_daemon_;
+    cetl::optional<libcyphal::TimePoint> reconnect_deadline_;
+    libcyphal::IExecutor::Callback::Any  timer_callback_;
+
+};  // FederationLinkImpl
+
+}  // namespace
+
+FederationLink::Ptr FederationLink::make(cetl::pmr::memory_resource&            memory,
+                                         libcyphal::IExecutor&                  executor,
+                                         libcyphal::presentation::Presentation& presentation,
+                                         const Config::Federation&              config,
+                                         PeerFactory                            peer_factory)
+{
+    const auto logger = common::getLogger("engine");
+
+    auto link = std::make_unique<FederationLinkImpl>(memory, executor, config, std::move(peer_factory));
+    for (const auto subject_id : config.subjects)
+    {
+        if (!link->addSubject(presentation, subject_id))
+        {
+            return nullptr;
+        }
+    }
+    link->start();
+
+    logger->info("Federation with '{}' is up (subjects={}).", config.peer, config.subjects.size());
+    return link;
+}
+
+}  // namespace federation
+}  // namespace engine
+}  // namespace daemon
+}  // namespace ocvsmd
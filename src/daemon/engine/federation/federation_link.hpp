@@ -0,0 +1,82 @@
+//
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#ifndef OCVSMD_DAEMON_ENGINE_FEDERATION_FEDERATION_LINK_HPP_INCLUDED
+#define OCVSMD_DAEMON_ENGINE_FEDERATION_FEDERATION_LINK_HPP_INCLUDED
+
+#include "config.hpp"
+
+#include <ocvsmd/sdk/daemon.hpp>
+
+#include <cetl/cetl.hpp>
+#include <cetl/pf17/cetlpf.hpp>
+#include <libcyphal/executor.hpp>
+#include <libcyphal/presentation/presentation.hpp>
+
+#include <functional>
+#include <memory>
+#include <string>
+
+namespace ocvsmd
+{
+namespace daemon
+{
+namespace engine
+{
+namespace federation
+{
+
+/// @brief Defines a link which mirrors subjects between this daemon and a peer daemon.
+///
+/// The link connects (as an ordinary SDK client) to IPC endpoint of the peer daemon,
+/// and bridges each configured subject both ways:
+/// - local Cyphal messages are queued (bounded, the oldest is dropped on overflow),
+///   and then published one by one on the peer side via its 'Relay: Raw Publisher' service;
+/// - messages received via peer's 'Relay: Raw Subscriber' service are published locally.
+///
+/// Digests of bridged messages are remembered for a short time, so that their echoes
+/// (f.e. own publications looped back by a transport) are not bridged back again.
+/// The link reconnects to the peer periodically until it succeeds (and also after any failure).
+///
+class FederationLink
+{
+public:
+    using Ptr = std::unique_ptr<FederationLink>;
+
+    /// Defines factory of (SDK client) connections to the peer daemon.
+    ///
+    using PeerFactory = std::function<sdk::Daemon::Ptr(cetl::pmr::memory_resource& memory,
+                                                       libcyphal::IExecutor&       executor,
+                                                       const std::string&          connection)>;
+
+    /// Makes a new link according to its configuration.
+    ///
+    /// @param peer_factory Makes connections to the peer daemon - `sdk::Daemon::make` by default.
+    /// @return `nullptr` if local Cyphal ports can't be made. Unavailability of the peer is not a failure.
+    ///
+    CETL_NODISCARD static Ptr make(cetl::pmr::memory_resource&            memory,
+                                   libcyphal::IExecutor&                  executor,
+                                   libcyphal::presentation::Presentation& presentation,
+                                   const Config::Federation&              config,
+                                   PeerFactory                            peer_factory = sdk::Daemon::make);
+
+    FederationLink(const FederationLink&)                = delete;
+    FederationLink(FederationLink&&) noexcept            = delete;
+    FederationLink& operator=(const FederationLink&)     = delete;
+    FederationLink& operator=(FederationLink&&) noexcept = delete;
+
+    virtual ~FederationLink() = default;
+
+protected:
+    FederationLink() = default;
+
+};  // FederationLink
+
+}  // namespace federation
+}  // namespace engine
+}  // namespace daemon
+}  // namespace ocvsmd
+
+#endif  // OCVSMD_DAEMON_ENGINE_FEDERATION_FEDERATION_LINK_HPP_INCLUDED
@@ -0,0 +1,280 @@
+//
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "pipeline.hpp"
+
+#include "config.hpp"
+#include "engine_helpers.hpp"
+#include "logging.hpp"
+#include "stages.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+#include <libcyphal/executor.hpp>
+#include <libcyphal/presentation/presentation.hpp>
+#include <libcyphal/presentation/publisher.hpp>
+#include <libcyphal/presentation/subscriber.hpp>
+#include <libcyphal/transport/scattered_buffer.hpp>
+#include <libcyphal/transport/types.hpp>
+#include <libcyphal/types.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace ocvsmd
+{
+namespace daemon
+{
+namespace engine
+{
+namespace pipeline
+{
+namespace
+{
+
+class PipelineImpl final : public Pipeline, libcyphal::transport::ScatteredBuffer::IFragmentsVisitor
+{
+public:
+    using CyRawPublisher  = libcyphal::presentation::Publisher<void>;
+    using CyRawSubscriber = libcyphal::presentation::Subscriber<void>;
+
+    PipelineImpl(libcyphal::IExecutor&    executor,
+                 std::string              name,
+                 std::vector<IStage::Ptr> stages,
+                 CyRawPublisher&&         cy_publisher)
+        : executor_{executor}
+        , name_{std::move(name)}
+        , stages_{std::move(stages)}
+        , cy_publisher_{std::move(cy_publisher)}
+    {
+    }
+
+    ~PipelineImpl() override
+    {
+        logger_->debug("Pipeline '{}' is destroyed (forwarded={}, dropped={}, failed={}).",
+                       name_,
+                       forwarded_,
+                       dropped_,
+                       failed_);
+    }
+
+    PipelineImpl(const PipelineImpl&)                = delete;
+    PipelineImpl(PipelineImpl&&) noexcept            = delete;
+    PipelineImpl& operator=(const PipelineImpl&)     = delete;
+    PipelineImpl& operator=(PipelineImpl&&) noexcept = delete;
+
+    bool addSource(libcyphal::presentation::Presentation& presentation,
+                   const Config::Pipeline::PortId         subject_id,
+                   const std::size_t                      extent_bytes)
+    {
+        using CyMakeFailure = libcyphal::presentation::Presentation::MakeFailure;
+
+        auto cy_make_result = presentation.makeSubscriber(  //
+            subject_id,
+            extent_bytes,
+            [this, subject_id](const auto& arg) {
+                //
+                handleNodeMessage(subject_id, arg.raw_message, arg.metadata);
+            });
+        if (const auto* const cy_failure = cetl::get_if<CyMakeFailure>(&cy_make_result))
+        {
+            logger_->error("Pipeline '{}': failed to make subscriber (subj_id={}, err={}).",
+                           name_,
+                           subject_id,
+                           cyFailureToOptError(*cy_failure));
+            return false;
+        }
+
+        cy_subscribers_.push_back(cetl::get<CyRawSubscriber>(std::move(cy_make_result)));
+        return true;
+    }
+
+private:
+    using CyScatteredBuff   = libcyphal::transport::ScatteredBuffer;
+    using CyMsgRxMetadata   = libcyphal::transport::MessageRxMetadata;
+    using CyPayloadFragment = libcyphal::transport::PayloadFragment;
+
+    // 64-bit FNV-1a parameters of the payload digest.
+    static constexpr std::uint64_t FnvOffsetBasis = 0xCBF29CE484222325ULL;
+    static constexpr std::uint64_t FnvPrime       = 0x100000001B3ULL;
+
+    void handleNodeMessage(const libcyphal::transport::PortId subject_id,
+                           const CyScatteredBuff&             raw_msg_buff,
+                           const CyMsgRxMetadata&             metadata)
+    {
+        // Collect received fragments (to be republished as is - no payload copying),
+        // and calculate the payload digest (for the stages) in the same pass.
+        // Note that `fragments_` capacity is reused across messages, so normally there is no allocation here.
+        //
+        fragments_.clear();
+        payload_digest_ = FnvOffsetBasis;
+        raw_msg_buff.forEachFragment(*this);
+
+        Message message{subject_id,
+                        metadata.rx_meta.timestamp,
+                        metadata.rx_meta.base.priority,
+                        metadata.rx_meta.base.transfer_id,
+                        metadata.publisher_node_id,
+                        payload_digest_};
+        for (const auto& stage : stages_)
+        {
+            if (!stage->process(message))
+            {
+                ++dropped_;
+                return;
+            }
+        }
+
+        constexpr auto TxTimeout = std::chrono::milliseconds{100};
+
+        cy_publisher_.setPriority(message.priority);
+        const auto deadline = executor_.now() + TxTimeout;
+        if (const auto cy_failure = cy_publisher_.publish(deadline, {fragments_.data(), fragments_.size()}))
+        {
+            ++failed_;
+            OCVSMD_LOG_RATE_LIMITED(*logger_,
+                                    spdlog::level::warn,
+                                    "Pipeline '{}': failed to publish message (err={}).",
+                                    name_,
+                                    cyFailureToOptError(*cy_failure));
+            return;
+        }
+        ++forwarded_;
+    }
+
+    // IFragmentsVisitor
+
+    void onNext(const CyPayloadFragment fragment) override
+    {
+        if ((fragment.data() != nullptr) && !fragment.empty())
+        {
+            fragments_.push_back(fragment);
+
+            for (const auto byte : fragment)
+            {
+                payload_digest_ ^= static_cast<std::uint8_t>(byte);
+                payload_digest_ *= FnvPrime;
+            }
+        }
+    }
+
+    libcyphal::IExecutor&          executor_;
+    const std::string              name_;
+    std::vector<IStage::Ptr>       stages_;
+    CyRawPublisher                 cy_publisher_;
+    std::vector<CyRawSubscriber>   cy_subscribers_;
+    std::vector<CyPayloadFragment> fragments_;
+    std::uint64_t                  payload_digest_{FnvOffsetBasis};
+    std::uint64_t                  forwarded_{0};
+    std::uint64_t                  dropped_{0};
+    std::uint64_t                  failed_{0};
+    common::LoggerPtr              logger_{common::getLogger("engine")};
+
+};  // PipelineImpl
+
+IStage::Ptr makeStage(const Config::Pipeline::Stage& stage_cfg)
+{
+    if (stage_cfg.type == "node_filter")
+    {
+        return std::make_unique<NodeFilterStage>(stage_cfg.node_ids);
+    }
+    if (stage_cfg.type == "rate_limit")
+    {
+        if (stage_cfg.max_rate_hz <= 0.0)
+        {
+            return nullptr;
+        }
+        const std::chrono::duration<double> min_interval{1.0 / stage_cfg.max_rate_hz};
+        return std::make_unique<RateLimitStage>(std::chrono::duration_cast<libcyphal::Duration>(min_interval));
+    }
+    if (stage_cfg.type == "dedup")
+    {
+        return std::make_unique<DedupStage>(std::chrono::milliseconds{stage_cfg.timeout_ms});
+    }
+    if (stage_cfg.type == "priority")
+    {
+        constexpr std::uint8_t MaxPriority = 7;
+        if (stage_cfg.priority > MaxPriority)
+        {
+            return nullptr;
+        }
+        return std::make_unique<PriorityStage>(static_cast<libcyphal::transport::Priority>(stage_cfg.priority));
+    }
+    return nullptr;
+}
+
+}  // namespace
+
+Pipeline::Ptr Pipeline::make(libcyphal::IExecutor&                  executor,
+                             libcyphal::presentation::Presentation& presentation,
+                             const Config::Pipeline&                config)
+{
+    using CyMakeFailure = libcyphal::presentation::Presentation::MakeFailure;
+
+    const auto logger = common::getLogger("engine");
+
+    if (config.sources.empty())
+    {
+        logger->error("Pipeline '{}' has no sources.", config.name);
+        return nullptr;
+    }
+    if (std::find(config.sources.begin(), config.sources.end(), config.target) != config.sources.end())
+    {
+        // Republishing to one of the sources would loop messages back into the pipeline.
+        logger->error("Pipeline '{}' target subject {} is also its source.", config.name, config.target);
+        return nullptr;
+    }
+
+    std::vector<IStage::Ptr> stages;
+    stages.reserve(config.stages.size());
+    for (const auto& stage_cfg : config.stages)
+    {
+        auto stage = makeStage(stage_cfg);
+        if (!stage)
+        {
+            logger->error("Pipeline '{}' has invalid stage (type='{}').", config.name, stage_cfg.type);
+            return nullptr;
+        }
+        stages.push_back(std::move(stage));
+    }
+
+    auto cy_make_result = presentation.makePublisher<void>(config.target);
+    if (const auto* const cy_failure = cetl::get_if<CyMakeFailure>(&cy_make_result))
+    {
+        logger->error("Pipeline '{}': failed to make publisher (subj_id={}, err={}).",
+                      config.name,
+                      config.target,
+                      cyFailureToOptError(*cy_failure));
+        return nullptr;
+    }
+
+    auto cy_publisher = cetl::get<PipelineImpl::CyRawPublisher>(std::move(cy_make_result));
+    auto pipeline =
+        std::make_unique<PipelineImpl>(executor, config.name, std::move(stages), std::move(cy_publisher));
+    for (const auto subject_id : config.sources)
+    {
+        if (!pipeline->addSource(presentation, subject_id, config.extent))
+        {
+            return nullptr;
+        }
+    }
+
+    logger->info("Pipeline '{}' is up (sources={}, target={}, stages={}).",
+                 config.name,
+                 config.sources.size(),
+                 config.target,
+                 config.stages.size());
+    return pipeline;
+}
+
+}  // namespace pipeline
+}  // namespace engine
+}  // namespace daemon
+}  // namespace ocvsmd
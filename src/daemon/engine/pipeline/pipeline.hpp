@@ -0,0 +1,63 @@
+//
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#ifndef OCVSMD_DAEMON_ENGINE_PIPELINE_PIPELINE_HPP_INCLUDED
+#define OCVSMD_DAEMON_ENGINE_PIPELINE_PIPELINE_HPP_INCLUDED
+
+#include "config.hpp"
+
+#include <cetl/cetl.hpp>
+#include <cetl/pf17/cetlpf.hpp>
+#include <libcyphal/executor.hpp>
+#include <libcyphal/presentation/presentation.hpp>
+
+#include <memory>
+
+namespace ocvsmd
+{
+namespace daemon
+{
+namespace engine
+{
+namespace pipeline
+{
+
+/// @brief Defines in-process 'subscribe → stages → republish' pipeline.
+///
+/// A pipeline subscribes (as raw messages) to one or more source subjects (so merging them),
+/// passes every received message through its chain of stages (see `stages.hpp`),
+/// and then republishes the survived messages (as is, without payload copying) to the target subject.
+///
+class Pipeline
+{
+public:
+    using Ptr = std::unique_ptr<Pipeline>;
+
+    /// Makes a new pipeline according to its configuration.
+    ///
+    /// @return `nullptr` if configuration is invalid, or if any of Cyphal ports can't be made.
+    ///
+    CETL_NODISCARD static Ptr make(libcyphal::IExecutor&                  executor,
+                                   libcyphal::presentation::Presentation& presentation,
+                                   const Config::Pipeline&                config);
+
+    Pipeline(const Pipeline&)                = delete;
+    Pipeline(Pipeline&&) noexcept            = delete;
+    Pipeline& operator=(const Pipeline&)     = delete;
+    Pipeline& operator=(Pipeline&&) noexcept = delete;
+
+    virtual ~Pipeline() = default;
+
+protected:
+    Pipeline() = default;
+
+};  // Pipeline
+
+}  // namespace pipeline
+}  // namespace engine
+}  // namespace daemon
+}  // namespace ocvsmd
+
+#endif  // OCVSMD_DAEMON_ENGINE_PIPELINE_PIPELINE_HPP_INCLUDED
@@ -0,0 +1,212 @@
+//
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#ifndef OCVSMD_DAEMON_ENGINE_PIPELINE_STAGES_HPP_INCLUDED
+#define OCVSMD_DAEMON_ENGINE_PIPELINE_STAGES_HPP_INCLUDED
+
+#include <cetl/pf17/cetlpf.hpp>
+#include <libcyphal/transport/types.hpp>
+#include <libcyphal/types.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace ocvsmd
+{
+namespace daemon
+{
+namespace engine
+{
+namespace pipeline
+{
+
+/// Defines metadata of a message flowing through a pipeline.
+///
+/// Stages make their decisions based on this metadata only - the message payload itself is never copied,
+/// and it's forwarded to the target publisher as is (as a list of received fragments).
+///
+struct Message
+{
+    libcyphal::transport::PortId                 subject_id;  ///< The source subject.
+    libcyphal::TimePoint                         timestamp;
+    libcyphal::transport::Priority               priority;
+    libcyphal::transport::TransferId             transfer_id;
+    cetl::optional<libcyphal::transport::NodeId> publisher_node_id;
+    std::uint64_t                                payload_digest;  ///< 64-bit FNV-1a of the payload bytes.
+
+};  // Message
+
+/// Defines interface of a single pipeline stage.
+///
+class IStage
+{
+public:
+    using Ptr = std::unique_ptr<IStage>;
+
+    IStage(const IStage&)                = delete;
+    IStage(IStage&&) noexcept            = delete;
+    IStage& operator=(const IStage&)     = delete;
+    IStage& operator=(IStage&&) noexcept = delete;
+
+    virtual ~IStage() = default;
+
+    /// Processes (and potentially modifies) the message.
+    ///
+    /// @return `false` if the message should be dropped (so no further stages are applied).
+    ///
+    virtual bool process(Message& message) = 0;
+
+protected:
+    IStage() = default;
+
+};  // IStage
+
+/// Passes only messages published by one of the given nodes. Anonymous messages are dropped.
+///
+class NodeFilterStage final : public IStage
+{
+public:
+    explicit NodeFilterStage(std::vector<libcyphal::transport::NodeId> node_ids)
+        : node_ids_{std::move(node_ids)}
+    {
+        std::sort(node_ids_.begin(), node_ids_.end());
+    }
+
+    bool process(Message& message) override
+    {
+        return message.publisher_node_id.has_value() &&
+               std::binary_search(node_ids_.begin(), node_ids_.end(), *message.publisher_node_id);
+    }
+
+private:
+    std::vector<libcyphal::transport::NodeId> node_ids_;
+
+};  // NodeFilterStage
+
+/// Passes at most one message per the given minimal interval (measured by message reception timestamps).
+///
+class RateLimitStage final : public IStage
+{
+public:
+    explicit RateLimitStage(const libcyphal::Duration min_interval)
+        : min_interval_{min_interval}
+    {
+    }
+
+    bool process(Message& message) override
+    {
+        if (last_passed_ && ((message.timestamp - *last_passed_) < min_interval_))
+        {
+            return false;
+        }
+        last_passed_ = message.timestamp;
+        return true;
+    }
+
+private:
+    const libcyphal::Duration            min_interval_;
+    cetl::optional<libcyphal::TimePoint> last_passed_;
+
+};  // RateLimitStage
+
+/// Drops copies of a message which reach the pipeline more than once - via the same or another source subject.
+///
+/// In use when a pipeline merges redundant sources (f.e. the original subject and its bridged or federated
+/// mirror), so that only the first copy passes. Exact repeats of a transfer on the same subject are already
+/// dropped by libcyphal sessions, so copies are recognized by their content instead - by (publisher node,
+/// payload digest) pair seen within the given timeout. Transfer-IDs can't be used here b/c they are counted
+/// per subject, and a republishing node assigns its own ones. Anonymous messages are keyed by payload only.
+///
+/// Note that it's a content based heuristic - a node publishing the very same payload again within
+/// the timeout (f.e. an unchanged status) is dropped as well, so the timeout should be shorter than
+/// the publishing period of the source subjects.
+///
+class DedupStage final : public IStage
+{
+public:
+    explicit DedupStage(const libcyphal::Duration timeout)
+        : timeout_{timeout}
+    {
+    }
+
+    bool process(Message& message) override
+    {
+        forgetExpired(message.timestamp);
+
+        // Anonymous messages use out of range node-ID, so they never match messages of a real node.
+        constexpr std::uint64_t AnonymousNodeId = 0xFFFFU + 1U;
+        const std::uint64_t     node_id = message.publisher_node_id ? *message.publisher_node_id : AnonymousNodeId;
+
+        // Node-ID is mixed into the digest as one more FNV-1a round - collisions are as unlikely as for payloads.
+        constexpr std::uint64_t Prime = 0x100000001B3ULL;
+        const auto              key   = (message.payload_digest ^ node_id) * Prime;
+
+        const auto result = key_to_seen_at_.emplace(key, message.timestamp);
+        if (!result.second)
+        {
+            if ((message.timestamp - result.first->second) < timeout_)
+            {
+                return false;
+            }
+            result.first->second = message.timestamp;
+        }
+        return true;
+    }
+
+private:
+    /// Forgets all expired keys - but at most once per timeout, so that the cost is amortized across messages.
+    ///
+    void forgetExpired(const libcyphal::TimePoint now)
+    {
+        if (last_cleanup_ && ((now - *last_cleanup_) < timeout_))
+        {
+            return;
+        }
+        last_cleanup_ = now;
+
+        for (auto it = key_to_seen_at_.begin(); it != key_to_seen_at_.end();)
+        {
+            it = ((now - it->second) >= timeout_) ? key_to_seen_at_.erase(it) : std::next(it);
+        }
+    }
+
+    const libcyphal::Duration                               timeout_;
+    cetl::optional<libcyphal::TimePoint>                    last_cleanup_;
+    std::unordered_map<std::uint64_t, libcyphal::TimePoint> key_to_seen_at_;
+
+};  // DedupStage
+
+/// Rewrites priority of messages.
+///
+class PriorityStage final : public IStage
+{
+public:
+    explicit PriorityStage(const libcyphal::transport::Priority priority)
+        : priority_{priority}
+    {
+    }
+
+    bool process(Message& message) override
+    {
+        message.priority = priority_;
+        return true;
+    }
+
+private:
+    const libcyphal::transport::Priority priority_;
+
+};  // PriorityStage
+
+}  // namespace pipeline
+}  // namespace engine
+}  // namespace daemon
+}  // namespace ocvsmd
+
+#endif  // OCVSMD_DAEMON_ENGINE_PIPELINE_STAGES_HPP_INCLUDED
@@ -0,0 +1,102 @@
+//
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#ifndef OCVSMD_DAEMON_ENGINE_PLATFORM_BUSY_POLL_BACKOFF_HPP_INCLUDED
+#define OCVSMD_DAEMON_ENGINE_PLATFORM_BUSY_POLL_BACKOFF_HPP_INCLUDED
+
+#include <cetl/pf17/cetlpf.hpp>
+#include <libcyphal/types.hpp>
+
+#include <cstdint>
+#include <thread>
+
+namespace ocvsmd
+{
+namespace daemon
+{
+namespace engine
+{
+namespace platform
+{
+
+/// Defines backoff of the engine loop in the busy-poll run mode.
+///
+/// Instead of blocking in the polling of awaitable resources, the loop polls them with zero timeout
+/// (so it burns a core, but reacts to I/O immediately). Once the polls become idle, the loop backs off
+/// in phases: it keeps spinning for `spin_for` of idle time, then yields the core (still polling with zero timeout)
+/// for `yield_for` more, and then blocks (as in the default run mode) until the next productive poll.
+///
+class BusyPollBackoff final
+{
+public:
+    enum class Phase : std::uint8_t
+    {
+        Spin,
+        Yield,
+        Block,
+    };
+
+    BusyPollBackoff(const libcyphal::Duration spin_for, const libcyphal::Duration yield_for) noexcept
+        : spin_for_{spin_for}
+        , yield_for_{yield_for}
+    {
+    }
+
+    Phase phase() const noexcept
+    {
+        return phase_;
+    }
+
+    /// Applies the backoff before the next poll of awaitable resources.
+    ///
+    /// @param ready_count Total number of awaitables made ready so far (see `readyAwaitablesCount` of executors) -
+    ///                    any change since the previous call means that the previous poll was productive.
+    /// @param now Current time.
+    /// @param timeout The blocking timeout (until the next scheduled callback, if any).
+    /// @return Zero timeout while spinning (or yielding), or the given one when blocking.
+    ///
+    cetl::optional<libcyphal::Duration> apply(const std::uint64_t                       ready_count,
+                                              const libcyphal::TimePoint                now,
+                                              const cetl::optional<libcyphal::Duration> timeout)
+    {
+        // The very first call starts the idle time too.
+        if ((ready_count != last_ready_count_) || !idle_since_)
+        {
+            last_ready_count_ = ready_count;
+            idle_since_       = now;
+        }
+
+        const auto idle_for = now - *idle_since_;
+        phase_              = (idle_for < spin_for_)                ? Phase::Spin
+                              : (idle_for < spin_for_ + yield_for_) ? Phase::Yield
+                                                                    : Phase::Block;
+        switch (phase_)
+        {
+        case Phase::Spin:
+            return libcyphal::Duration::zero();
+        case Phase::Yield:
+            std::this_thread::yield();
+            return libcyphal::Duration::zero();
+        case Phase::Block:
+        default:
+            return timeout;
+        }
+    }
+
+private:
+    const libcyphal::Duration            spin_for_;
+    const libcyphal::Duration            yield_for_;
+    Phase                                phase_{Phase::Spin};
+    std::uint64_t                        last_ready_count_{0};
+    cetl::optional<libcyphal::TimePoint> idle_since_;
+
+};  // BusyPollBackoff
+
+}  // namespace platform
+}  // namespace engine
+}  // namespace daemon
+}  // namespace ocvsmd
+
+#endif  // OCVSMD_DAEMON_ENGINE_PLATFORM_BUSY_POLL_BACKOFF_HPP_INCLUDED
@@ -6,8 +6,13 @@
 #ifndef OCVSMD_DAEMON_ENGINE_PLATFORM_CAN_MEDIA_HPP_INCLUDED
 #define OCVSMD_DAEMON_ENGINE_PLATFORM_CAN_MEDIA_HPP_INCLUDED
 
+#include "logging.hpp"
+#include "ocvsmd/platform/executor_profiler.hpp"
 #include "ocvsmd/platform/posix_executor_extension.hpp"
 #include "ocvsmd/platform/posix_platform_error.hpp"
+#include "platform/kernel_timestamp.hpp"
+#include "platform/media_health.hpp"
+#include "platform/socket_stats.hpp"
 #include "socketcan.h"
 
 #include <canard.h>
@@ -23,8 +28,11 @@
 
 #include <algorithm>
 #include <array>
+#include <cerrno>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <iterator>
 #include <string>
 #include <unistd.h>
@@ -42,18 +50,86 @@ namespace platform
 namespace can
 {
 
+/// Defines parsed SocketCAN interface address.
+///
+/// The address is a device name optionally followed by `?`-separated query of `&`-separated parameters.
+/// Currently supported parameters:
+/// - `fd=1` - enables CAN FD frames (up to 64 bytes of payload);
+/// - `rcvbuf=<bytes>` and `sndbuf=<bytes>` - kernel buffer sizes of the sockets (see `SocketBufferSizes`).
+///
+struct CanIfaceAddress
+{
+    std::string       name;
+    bool              is_fd{false};
+    SocketBufferSizes buffer_sizes;
+
+    static CanIfaceAddress parse(const cetl::string_view address)
+    {
+        const auto query_pos = address.find('?');
+
+        CanIfaceAddress result{};
+        const auto      name = address.substr(0, query_pos);
+        result.name          = std::string{name.data(), name.size()};
+        if (query_pos == cetl::string_view::npos)
+        {
+            return result;
+        }
+
+        auto query = address.substr(query_pos + 1);
+        while (!query.empty())
+        {
+            const auto next  = query.find('&');
+            const auto param = query.substr(0, next);
+            if ((param == cetl::string_view{"fd=1"}) || (param == cetl::string_view{"fd=true"}))
+            {
+                result.is_fd = true;
+            }
+            else if ((param == cetl::string_view{"fd=0"}) || (param == cetl::string_view{"fd=false"}))
+            {
+                result.is_fd = false;
+            }
+            else if (!param.empty() && !result.buffer_sizes.parseParam(param))
+            {
+                common::getLogger("io")->warn("Unknown SocketCAN interface parameter '{}' is ignored (iface='{}').",
+                                              std::string{param.data(), param.size()},
+                                              result.name);
+            }
+            query = (next == cetl::string_view::npos) ? cetl::string_view{} : query.substr(next + 1);
+        }
+        return result;
+    }
+
+};  // CanIfaceAddress
+
+// MARK: -
+
+/// Defines SocketCAN media.
+///
+/// Received frames are read in batches (see `socketcanPopBatch`) - all readable frames are drained per wakeup.
+/// Frames to transmit are staged (copied) by `push`, and then written in batches (see `socketcanPushBatch`)
+/// from a deferred callback - normally, within the same executor spin. Staged frames are kept ordered by CAN ID
+/// (i.e. by priority, like the bus arbitration does), so a frame staged while the socket is not ready doesn't delay
+/// a higher priority one pushed later.
+///
+/// Health of the interface is tracked (see `MediaHealth`). Once it's down (f.e. the link is down, or the device
+/// is removed), frames to transmit are skipped (so that libcyphal doesn't wait for it, and redundant interfaces
+/// carry the traffic), and the interface is periodically reopened (with backoff) until it's up again.
+///
 class CanMedia final : public libcyphal::transport::can::IMedia
 {
 public:
+    /// Makes a new media for the given SocketCAN interface address (see `CanIfaceAddress`).
+    ///
     CETL_NODISCARD static cetl::variant<CanMedia, libcyphal::transport::PlatformError> make(
         cetl::pmr::memory_resource& general_mr,
         libcyphal::IExecutor&       executor,
         const cetl::string_view     iface_address_sv,
-        cetl::pmr::memory_resource& tx_mr)
+        cetl::pmr::memory_resource& tx_mr,
+        const bool                  kernel_timestamps)
     {
-        const std::string iface_address{iface_address_sv.data(), iface_address_sv.size()};
+        auto iface_address = CanIfaceAddress::parse(iface_address_sv);
 
-        const SocketCANFD socket_can_rx_fd = ::socketcanOpen(iface_address.c_str(), false);
+        const SocketCANFD socket_can_rx_fd = ::socketcanOpen(iface_address.name.c_str(), iface_address.is_fd);
         if (socket_can_rx_fd < 0)
         {
             return libcyphal::transport::PlatformError{ocvsmd::platform::PosixPlatformError{-socket_can_rx_fd}};
@@ -62,7 +138,7 @@ public:
         // We gonna register separate callbacks for rx & tx (aka pop & push),
         // so at executor (especially in case of the "epoll" one) we need separate file descriptors.
         //
-        const SocketCANFD socket_can_tx_fd = ::socketcanOpen(iface_address.c_str(), false);
+        const SocketCANFD socket_can_tx_fd = ::socketcanOpen(iface_address.name.c_str(), iface_address.is_fd);
         if (socket_can_tx_fd < 0)
         {
             const int error_code = -socket_can_tx_fd;
@@ -70,11 +146,47 @@ public:
             return libcyphal::transport::PlatformError{ocvsmd::platform::PosixPlatformError{error_code}};
         }
 
-        return CanMedia{general_mr, executor, socket_can_rx_fd, socket_can_tx_fd, std::move(iface_address), tx_mr};
+        // Kernel buffer sizes (if requested), and the drop counter - failures are not fatal.
+        //
+        const auto& sizes          = iface_address.buffer_sizes;
+        std::size_t rx_buffer_size = 0;
+        std::size_t tx_buffer_size = 0;
+        const auto  rx_buf_result  = ::socketcanSetBufferSize(socket_can_rx_fd, true, sizes.rcvbuf, &rx_buffer_size);
+        const auto  tx_buf_result  = ::socketcanSetBufferSize(socket_can_tx_fd, false, sizes.sndbuf, &tx_buffer_size);
+        if ((rx_buf_result < 0) || (tx_buf_result < 0))
+        {
+            common::getLogger("io")->warn("Failed to set CAN media '{}' buffer sizes (rx_err={}, tx_err={}).",
+                                          iface_address.name,
+                                          -rx_buf_result,
+                                          -tx_buf_result);
+        }
+        const auto ovfl_result = ::socketcanEnableDropCounter(socket_can_rx_fd);
+        if (ovfl_result < 0)
+        {
+            common::getLogger("io")->debug("Failed to enable CAN kernel drop counter (err={}).", -ovfl_result);
+        }
+
+        return CanMedia{general_mr,
+                        executor,
+                        socket_can_rx_fd,
+                        socket_can_tx_fd,
+                        std::move(iface_address),
+                        tx_mr,
+                        kernel_timestamps,
+                        rx_buffer_size,
+                        tx_buffer_size};
     }
 
     ~CanMedia()
     {
+        if (tx_syscalls_ > 0)
+        {
+            common::getLogger("io")->debug("CAN media '{}' TX stats (frames={}, syscalls={}, expired={}).",
+                                           iface_address_.name,
+                                           tx_sent_frames_,
+                                           tx_syscalls_,
+                                           tx_expired_frames_);
+        }
         if (socket_can_rx_fd_ >= 0)
         {
             (void) ::close(socket_can_rx_fd_);
@@ -89,6 +201,9 @@ public:
     CanMedia& operator=(const CanMedia&)     = delete;
     CanMedia* operator=(CanMedia&&) noexcept = delete;
 
+    /// Media is moved only while being made (before any callback registration),
+    /// so there is no RX/TX batch state to move yet.
+    ///
     CanMedia(CanMedia&& other) noexcept
         : general_mr_{other.general_mr_}
         , executor_{other.executor_}
@@ -96,51 +211,80 @@ public:
         , socket_can_tx_fd_{std::exchange(other.socket_can_tx_fd_, -1)}
         , iface_address_{std::move(other.iface_address_)}
         , tx_mr_{other.tx_mr_}
+        , kernel_timestamps_{other.kernel_timestamps_}
+        , rx_stats_{std::move(other.rx_stats_)}
+        , tx_stats_{std::move(other.tx_stats_)}
     {
+        CETL_DEBUG_ASSERT(!other.tx_flush_callback_.has_value(), "");
+        CETL_DEBUG_ASSERT(!other.probe_callback_.has_value(), "");
+        CETL_DEBUG_ASSERT(other.rx_count_ == 0, "");
     }
 
-    void tryReopen()
+    /// Re-binds both sockets to the interface (by its name).
+    ///
+    /// File descriptors are preserved, so all callbacks registered for them stay valid.
+    /// Fails if the interface doesn't exist (yet), or it's not up.
+    ///
+    bool tryReopen()
     {
-        if (socket_can_rx_fd_ >= 0)
+        const char* const iface_name = iface_address_.name.c_str();
+        if (::socketcanIsUp(socket_can_tx_fd_, iface_name) <= 0)
         {
-            (void) ::close(socket_can_rx_fd_);
-            socket_can_rx_fd_ = -1;
-        }
-        if (socket_can_tx_fd_ >= 0)
-        {
-            (void) ::close(socket_can_tx_fd_);
-            socket_can_tx_fd_ = -1;
+            return false;
         }
 
-        const SocketCANFD socket_can_rx_fd = ::socketcanOpen(iface_address_.c_str(), false);
-        if (socket_can_rx_fd >= 0)
-        {
-            socket_can_rx_fd_ = socket_can_rx_fd;
-        }
+        const std::int16_t rx_result = ::socketcanBind(socket_can_rx_fd_, iface_name);
+        const std::int16_t tx_result = ::socketcanBind(socket_can_tx_fd_, iface_name);
+        return (rx_result >= 0) && (tx_result >= 0);
+    }
 
-        const SocketCANFD socket_can_tx_fd = ::socketcanOpen(iface_address_.c_str(), false);
-        if (socket_can_tx_fd >= 0)
-        {
-            socket_can_tx_fd_ = socket_can_tx_fd;
-        }
+    MediaHealthReport getHealthReport() const
+    {
+        return {iface_address_.name, health_.snapshot()};
+    }
+
+    MediaSocketsReport getSocketsReport() const
+    {
+        return {iface_address_.name, {rx_stats_, tx_stats_}};
     }
 
 private:
-    using Filter  = libcyphal::transport::can::Filter;
-    using Filters = libcyphal::transport::can::Filters;
+    using Callback = libcyphal::IExecutor::Callback;
+    using Filter   = libcyphal::transport::can::Filter;
+    using Filters  = libcyphal::transport::can::Filters;
+    using Profiler = ocvsmd::platform::ExecutorProfiler;
+
+    static constexpr std::size_t RxBatchSize = 16;
+    static constexpr std::size_t TxBatchSize = 32;
+    static_assert(RxBatchSize <= SOCKETCAN_BATCH_MAX, "");
+    static_assert(TxBatchSize <= SOCKETCAN_BATCH_MAX, "");
+
+    struct TxFrame
+    {
+        libcyphal::TimePoint                        deadline;
+        libcyphal::transport::can::CanId            can_id;
+        std::size_t                                 size;
+        std::array<std::uint8_t, CANARD_MTU_CAN_FD> payload;
+    };
 
     CanMedia(cetl::pmr::memory_resource& general_mr,
              libcyphal::IExecutor&       executor,
              const SocketCANFD           socket_can_rx_fd,
              const SocketCANFD           socket_can_tx_fd,
-             std::string                 iface_address,
-             cetl::pmr::memory_resource& tx_mr)
+             CanIfaceAddress             iface_address,
+             cetl::pmr::memory_resource& tx_mr,
+             const bool                  kernel_timestamps,
+             const std::size_t           rx_buffer_size,
+             const std::size_t           tx_buffer_size)
         : general_mr_{general_mr}
         , executor_{executor}
         , socket_can_rx_fd_{socket_can_rx_fd}
         , socket_can_tx_fd_{socket_can_tx_fd}
         , iface_address_{std::move(iface_address)}
         , tx_mr_{tx_mr}
+        , kernel_timestamps_{kernel_timestamps}
+        , rx_stats_{"rx", true, rx_buffer_size, 0, 0}
+        , tx_stats_{"tx", false, tx_buffer_size, 0, 0}
     {
     }
 
@@ -157,11 +301,124 @@ private:
         return posix_executor_ext->registerAwaitableCallback(std::move(function), trigger);
     }
 
+    /// Counts the given error, and starts reopen probing if the interface has just gone down.
+    ///
+    void handleError(const libcyphal::TimePoint now, const int error_code, const bool is_tx)
+    {
+        if (!health_.noteError(now, error_code, is_tx))
+        {
+            return;
+        }
+        common::getLogger("io")->warn("CAN media '{}' is down (err={}).", iface_address_.name, error_code);
+
+        // Staged frames will not make it, and the redundant interfaces (if any) carry them anyway.
+        while (tx_count_ > 0)
+        {
+            health_.noteTxSkipped();
+            popTxFrames(1);
+        }
+
+        if (!probe_callback_.has_value())
+        {
+            probe_callback_ = executor_.registerCallback([this](const auto& arg) {
+                //
+                handleProbe(arg.approx_now);
+            });
+        }
+        probe_callback_.schedule(Callback::Schedule::Once{health_.nextProbeTime()});
+    }
+
+    void handleProbe(const libcyphal::TimePoint now)
+    {
+        const bool success = tryReopen();
+        health_.noteProbe(now, success);
+        if (success)
+        {
+            common::getLogger("io")->info("CAN media '{}' is reopened.", iface_address_.name);
+            return;
+        }
+        probe_callback_.schedule(Callback::Schedule::Once{health_.nextProbeTime()});
+    }
+
+    /// Writes all staged frames, and drops the expired ones.
+    ///
+    /// Stops if the socket is not ready (or its queue is full) - the rest stays staged.
+    /// On failure, the frame which caused it is dropped (like libcyphal does on a push failure).
+    ///
+    CETL_NODISCARD cetl::optional<PushResult::Failure> flushTxFrames(const libcyphal::TimePoint now)
+    {
+        std::array<CanardFrame, TxBatchSize> canard_frames{};
+        while (tx_count_ > 0)
+        {
+            // Collect the leading run of not yet expired frames.
+            std::size_t batch_count = 0;
+            while (batch_count < tx_count_)
+            {
+                const auto& frame = txFrameAt(batch_count);
+                if (frame.deadline < now)
+                {
+                    break;
+                }
+                canard_frames[batch_count++] = CanardFrame{frame.can_id, {frame.size, frame.payload.data()}};
+            }
+            if (batch_count == 0)
+            {
+                ++tx_expired_frames_;
+                popTxFrames(1);
+                continue;
+            }
+
+            const std::int16_t result = ::socketcanPushBatch(socket_can_tx_fd_, batch_count, canard_frames.data());
+            if (result < 0)
+            {
+                popTxFrames(1);
+                handleError(now, -result, true);
+                return PushResult::Failure{
+                    libcyphal::transport::PlatformError{ocvsmd::platform::PosixPlatformError{-result}}};
+            }
+            if (result == 0)
+            {
+                break;
+            }
+            ++tx_syscalls_;
+            tx_sent_frames_ += static_cast<std::size_t>(result);
+            health_.noteTx(static_cast<std::size_t>(result));
+            popTxFrames(static_cast<std::size_t>(result));
+        }
+        return cetl::nullopt;
+    }
+
+    TxFrame& txFrameAt(const std::size_t offset) noexcept
+    {
+        return tx_frames_[(tx_head_ + offset) % TxBatchSize];
+    }
+
+    void popTxFrames(const std::size_t count) noexcept
+    {
+        CETL_DEBUG_ASSERT(count <= tx_count_, "");
+        tx_head_ = (tx_head_ + count) % TxBatchSize;
+        tx_count_ -= count;
+    }
+
+    void handleTxFlush(const libcyphal::TimePoint now)
+    {
+        constexpr auto RetryPeriod = std::chrono::milliseconds{1};
+
+        if (flushTxFrames(now).has_value())
+        {
+            common::getLogger("io")->debug("CAN media '{}' failed to write staged frame.", iface_address_.name);
+        }
+        if (tx_count_ > 0)
+        {
+            tx_flush_callback_.schedule(Callback::Schedule::Once{now + RetryPeriod});
+        }
+    }
+
     // MARK: - IMedia
 
     std::size_t getMtu() const noexcept override
     {
-        return CANARD_MTU_CAN_CLASSIC;
+        return iface_address_.is_fd ? CANARD_MTU_CAN_FD : CANARD_MTU_CAN_CLASSIC;
     }
 
     cetl::optional<libcyphal::transport::MediaFailure> setFilters(const Filters filters) noexcept override
@@ -181,64 +438,155 @@ private:
         return cetl::nullopt;
     }
 
-    PushResult::Type push(const libcyphal::TimePoint /* deadline */,
+    PushResult::Type push(const libcyphal::TimePoint             deadline,
                           const libcyphal::transport::can::CanId can_id,
                           libcyphal::transport::MediaPayload&    payload) noexcept override
     {
-        const CanardFrame  canard_frame{can_id,
-                                        {payload.getSpan().size(), static_cast<const void*>(payload.getSpan().data())}};
-        const std::int16_t result = ::socketcanPush(socket_can_tx_fd_, &canard_frame, 0);
-        if (result < 0)
+        const auto payload_span = payload.getSpan();
+        if (payload_span.size() > CANARD_MTU_CAN_FD)
         {
-            return libcyphal::transport::PlatformError{ocvsmd::platform::PosixPlatformError{-result}};
+            return libcyphal::transport::PlatformError{ocvsmd::platform::PosixPlatformError{EINVAL}};
         }
 
-        const bool is_accepted = result > 0;
-        if (is_accepted)
+        // Skip (drop as if sent) frames of a down interface - otherwise libcyphal would keep them queued for it.
+        //
+        if (!health_.isUp())
         {
-            // Payload is not needed anymore, so return memory asap.
+            health_.noteTxSkipped();
             payload.reset();
+            return PushResult::Success{true};
+        }
+
+        // Make room for the new frame (if needed) - the socket might be ready again.
+        //
+        if (tx_count_ == TxBatchSize)
+        {
+            if (auto failure = flushTxFrames(executor_.now()))
+            {
+                return std::move(*failure);
+            }
+            if (tx_count_ == TxBatchSize)
+            {
+                return PushResult::Success{false};
+            }
         }
 
-        return PushResult::Success{is_accepted};
+        // Insert the new frame after all staged frames of higher or the same priority (lower or equal CAN ID) -
+        // so frames of the same CAN ID (f.e. of a multi-frame transfer) keep their order.
+        //
+        std::size_t offset = tx_count_++;
+        while ((offset > 0) && (txFrameAt(offset - 1).can_id > can_id))
+        {
+            txFrameAt(offset) = txFrameAt(offset - 1);
+            --offset;
+        }
+        auto& frame    = txFrameAt(offset);
+        frame.deadline = deadline;
+        frame.can_id   = can_id;
+        frame.size     = payload_span.size();
+        (void) std::memcpy(frame.payload.data(), payload_span.data(), payload_span.size());
+
+        // Payload is not needed anymore, so return memory asap.
+        payload.reset();
+
+        // The first staged frame arms the flush - the rest of the current wakeup frames will join it.
+        // The callback is registered lazily b/c media might be moved while being made.
+        //
+        if (tx_count_ == 1)
+        {
+            if (!tx_flush_callback_.has_value())
+            {
+                tx_flush_callback_ = executor_.registerCallback([this](const auto& arg) {
+                    //
+                    handleTxFlush(arg.approx_now);
+                });
+            }
+            tx_flush_callback_.schedule(Callback::Schedule::Once{executor_.now()});
+        }
+        return PushResult::Success{true};
     }
 
     CETL_NODISCARD PopResult::Type pop(const cetl::span<cetl::byte> payload_buffer) noexcept override
     {
-        CanardFrame canard_frame{};
-        bool        is_loopback{false};
-
-        const std::int16_t result = ::socketcanPop(socket_can_rx_fd_,
-                                                   &canard_frame,
-                                                   nullptr,
-                                                   payload_buffer.size(),
-                                                   payload_buffer.data(),
-                                                   0,
-                                                   &is_loopback);
-        if (result < 0)
+        if (rx_head_ == rx_count_)
         {
-            return libcyphal::transport::PlatformError{ocvsmd::platform::PosixPlatformError{-result}};
+            rx_head_  = 0;
+            rx_count_ = 0;
+
+            // Kernel timestamps (`SO_TIMESTAMP`) are always enabled by `socketcanOpen`, so it's just a matter of
+            // whether we want to use them or not (see `rx_timestamps` config).
+            //
+            std::uint32_t      drops = rx_stats_.last_drops_counter;
+            const std::int16_t result =
+                ::socketcanPopBatch(socket_can_rx_fd_, RxBatchSize, rx_frames_.data(), true, &drops);
+            health_.noteKernelDrops(rx_stats_.noteKernelDrops(drops));
+            if (result < 0)
+            {
+                handleError(executor_.now(), -result, false);
+                return libcyphal::transport::PlatformError{ocvsmd::platform::PosixPlatformError{-result}};
+            }
+            if (result == 0)
+            {
+                return cetl::nullopt;
+            }
+            rx_count_             = static_cast<std::size_t>(result);
+            rx_batch_time_        = executor_.now();
+            rx_batch_realtime_ns_ = kernel_timestamps_ ? realtimeNowNs() : 0;
+            health_.noteRx(rx_batch_time_, rx_count_);
         }
-        if (result == 0)
+
+        const auto& rx_frame = rx_frames_[rx_head_++];
+        if (rx_frame.frame.payload.size > payload_buffer.size())
         {
-            return cetl::nullopt;
+            return libcyphal::transport::PlatformError{ocvsmd::platform::PosixPlatformError{EFBIG}};
         }
+        (void) std::memcpy(payload_buffer.data(), rx_frame.payload, rx_frame.frame.payload.size);
 
-        return PopResult::Metadata{executor_.now(), canard_frame.extended_can_id, canard_frame.payload.size};
+        const auto timestamp =
+            kernel_timestamps_
+                ? fromKernelTimestamp(rx_batch_time_, rx_batch_realtime_ns_, rx_frame.timestamp_usec * 1000U)
+                : rx_batch_time_;
+        return PopResult::Metadata{timestamp, rx_frame.frame.extended_can_id, rx_frame.frame.payload.size};
     }
 
     CETL_NODISCARD libcyphal::IExecutor::Callback::Any registerPushCallback(
         libcyphal::IExecutor::Callback::Function&& function) override
     {
         using WritableTrigger = ocvsmd::platform::IPosixExecutorExtension::Trigger::Writable;
-        return registerAwaitableCallback(std::move(function), WritableTrigger{socket_can_tx_fd_});
+
+        // The wrapper below just profiles the libcyphal callback (if the executor supports profiling).
+        //
+        push_function_ = std::move(function);
+        return registerAwaitableCallback(
+            [this, profiler = cetl::rtti_cast<Profiler*>(&executor_)](const auto& arg) {
+                //
+                const Profiler::Scope scope{profiler, Profiler::Category::CanTx};
+                push_function_(arg);
+            },
+            WritableTrigger{socket_can_tx_fd_});
     }
 
     CETL_NODISCARD libcyphal::IExecutor::Callback::Any registerPopCallback(
         libcyphal::IExecutor::Callback::Function&& function) override
     {
         using ReadableTrigger = ocvsmd::platform::IPosixExecutorExtension::Trigger::Readable;
-        return registerAwaitableCallback(std::move(function), ReadableTrigger{socket_can_rx_fd_});
+
+        // libcyphal pops one frame per callback call, but the socket will not become readable again
+        // (and so will not wake us up) if the whole batch has been already read out of it.
+        // Hence, the wrapper below drains all pending frames of the current batch within the same wakeup.
+        //
+        pop_function_ = std::move(function);
+        return registerAwaitableCallback(
+            [this, profiler = cetl::rtti_cast<Profiler*>(&executor_)](const auto& arg) {
+                //
+                const Profiler::Scope scope{profiler, Profiler::Category::CanRx};
+                std::size_t           calls = 0;
+                do
+                {
+                    pop_function_(arg);
+                } while ((rx_head_ < rx_count_) && (++calls < RxBatchSize));
+            },
+            ReadableTrigger{socket_can_rx_fd_});
     }
 
     cetl::pmr::memory_resource& getTxMemoryResource() override
@@ -252,8 +600,28 @@ private:
     libcyphal::IExecutor&       executor_;
     SocketCANFD                 socket_can_rx_fd_;
     SocketCANFD                 socket_can_tx_fd_;
-    std::string                 iface_address_;
+    CanIfaceAddress             iface_address_;
     cetl::pmr::memory_resource& tx_mr_;
+    bool                        kernel_timestamps_;
+    SocketStats                 rx_stats_;
+    SocketStats                 tx_stats_;
+
+    Callback::Function                        push_function_;
+    Callback::Function                        pop_function_;
+    std::array<SocketCANRxFrame, RxBatchSize> rx_frames_{};
+    std::size_t                               rx_head_{0};
+    std::size_t                               rx_count_{0};
+    libcyphal::TimePoint                      rx_batch_time_{};
+    std::uint64_t                             rx_batch_realtime_ns_{0};
+    Callback::Any                             tx_flush_callback_;
+    std::array<TxFrame, TxBatchSize>          tx_frames_{};
+    std::size_t                               tx_head_{0};
+    std::size_t                               tx_count_{0};
+    std::uint64_t                             tx_sent_frames_{0};
+    std::uint64_t                             tx_syscalls_{0};
+    std::uint64_t                             tx_expired_frames_{0};
+    MediaHealth                               health_;
+    Callback::Any                             probe_callback_;
 
 };  // CanMedia
 
@@ -263,11 +631,13 @@ struct CanMediaCollection
 {
     CanMediaCollection(cetl::pmr::memory_resource& general_mr,
                        libcyphal::IExecutor&       executor,
-                       cetl::pmr::memory_resource& tx_mr)
+                       cetl::pmr::memory_resource& tx_mr,
+                       const bool                  kernel_timestamps)
         : general_mr_{general_mr}
         , executor_{executor}
         , media_array_{{cetl::nullopt, cetl::nullopt, cetl::nullopt}}
         , tx_mr_{tx_mr}
+        , kernel_timestamps_{kernel_timestamps}
     {
     }
 
@@ -290,7 +660,7 @@ struct CanMediaCollection
             const auto iface_address = iface_addresses.substr(curr, next - curr);
             if (!iface_address.empty())
             {
-                auto maybe_media = CanMedia::make(general_mr_, executor_, iface_address, tx_mr_);
+                auto maybe_media = CanMedia::make(general_mr_, executor_, iface_address, tx_mr_, kernel_timestamps_);
                 if (auto* const media_ptr = cetl::get_if<CanMedia>(&maybe_media))
                 {
                     media_array_[index].emplace(std::move(*media_ptr));     // NOLINT
@@ -316,6 +686,32 @@ struct CanMediaCollection
         });
     }
 
+    std::vector<MediaHealthReport> getHealthReports() const
+    {
+        std::vector<MediaHealthReport> reports;
+        for (const auto& media : media_array_)
+        {
+            if (media.has_value())
+            {
+                reports.push_back(media->getHealthReport());
+            }
+        }
+        return reports;
+    }
+
+    std::vector<MediaSocketsReport> getSocketsReports() const
+    {
+        std::vector<MediaSocketsReport> reports;
+        for (const auto& media : media_array_)
+        {
+            if (media.has_value())
+            {
+                reports.push_back(media->getSocketsReport());
+            }
+        }
+        return reports;
+    }
+
 private:
     static constexpr std::size_t MaxCanMedia = 3;
 
@@ -324,6 +720,7 @@ private:
     std::array<cetl::optional<CanMedia>, MaxCanMedia>           media_array_;
     std::array<libcyphal::transport::can::IMedia*, MaxCanMedia> media_ifaces_{};
     cetl::pmr::memory_resource&                                 tx_mr_;
+    bool                                                        kernel_timestamps_;
 
 };  // CanMediaCollection
 
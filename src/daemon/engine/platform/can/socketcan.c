@@ -24,6 +24,7 @@
 
 #include <assert.h>
 #include <errno.h>
+#include <limits.h>
 #include <poll.h>
 #include <string.h>
 #include <time.h>
@@ -51,6 +52,14 @@ static int16_t getNegatedErrno(void)
 
 static int16_t doPoll(const SocketCANFD fd, const int16_t mask, const CanardMicrosecond timeout_usec)
 {
+    // Zero timeout means a non-blocking operation, and the socket is non-blocking anyway -
+    // so skip the system call; the caller handles EAGAIN of the following I/O call instead.
+    // Normally, readiness has been already reported by the caller's event loop (epoll etc.).
+    if (timeout_usec == 0)
+    {
+        return 1;
+    }
+
     struct pollfd fds;
     memset(&fds, 0, sizeof(fds));
     fds.fd     = fd;
@@ -77,6 +86,34 @@ static int16_t doPoll(const SocketCANFD fd, const int16_t mask, const CanardMicr
     return 1;
 }
 
+static bool isWouldBlock(void)
+{
+    return (errno == EAGAIN) || (errno == EWOULDBLOCK);
+}
+
+/// Returns the number of bytes to write (CAN_MTU or CANFD_MTU).
+static size_t makeSockcanFrame(const struct CanardFrame* const frame, struct canfd_frame* const out_cfd)
+{
+    // We use the CAN FD struct regardless of whether the CAN FD socket option is set.
+    // Per the user manual, this is acceptable because they are binary compatible.
+    (void) memset(out_cfd, 0, sizeof(*out_cfd));
+    out_cfd->can_id = frame->extended_can_id | CAN_EFF_FLAG;
+    out_cfd->len    = (uint8_t) frame->payload.size;
+    // We set the bit rate switch on the assumption that it will be ignored by non-CAN-FD-capable hardware.
+    out_cfd->flags = CANFD_BRS;
+    (void) memcpy(out_cfd->data, frame->payload.data, frame->payload.size);
+
+    // If the payload is small, use the smaller MTU for compatibility with non-FD sockets.
+    // This way, if the user attempts to transmit a CAN FD frame without having the CAN FD socket option enabled,
+    // an error will be triggered here.  This is convenient -- we can handle both FD and Classic CAN uniformly.
+    return (frame->payload.size > CAN_MAX_DLEN) ? CANFD_MTU : CAN_MTU;
+}
+
+static bool isValidTxFrame(const struct CanardFrame* const frame)
+{
+    return (frame != NULL) && (frame->payload.data != NULL) && (frame->payload.size <= CANFD_MAX_DLEN);
+}
+
 SocketCANFD socketcanOpen(const char* const iface_name, const bool can_fd)
 {
     const size_t iface_name_size = strlen(iface_name) + 1;
@@ -86,23 +123,7 @@ SocketCANFD socketcanOpen(const char* const iface_name, const bool can_fd)
     }
 
     const int fd = socket(PF_CAN, SOCK_RAW | SOCK_NONBLOCK, CAN_RAW);  // NOLINT
-    bool      ok = fd >= 0;
-
-    if (ok)
-    {
-        struct ifreq ifr;
-        (void) memset(&ifr, 0, sizeof(ifr));
-        (void) memcpy(ifr.ifr_name, iface_name, iface_name_size);
-        ok = 0 == ioctl(fd, SIOCGIFINDEX, &ifr);
-        if (ok)
-        {
-            struct sockaddr_can addr;
-            (void) memset(&addr, 0, sizeof(addr));
-            addr.can_family  = AF_CAN;
-            addr.can_ifindex = ifr.ifr_ifindex;
-            ok               = 0 == bind(fd, (struct sockaddr*) &addr, sizeof(addr));
-        }
-    }
+    bool      ok = (fd >= 0) && (0 == socketcanBind(fd, iface_name));
 
     // Enable CAN FD if required.
     if (ok && can_fd)
@@ -134,9 +155,54 @@ SocketCANFD socketcanOpen(const char* const iface_name, const bool can_fd)
     return getNegatedErrno();
 }
 
+int16_t socketcanBind(const SocketCANFD fd, const char* const iface_name)
+{
+    const size_t iface_name_size = strlen(iface_name) + 1;
+    if (iface_name_size > IFNAMSIZ)
+    {
+        return -ENAMETOOLONG;
+    }
+
+    struct ifreq ifr;
+    (void) memset(&ifr, 0, sizeof(ifr));
+    (void) memcpy(ifr.ifr_name, iface_name, iface_name_size);
+    if (0 != ioctl(fd, SIOCGIFINDEX, &ifr))
+    {
+        return getNegatedErrno();
+    }
+
+    struct sockaddr_can addr;
+    (void) memset(&addr, 0, sizeof(addr));
+    addr.can_family  = AF_CAN;
+    addr.can_ifindex = ifr.ifr_ifindex;
+    if (0 != bind(fd, (struct sockaddr*) &addr, sizeof(addr)))
+    {
+        return getNegatedErrno();
+    }
+    return 0;
+}
+
+int16_t socketcanIsUp(const SocketCANFD fd, const char* const iface_name)
+{
+    const size_t iface_name_size = strlen(iface_name) + 1;
+    if (iface_name_size > IFNAMSIZ)
+    {
+        return -ENAMETOOLONG;
+    }
+
+    struct ifreq ifr;
+    (void) memset(&ifr, 0, sizeof(ifr));
+    (void) memcpy(ifr.ifr_name, iface_name, iface_name_size);
+    if (0 != ioctl(fd, SIOCGIFFLAGS, &ifr))
+    {
+        return getNegatedErrno();
+    }
+    return ((ifr.ifr_flags & IFF_UP) != 0) ? 1 : 0;
+}
+
 int16_t socketcanPush(const SocketCANFD fd, const struct CanardFrame* const frame, const CanardMicrosecond timeout_usec)
 {
-    if ((frame == NULL) || (frame->payload.data == NULL) || (frame->payload.size > UINT8_MAX))
+    if (!isValidTxFrame(frame))
     {
         return -EINVAL;
     }
@@ -144,28 +210,49 @@ int16_t socketcanPush(const SocketCANFD fd, const struct CanardFrame* const fram
     const int16_t poll_result = doPoll(fd, POLLOUT, timeout_usec);
     if (poll_result > 0)
     {
-        // We use the CAN FD struct regardless of whether the CAN FD socket option is set.
-        // Per the user manual, this is acceptable because they are binary compatible.
         struct canfd_frame cfd;
-        (void) memset(&cfd, 0, sizeof(cfd));
-        cfd.can_id = frame->extended_can_id | CAN_EFF_FLAG;
-        cfd.len    = (uint8_t) frame->payload.size;
-        // We set the bit rate switch on the assumption that it will be ignored by non-CAN-FD-capable hardware.
-        cfd.flags = CANFD_BRS;
-        (void) memcpy(cfd.data, frame->payload.data, frame->payload.size);
-
-        // If the payload is small, use the smaller MTU for compatibility with non-FD sockets.
-        // This way, if the user attempts to transmit a CAN FD frame without having the CAN FD socket option enabled,
-        // an error will be triggered here.  This is convenient -- we can handle both FD and Classic CAN uniformly.
-        const size_t mtu = (frame->payload.size > CAN_MAX_DLEN) ? CANFD_MTU : CAN_MTU;
+        const size_t       mtu = makeSockcanFrame(frame, &cfd);
         if (write(fd, &cfd, mtu) < 0)
         {
-            return getNegatedErrno();
+            return isWouldBlock() ? 0 : getNegatedErrno();
         }
     }
     return poll_result;
 }
 
+int16_t socketcanPushBatch(const SocketCANFD fd, const size_t count, const struct CanardFrame* const frames)
+{
+    if ((frames == NULL) || (count == 0))
+    {
+        return -EINVAL;
+    }
+    const size_t batch_count = (count > SOCKETCAN_BATCH_MAX) ? SOCKETCAN_BATCH_MAX : count;
+
+    struct canfd_frame cfds[SOCKETCAN_BATCH_MAX];
+    struct iovec       iovs[SOCKETCAN_BATCH_MAX];
+    struct mmsghdr     msgs[SOCKETCAN_BATCH_MAX];
+    (void) memset(msgs, 0, sizeof(msgs[0]) * batch_count);
+    for (size_t idx = 0; idx < batch_count; idx++)
+    {
+        if (!isValidTxFrame(&frames[idx]))
+        {
+            return -EINVAL;
+        }
+        iovs[idx].iov_base           = &cfds[idx];
+        iovs[idx].iov_len            = makeSockcanFrame(&frames[idx], &cfds[idx]);
+        msgs[idx].msg_hdr.msg_iov    = &iovs[idx];
+        msgs[idx].msg_hdr.msg_iovlen = 1;
+    }
+
+    const int send_result = sendmmsg(fd, msgs, (unsigned int) batch_count, MSG_DONTWAIT);
+    if (send_result < 0)
+    {
+        // Full TX queue of the interface is reported by ENOBUFS - treat it as "not ready" as well.
+        return (isWouldBlock() || (errno == ENOBUFS)) ? 0 : getNegatedErrno();
+    }
+    return (int16_t) send_result;
+}
+
 int16_t socketcanPop(const SocketCANFD         fd,
                      struct CanardFrame* const out_frame,
                      CanardMicrosecond* const  out_timestamp_usec,
@@ -215,7 +302,8 @@ int16_t socketcanPop(const SocketCANFD         fd,
         const ssize_t read_size = recvmsg(fd, &msg, MSG_DONTWAIT);
         if (read_size < 0)
         {
-            return getNegatedErrno();  // Error occurred -- return the negated error code.
+            // Nothing to read (possible with zero timeout), or an error occurred -- return the negated error code.
+            return isWouldBlock() ? 0 : getNegatedErrno();
         }
         if ((read_size != CAN_MTU) && (read_size != CANFD_MTU))
         {
@@ -274,6 +362,121 @@ int16_t socketcanPop(const SocketCANFD         fd,
     return poll_result;
 }
 
+int16_t socketcanSetBufferSize(const SocketCANFD fd, const bool is_rx, const size_t size, size_t* const out_size)
+{
+    if (size > (size_t) INT_MAX)
+    {
+        return -EINVAL;
+    }
+    const int option   = is_rx ? SO_RCVBUF : SO_SNDBUF;
+    const int size_int = (int) size;
+    if ((size > 0) && (setsockopt(fd, SOL_SOCKET, option, &size_int, sizeof(size_int)) != 0))
+    {
+        return getNegatedErrno();
+    }
+    int       effective_size = 0;
+    socklen_t optlen         = sizeof(effective_size);
+    if ((out_size != NULL) && (getsockopt(fd, SOL_SOCKET, option, &effective_size, &optlen) == 0))
+    {
+        *out_size = (size_t) effective_size;
+    }
+    return 0;
+}
+
+int16_t socketcanEnableDropCounter(const SocketCANFD fd)
+{
+    const int en = 1;
+    return (setsockopt(fd, SOL_SOCKET, SO_RXQ_OVFL, &en, sizeof(en)) == 0) ? 0 : getNegatedErrno();
+}
+
+int16_t socketcanPopBatch(const SocketCANFD       fd,
+                          const size_t            count,
+                          SocketCANRxFrame* const out_frames,
+                          const bool              accept_loopback,
+                          uint32_t* const         inout_drops)
+{
+    if ((out_frames == NULL) || (count == 0))
+    {
+        return -EINVAL;
+    }
+    const size_t batch_count = (count > SOCKETCAN_BATCH_MAX) ? SOCKETCAN_BATCH_MAX : count;
+
+    // See `socketcanPop` for details on the frame storage and the ancillary data buffers.
+    struct canfd_frame cfds[SOCKETCAN_BATCH_MAX];
+    struct iovec       iovs[SOCKETCAN_BATCH_MAX];
+    struct mmsghdr     msgs[SOCKETCAN_BATCH_MAX];
+    union
+    {
+        uint8_t        buf[CMSG_SPACE(sizeof(struct timeval)) + CMSG_SPACE(sizeof(uint32_t))];
+        struct cmsghdr align;
+    } controls[SOCKETCAN_BATCH_MAX];
+    (void) memset(msgs, 0, sizeof(msgs[0]) * batch_count);
+    for (size_t idx = 0; idx < batch_count; idx++)
+    {
+        iovs[idx].iov_base               = &cfds[idx];
+        iovs[idx].iov_len                = sizeof(cfds[idx]);
+        msgs[idx].msg_hdr.msg_iov        = &iovs[idx];
+        msgs[idx].msg_hdr.msg_iovlen     = 1;
+        msgs[idx].msg_hdr.msg_control    = controls[idx].buf;
+        msgs[idx].msg_hdr.msg_controllen = sizeof(controls[idx].buf);
+    }
+
+    const int recv_result = recvmmsg(fd, msgs, (unsigned int) batch_count, MSG_DONTWAIT, NULL);
+    if (recv_result < 0)
+    {
+        return isWouldBlock() ? 0 : getNegatedErrno();
+    }
+
+    size_t out_count = 0;
+    for (size_t idx = 0; idx < (size_t) recv_result; idx++)
+    {
+        const struct canfd_frame* const cfd = &cfds[idx];
+
+        // The drop counter is cumulative, and it's reported even by frames which are dropped below.
+        struct cmsghdr* ovfl_cmsg = CMSG_FIRSTHDR(&msgs[idx].msg_hdr);
+        while ((ovfl_cmsg != NULL) && (inout_drops != NULL))
+        {
+            if ((ovfl_cmsg->cmsg_level == SOL_SOCKET) && (ovfl_cmsg->cmsg_type == SO_RXQ_OVFL))
+            {
+                (void) memcpy(inout_drops, CMSG_DATA(ovfl_cmsg), sizeof(*inout_drops));  // Avoid alignment problems
+            }
+            ovfl_cmsg = CMSG_NXTHDR(&msgs[idx].msg_hdr, ovfl_cmsg);
+        }
+
+        const bool valid = ((msgs[idx].msg_len == CAN_MTU) || (msgs[idx].msg_len == CANFD_MTU)) &&  //
+                           ((cfd->can_id & CAN_EFF_FLAG) != 0) &&                                   // Extended frame
+                           ((cfd->can_id & CAN_ERR_FLAG) == 0) &&                                   // Not error frame
+                           ((cfd->can_id & CAN_RTR_FLAG) == 0);                                     // Not RTR frame
+        const bool loopback = ((uint32_t) msgs[idx].msg_hdr.msg_flags & (uint32_t) MSG_CONFIRM) != 0;
+        if ((!valid) || (loopback && !accept_loopback))
+        {
+            continue;  // Drop silently.
+        }
+
+        SocketCANRxFrame* const out = &out_frames[out_count++];
+        out->timestamp_usec         = 0;
+        out->loopback               = loopback;
+
+        struct cmsghdr* cmsg = CMSG_FIRSTHDR(&msgs[idx].msg_hdr);
+        while (cmsg != NULL)
+        {
+            if ((cmsg->cmsg_level == SOL_SOCKET) && (cmsg->cmsg_type == SO_TIMESTAMP))
+            {
+                struct timeval tv;
+                (void) memcpy(&tv, CMSG_DATA(cmsg), sizeof(tv));  // Copy to avoid alignment problems
+                out->timestamp_usec = (CanardMicrosecond) (((uint64_t) tv.tv_sec * MEGA) + (uint64_t) tv.tv_usec);
+            }
+            cmsg = CMSG_NXTHDR(&msgs[idx].msg_hdr, cmsg);
+        }
+
+        out->frame.extended_can_id = cfd->can_id & CAN_EFF_MASK;
+        out->frame.payload.size    = cfd->len;
+        out->frame.payload.data    = out->payload;
+        (void) memcpy(out->payload, &cfd->data[0], cfd->len);
+    }
+    return (int16_t) out_count;
+}
+
 int16_t socketcanFilter(const SocketCANFD fd, const size_t num_configs, const struct CanardFilter* const configs)
 {
     if (configs == NULL)
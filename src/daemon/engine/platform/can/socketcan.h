@@ -13,6 +13,12 @@
 /// --------------------------------------------------------------------------------------------------------------------
 /// Changelog
 ///
+/// v3.2 - Added socketcanBind to re-bind a socket after its interface has been re-created,
+///        and socketcanIsUp to check the interface state.
+///
+/// v3.1 - Added batched reception/transmission (socketcanPopBatch/socketcanPushBatch).
+///        Zero timeout no longer involves an extra ppoll() call.
+///
 /// v3.0 - Update for compatibility with Libcanard v3.
 ///
 /// v2.0 - Added loop-back functionality.
@@ -49,6 +55,28 @@ extern "C"
     /// The argument can_fd enables support for CAN FD frames.
     SocketCANFD socketcanOpen(const char* const iface_name, const bool can_fd);
 
+    /// (Re-)bind an open socket to the interface by its name.
+    /// The socket options (CAN FD, filters, etc.) are preserved, and so is the file descriptor itself.
+    /// Useful when the interface has been removed and then re-created (f.e. a USB adapter re-plugged) -
+    /// the kernel unbinds sockets of a removed interface, and the new one has a different index.
+    /// Returns 0 on success, negated errno on error.
+    int16_t socketcanBind(const SocketCANFD fd, const char* const iface_name);
+
+    /// Check whether the interface (by its name) is administratively up.
+    /// Note that the kernel allows to open and bind sockets of a down interface - they just don't pass any frames.
+    /// Returns 1 if up, 0 if down, negated errno on error (f.e. -ENODEV if there is no such interface).
+    int16_t socketcanIsUp(const SocketCANFD fd, const char* const iface_name);
+
+    /// Set size of the kernel receive (`SO_RCVBUF`, if `is_rx`) or send (`SO_SNDBUF`) buffer of the socket;
+    /// zero size keeps the current one. The effective size (as reported back by the kernel - f.e. Linux doubles
+    /// the requested size, and caps it by `net.core.rmem_max`/`wmem_max`) is stored into `out_size` (if not NULL).
+    /// Returns 0 on success, negated errno on error.
+    int16_t socketcanSetBufferSize(const SocketCANFD fd, const bool is_rx, const size_t size, size_t* const out_size);
+
+    /// Enable reporting of the kernel drop counter (`SO_RXQ_OVFL`) - see `socketcanPopBatch`.
+    /// Returns 0 on success, negated errno on error.
+    int16_t socketcanEnableDropCounter(const SocketCANFD fd);
+
     /// Enqueue a new extended CAN data frame for transmission.
     /// Block until the frame is enqueued or until the timeout is expired.
     /// Zero timeout makes the operation non-blocking.
@@ -75,6 +103,42 @@ extern "C"
                          const CanardMicrosecond   timeout_usec,
                          bool* const               loopback);
 
+    /// The maximum number of frames which could be read or written by a single batched call.
+    enum
+    {
+        SOCKETCAN_BATCH_MAX = 64
+    };
+
+    /// Describes a single frame of the batched reception.
+    /// The payload pointer of the frame points to the `payload` buffer of the same structure.
+    typedef struct
+    {
+        struct CanardFrame frame;
+        CanardMicrosecond  timestamp_usec;  ///< CLOCK_REALTIME by the kernel, or zero if not available.
+        bool               loopback;
+        uint8_t            payload[CANARD_MTU_CAN_FD];
+    } SocketCANRxFrame;
+
+    /// Enqueue up to `count` (but not more than SOCKETCAN_BATCH_MAX) extended CAN data frames without blocking.
+    /// All frames are written by a single system call (sendmmsg).
+    /// Returns the number of enqueued frames (the leading part of the batch), 0 if the socket is not ready,
+    /// or negated errno on error.
+    int16_t socketcanPushBatch(const SocketCANFD fd, const size_t count, const struct CanardFrame* const frames);
+
+    /// Fetch up to `count` (but not more than SOCKETCAN_BATCH_MAX) frames from the RX queue without blocking.
+    /// All frames are read by a single system call (recvmmsg). Frames which are not extended-ID data frames
+    /// are dropped, as well as loopback frames unless `accept_loopback` is set (then they are indicated by the flag).
+    /// If the drop counter is enabled (see `socketcanEnableDropCounter`), `inout_drops` (if not NULL) is updated
+    /// to the number of frames dropped by the kernel (receive buffer overflows) since the socket creation
+    /// (wraps around); it's left untouched if nothing has been read.
+    /// Returns the number of fetched frames (stored at the beginning of `out_frames`), 0 if there are none,
+    /// or negated errno on error.
+    int16_t socketcanPopBatch(const SocketCANFD       fd,
+                              const size_t            count,
+                              SocketCANRxFrame* const out_frames,
+                              const bool              accept_loopback,
+                              uint32_t* const         inout_drops);
+
     /// Apply the specified acceptance filter configuration.
     /// Note that it is only possible to accept extended-format data frames.
     /// The default configuration is to accept everything.
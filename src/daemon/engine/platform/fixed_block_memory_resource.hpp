@@ -0,0 +1,265 @@
+//
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#ifndef OCVSMD_DAEMON_ENGINE_PLATFORM_FIXED_BLOCK_MEMORY_RESOURCE_HPP_INCLUDED
+#define OCVSMD_DAEMON_ENGINE_PLATFORM_FIXED_BLOCK_MEMORY_RESOURCE_HPP_INCLUDED
+
+#include <cetl/cetl.hpp>
+#include <cetl/pf17/cetlpf.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <vector>
+
+namespace ocvsmd
+{
+namespace daemon
+{
+namespace engine
+{
+namespace platform
+{
+
+/// @brief Defines memory resource which serves allocations from a pool of fixed-size blocks.
+///
+/// Blocks are carved from chunks (of `blocks_per_chunk` blocks each) allocated from the upstream resource
+/// on demand. Freed blocks are kept in a free list for reuse, and returned upstream only on destruction.
+/// Requests which don't fit into a block (by size or alignment) are forwarded to the upstream as is.
+/// Chunks could also be preallocated upfront (see `reserve`) - to keep the upstream out of steady state traffic.
+///
+/// Deallocation of a pool block does not depend on the given size - any size up to the block size is accepted.
+/// This allows to hand over a block (f.e. a datagram buffer) together with its actual (smaller) data size,
+/// and let the new owner free it by that data size - without any intermediate copying.
+///
+/// Not thread-safe - in use on the engine thread only.
+///
+class FixedBlockMemoryResource final : public cetl::pmr::memory_resource
+{
+public:
+    FixedBlockMemoryResource(cetl::pmr::memory_resource& upstream,
+                             const std::size_t           block_size,
+                             const std::size_t           blocks_per_chunk)
+        : upstream_{upstream}
+        , block_size_{roundUp(std::max(block_size, sizeof(FreeBlock)))}
+        , blocks_per_chunk_{std::max<std::size_t>(blocks_per_chunk, 1)}
+    {
+    }
+
+    ~FixedBlockMemoryResource() override
+    {
+        for (auto* const chunk : chunks_)
+        {
+            upstream_.deallocate(chunk, chunkSize(), alignof(std::max_align_t));
+        }
+    }
+
+    FixedBlockMemoryResource(const FixedBlockMemoryResource&)                = delete;
+    FixedBlockMemoryResource(FixedBlockMemoryResource&&) noexcept            = delete;
+    FixedBlockMemoryResource& operator=(const FixedBlockMemoryResource&)     = delete;
+    FixedBlockMemoryResource& operator=(FixedBlockMemoryResource&&) noexcept = delete;
+
+    std::size_t blockSize() const noexcept
+    {
+        return block_size_;
+    }
+
+    /// Gets number of blocks currently in use (allocated and not yet deallocated).
+    ///
+    std::size_t usedBlocks() const noexcept
+    {
+        return used_blocks_;
+    }
+
+    /// Gets number of blocks in all chunks allocated so far from the upstream.
+    ///
+    std::size_t totalBlocks() const noexcept
+    {
+        return chunks_.size() * blocks_per_chunk_;
+    }
+
+    /// Preallocates chunks (from the upstream) until there are at least the given number of blocks in total.
+    ///
+    /// @return `false` if the upstream has failed to provide the memory.
+    ///
+    bool reserve(const std::size_t blocks)
+    {
+        while (totalBlocks() < blocks)
+        {
+            if (!grow())
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /// Pre-faults all chunks allocated so far - touches each of their memory pages, so that the first use
+    /// of a block doesn't take a page fault on the hot path (see `[runtime] prefault`).
+    ///
+    /// A page is touched by reading and writing back one of its bytes - so content of blocks (even used ones)
+    /// is preserved.
+    ///
+    void prefault() const noexcept
+    {
+        constexpr std::size_t PageSize = 4096;  // The smallest page size in practice.
+
+        for (auto* const chunk : chunks_)
+        {
+            for (std::size_t offset = 0; offset < chunkSize(); offset += PageSize)
+            {
+                volatile cetl::byte* const byte = chunk + offset;  // NOLINT(*-pointer-arithmetic)
+                *byte                           = *byte;
+            }
+        }
+    }
+
+    /// Checks whether the given pointer is a block of this pool.
+    ///
+    /// Chunks are kept sorted by address, so the check is a binary search - O(log chunks).
+    ///
+    bool owns(const void* const ptr) const noexcept
+    {
+        const auto* const byte_ptr = static_cast<const cetl::byte*>(ptr);
+        const auto        it       = std::upper_bound(chunks_.cbegin(), chunks_.cend(), byte_ptr, std::less<>{});
+        if (it == chunks_.cbegin())
+        {
+            return false;
+        }
+        const cetl::byte* const chunk = *std::prev(it);
+        return byte_ptr < (chunk + chunkSize());  // NOLINT(*-pointer-arithmetic)
+    }
+
+    /// Gets chunks allocated so far from the upstream - sorted by address.
+    ///
+    const std::vector<cetl::byte*>& chunks() const noexcept
+    {
+        return chunks_;
+    }
+
+    std::size_t chunkSize() const noexcept
+    {
+        return block_size_ * blocks_per_chunk_;
+    }
+
+private:
+    struct FreeBlock
+    {
+        FreeBlock* next;
+    };
+
+    static std::size_t roundUp(const std::size_t size)
+    {
+        constexpr std::size_t Alignment = alignof(std::max_align_t);
+        return ((size + Alignment - 1U) / Alignment) * Alignment;
+    }
+
+    bool fits(const std::size_t size_bytes, const std::size_t alignment) const noexcept
+    {
+        return (size_bytes <= block_size_) && (alignment <= alignof(std::max_align_t));
+    }
+
+    bool grow()
+    {
+        auto* const chunk = static_cast<cetl::byte*>(upstream_.allocate(chunkSize(), alignof(std::max_align_t)));
+        if (chunk == nullptr)
+        {
+            return false;
+        }
+        chunks_.insert(std::upper_bound(chunks_.begin(), chunks_.end(), chunk, std::less<>{}), chunk);
+
+        for (std::size_t i = 0; i < blocks_per_chunk_; ++i)
+        {
+            // NOLINTNEXTLINE(*-reinterpret-cast)
+            auto* const block = reinterpret_cast<FreeBlock*>(chunk + (i * block_size_));
+            block->next       = free_list_;
+            free_list_        = block;
+        }
+        return true;
+    }
+
+    // MARK: cetl::pmr::memory_resource
+
+    void* do_allocate(const std::size_t size_bytes, const std::size_t alignment) override
+    {
+        if (!fits(size_bytes, alignment))
+        {
+            return upstream_.allocate(size_bytes, alignment);
+        }
+
+        if ((free_list_ == nullptr) && !grow())
+        {
+            return nullptr;
+        }
+        auto* const block = free_list_;
+        free_list_        = block->next;
+        ++used_blocks_;
+        return block;
+    }
+
+    void do_deallocate(void* const ptr, const std::size_t size_bytes, const std::size_t alignment) override
+    {
+        if (ptr == nullptr)
+        {
+            return;
+        }
+        if (!owns(ptr))
+        {
+            upstream_.deallocate(ptr, size_bytes, alignment);
+            return;
+        }
+
+        CETL_DEBUG_ASSERT(used_blocks_ > 0, "");
+        auto* const block = static_cast<FreeBlock*>(ptr);
+        block->next       = free_list_;
+        free_list_        = block;
+        --used_blocks_;
+    }
+
+#if (__cplusplus < CETL_CPP_STANDARD_17)
+
+    void* do_reallocate(void* const       ptr,
+                        const std::size_t old_size_bytes,
+                        const std::size_t new_size_bytes,
+                        const std::size_t alignment) override
+    {
+        if ((ptr != nullptr) && owns(ptr) && fits(new_size_bytes, alignment))
+        {
+            return ptr;
+        }
+
+        void* const new_ptr = do_allocate(new_size_bytes, alignment);
+        if ((new_ptr != nullptr) && (ptr != nullptr))
+        {
+            (void) std::memcpy(new_ptr, ptr, std::min(old_size_bytes, new_size_bytes));
+            do_deallocate(ptr, old_size_bytes, alignment);
+        }
+        return new_ptr;
+    }
+
+#endif
+
+    bool do_is_equal(const cetl::pmr::memory_resource& rhs) const noexcept override
+    {
+        return (&rhs == this);
+    }
+
+    cetl::pmr::memory_resource& upstream_;
+    const std::size_t           block_size_;
+    const std::size_t           blocks_per_chunk_;
+    std::vector<cetl::byte*>    chunks_;
+    FreeBlock*                  free_list_{nullptr};
+    std::size_t                 used_blocks_{0};
+
+};  // FixedBlockMemoryResource
+
+}  // namespace platform
+}  // namespace engine
+}  // namespace daemon
+}  // namespace ocvsmd
+
+#endif  // OCVSMD_DAEMON_ENGINE_PLATFORM_FIXED_BLOCK_MEMORY_RESOURCE_HPP_INCLUDED
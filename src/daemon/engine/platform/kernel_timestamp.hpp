@@ -0,0 +1,73 @@
+//
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#ifndef OCVSMD_DAEMON_ENGINE_PLATFORM_KERNEL_TIMESTAMP_HPP_INCLUDED
+#define OCVSMD_DAEMON_ENGINE_PLATFORM_KERNEL_TIMESTAMP_HPP_INCLUDED
+
+#include <libcyphal/types.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <ctime>
+
+namespace ocvsmd
+{
+namespace daemon
+{
+namespace engine
+{
+namespace platform
+{
+
+/// Gets current time of the realtime clock (the one of kernel RX timestamps) in nanoseconds.
+///
+/// Supposed to be sampled once per RX batch - next to the batch time in the libcyphal time base
+/// (see `fromKernelTimestamp`).
+///
+/// @return Zero if the clock is not available.
+///
+inline std::uint64_t realtimeNowNs() noexcept
+{
+    constexpr std::uint64_t NsPerSec = 1000000000ULL;
+
+    ::timespec ts{};
+    if (::clock_gettime(CLOCK_REALTIME, &ts) != 0)
+    {
+        return 0;
+    }
+    return (static_cast<std::uint64_t>(ts.tv_sec) * NsPerSec) + static_cast<std::uint64_t>(ts.tv_nsec);
+}
+
+/// Converts a kernel RX timestamp (`CLOCK_REALTIME` nanoseconds, as reported by `SO_TIMESTAMP[NS]`)
+/// into the libcyphal time base.
+///
+/// The conversion is done by the age of the timestamp (relative to the realtime clock sampled together with `now`),
+/// so a realtime clock step affects only frames received across the step. Both clocks are sampled once per batch,
+/// so all items of a batch are converted against the same base (and not skewed by the time of their processing).
+/// A timestamp "from the future" is treated as received at `now`.
+///
+/// @param now Time of the batch in the libcyphal time base (normally `executor.now()`).
+/// @param now_realtime_ns The realtime clock sampled together with `now` (see `realtimeNowNs`);
+///                        zero means "not available", and then `now` is returned.
+/// @param realtime_ns The kernel timestamp; zero means "not available", and then `now` is returned.
+///
+inline libcyphal::TimePoint fromKernelTimestamp(const libcyphal::TimePoint now,
+                                                const std::uint64_t        now_realtime_ns,
+                                                const std::uint64_t        realtime_ns)
+{
+    if ((realtime_ns == 0) || (now_realtime_ns <= realtime_ns))
+    {
+        return now;
+    }
+    const std::chrono::nanoseconds age{now_realtime_ns - realtime_ns};
+    return now - std::chrono::duration_cast<libcyphal::Duration>(age);
+}
+
+}  // namespace platform
+}  // namespace engine
+}  // namespace daemon
+}  // namespace ocvsmd
+
+#endif  // OCVSMD_DAEMON_ENGINE_PLATFORM_KERNEL_TIMESTAMP_HPP_INCLUDED
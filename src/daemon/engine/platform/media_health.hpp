@@ -0,0 +1,192 @@
+//
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#ifndef OCVSMD_DAEMON_ENGINE_PLATFORM_MEDIA_HEALTH_HPP_INCLUDED
+#define OCVSMD_DAEMON_ENGINE_PLATFORM_MEDIA_HEALTH_HPP_INCLUDED
+
+#include <libcyphal/types.hpp>
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace ocvsmd
+{
+namespace daemon
+{
+namespace engine
+{
+namespace platform
+{
+
+/// Tracks health of a single (potentially redundant) transport media.
+///
+/// Media is considered "down" after a link-level error (see `isLinkError`); other errors are just counted.
+/// A down media is probed (f.e. reopened) with exponential backoff - from `minBackoff()` up to `maxBackoff()`.
+/// Any successful RX or TX brings the media back "up", and resets the backoff.
+///
+/// Not thread-safe - in use on the engine thread only.
+///
+class MediaHealth final
+{
+public:
+    static constexpr libcyphal::Duration minBackoff() noexcept
+    {
+        return std::chrono::milliseconds{100};
+    }
+    static constexpr libcyphal::Duration maxBackoff() noexcept
+    {
+        return std::chrono::milliseconds{5000};
+    }
+
+    /// Defines a point-in-time copy of the health state - f.e. to be reported over IPC.
+    ///
+    struct Snapshot
+    {
+        bool                 is_up;
+        std::uint64_t        rx_frames;
+        std::uint64_t        tx_frames;
+        std::uint64_t        rx_errors;
+        std::uint64_t        rx_kernel_drops;  ///< Frames dropped by the kernel (of all sockets, incl. closed ones).
+        std::uint64_t        tx_errors;
+        std::uint64_t        tx_skipped;
+        std::uint64_t        reopens;
+        int                  last_error;
+        libcyphal::TimePoint last_rx_time;  ///< Default (epoch) value means "never received".
+    };
+
+    /// Checks whether the given (positive `errno`) error means that the link itself is unusable.
+    ///
+    static bool isLinkError(const int error_code) noexcept
+    {
+        switch (error_code)
+        {
+        case ENETDOWN:
+        case ENETUNREACH:
+        case ENODEV:
+        case ENXIO:
+        case EADDRNOTAVAIL:
+        case EBADF:
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    bool isUp() const noexcept
+    {
+        return is_up_;
+    }
+
+    /// Checks whether it's time to probe (reopen, retry, etc.) a down media.
+    ///
+    bool isProbeDue(const libcyphal::TimePoint now) const noexcept
+    {
+        return !is_up_ && (now >= next_probe_time_);
+    }
+
+    libcyphal::TimePoint nextProbeTime() const noexcept
+    {
+        return next_probe_time_;
+    }
+
+    void noteRx(const libcyphal::TimePoint now, const std::size_t frames = 1) noexcept
+    {
+        snapshot_.rx_frames += frames;
+        snapshot_.last_rx_time = now;
+        markUp();
+    }
+
+    void noteTx(const std::size_t frames = 1) noexcept
+    {
+        snapshot_.tx_frames += frames;
+        markUp();
+    }
+
+    void noteKernelDrops(const std::uint64_t frames) noexcept
+    {
+        snapshot_.rx_kernel_drops += frames;
+    }
+
+    void noteTxSkipped() noexcept
+    {
+        ++snapshot_.tx_skipped;
+    }
+
+    /// Counts the given RX or TX error.
+    ///
+    /// @return `true` if this error has just brought the media down.
+    ///
+    bool noteError(const libcyphal::TimePoint now, const int error_code, const bool is_tx) noexcept
+    {
+        ++(is_tx ? snapshot_.tx_errors : snapshot_.rx_errors);
+        snapshot_.last_error = error_code;
+
+        if (!is_up_ || !isLinkError(error_code))
+        {
+            return false;
+        }
+        is_up_           = false;
+        backoff_         = minBackoff();
+        next_probe_time_ = now + backoff_;
+        return true;
+    }
+
+    /// Notes result of a down media probe.
+    ///
+    /// Success (optimistically) brings the media up - the next link error will bring it down again.
+    /// Failure doubles the backoff till the next probe.
+    ///
+    void noteProbe(const libcyphal::TimePoint now, const bool success) noexcept
+    {
+        if (success)
+        {
+            ++snapshot_.reopens;
+            markUp();
+            return;
+        }
+        backoff_         = std::min(backoff_ * 2, maxBackoff());
+        next_probe_time_ = now + backoff_;
+    }
+
+    Snapshot snapshot() const noexcept
+    {
+        Snapshot result = snapshot_;
+        result.is_up    = is_up_;
+        return result;
+    }
+
+private:
+    void markUp() noexcept
+    {
+        is_up_   = true;
+        backoff_ = minBackoff();
+    }
+
+    bool                 is_up_{true};
+    libcyphal::Duration  backoff_{minBackoff()};
+    libcyphal::TimePoint next_probe_time_{};
+    Snapshot             snapshot_{};
+
+};  // MediaHealth
+
+/// Defines health report of a single media of a transport.
+///
+struct MediaHealthReport
+{
+    std::string           iface_address;
+    MediaHealth::Snapshot health;
+
+};  // MediaHealthReport
+
+}  // namespace platform
+}  // namespace engine
+}  // namespace daemon
+}  // namespace ocvsmd
+
+#endif  // OCVSMD_DAEMON_ENGINE_PLATFORM_MEDIA_HEALTH_HPP_INCLUDED
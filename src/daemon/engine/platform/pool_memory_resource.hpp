@@ -0,0 +1,254 @@
+//
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#ifndef OCVSMD_DAEMON_ENGINE_PLATFORM_POOL_MEMORY_RESOURCE_HPP_INCLUDED
+#define OCVSMD_DAEMON_ENGINE_PLATFORM_POOL_MEMORY_RESOURCE_HPP_INCLUDED
+
+#include "fixed_block_memory_resource.hpp"
+
+#include <cetl/cetl.hpp>
+#include <cetl/pf17/cetlpf.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <vector>
+
+namespace ocvsmd
+{
+namespace daemon
+{
+namespace engine
+{
+namespace platform
+{
+
+/// @brief Defines memory resource which serves allocations from several size classes of fixed-size blocks.
+///
+/// Each size class is a `FixedBlockMemoryResource` pool; an allocation is served by the smallest class
+/// which fits it, and requests bigger than the biggest class are forwarded to the upstream as is.
+/// Classes could be preallocated (see `reserve`), so that steady state traffic never reaches the upstream.
+///
+/// Deallocation is routed by the block ownership (rather than by the given size) - so, like with
+/// `FixedBlockMemoryResource`, a block could be freed by any size up to its class size.
+/// The owner is found by a binary search in the address sorted index of chunks of all classes
+/// (so free is O(log chunks) regardless of number of classes). The index is updated only when a class grows.
+///
+/// Not thread-safe - in use on the engine thread only.
+///
+class PoolMemoryResource final : public cetl::pmr::memory_resource
+{
+public:
+    /// @param upstream Memory resource for chunks of blocks, and for oversized allocations.
+    /// @param block_sizes Sizes of the classes (in any order; duplicates and zeros are ignored).
+    /// @param blocks_per_chunk Number of blocks the pool of each class grows by.
+    ///
+    PoolMemoryResource(cetl::pmr::memory_resource& upstream,
+                       std::vector<std::size_t>    block_sizes,
+                       const std::size_t           blocks_per_chunk)
+        : upstream_{upstream}
+    {
+        std::sort(block_sizes.begin(), block_sizes.end());
+        block_sizes.erase(std::unique(block_sizes.begin(), block_sizes.end()), block_sizes.end());
+        for (const auto block_size : block_sizes)
+        {
+            if (block_size > 0)
+            {
+                classes_.push_back(
+                    std::make_unique<FixedBlockMemoryResource>(upstream, block_size, blocks_per_chunk));
+            }
+        }
+    }
+
+    ~PoolMemoryResource() override = default;
+
+    PoolMemoryResource(const PoolMemoryResource&)                = delete;
+    PoolMemoryResource(PoolMemoryResource&&) noexcept            = delete;
+    PoolMemoryResource& operator=(const PoolMemoryResource&)     = delete;
+    PoolMemoryResource& operator=(PoolMemoryResource&&) noexcept = delete;
+
+    /// Preallocates (at least) the given number of blocks in each size class.
+    ///
+    /// @return `false` if the upstream has failed to provide the memory.
+    ///
+    bool reserve(const std::size_t blocks_per_class)
+    {
+        const bool result =
+            std::all_of(classes_.cbegin(), classes_.cend(), [blocks_per_class](const auto& size_class) {
+                //
+                return size_class->reserve(blocks_per_class);
+            });
+        rebuildOwnerIndex();
+        return result;
+    }
+
+    /// Pre-faults memory of all size classes allocated so far (see `FixedBlockMemoryResource::prefault`).
+    ///
+    void prefault() const noexcept
+    {
+        for (const auto& size_class : classes_)
+        {
+            size_class->prefault();
+        }
+    }
+
+    /// Gets number of blocks currently in use (in all size classes).
+    ///
+    std::size_t usedBlocks() const noexcept
+    {
+        std::size_t result = 0;
+        for (const auto& size_class : classes_)
+        {
+            result += size_class->usedBlocks();
+        }
+        return result;
+    }
+
+    /// Gets number of blocks allocated so far from the upstream (in all size classes).
+    ///
+    std::size_t totalBlocks() const noexcept
+    {
+        std::size_t result = 0;
+        for (const auto& size_class : classes_)
+        {
+            result += size_class->totalBlocks();
+        }
+        return result;
+    }
+
+private:
+    /// Defines address range of a chunk, and the size class it belongs to.
+    ///
+    struct ChunkRange
+    {
+        const cetl::byte*         begin;
+        const cetl::byte*         end;
+        FixedBlockMemoryResource* owner;
+    };
+
+    FixedBlockMemoryResource* findClassOf(const std::size_t size_bytes, const std::size_t alignment) const noexcept
+    {
+        if (alignment > alignof(std::max_align_t))
+        {
+            return nullptr;
+        }
+        const auto it = std::find_if(classes_.cbegin(), classes_.cend(), [size_bytes](const auto& size_class) {
+            //
+            return size_bytes <= size_class->blockSize();
+        });
+        return (it != classes_.cend()) ? it->get() : nullptr;
+    }
+
+    FixedBlockMemoryResource* findOwnerOf(const void* const ptr) const noexcept
+    {
+        const auto* const byte_ptr = static_cast<const cetl::byte*>(ptr);
+        const auto        it       = std::upper_bound(  //
+            owner_index_.cbegin(),
+            owner_index_.cend(),
+            byte_ptr,
+            [](const cetl::byte* const lhs, const ChunkRange& rhs) { return std::less<>{}(lhs, rhs.begin); });
+        if (it == owner_index_.cbegin())
+        {
+            return nullptr;
+        }
+        const auto& range = *std::prev(it);
+        return std::less<>{}(byte_ptr, range.end) ? range.owner : nullptr;
+    }
+
+    void rebuildOwnerIndex()
+    {
+        owner_index_.clear();
+        for (const auto& size_class : classes_)
+        {
+            for (const auto* const chunk : size_class->chunks())
+            {
+                // NOLINTNEXTLINE(*-pointer-arithmetic)
+                owner_index_.push_back({chunk, chunk + size_class->chunkSize(), size_class.get()});
+            }
+        }
+        std::sort(owner_index_.begin(), owner_index_.end(), [](const ChunkRange& lhs, const ChunkRange& rhs) {
+            //
+            return std::less<>{}(lhs.begin, rhs.begin);
+        });
+    }
+
+    // MARK: cetl::pmr::memory_resource
+
+    void* do_allocate(const std::size_t size_bytes, const std::size_t alignment) override
+    {
+        if (auto* const size_class = findClassOf(size_bytes, alignment))
+        {
+            const auto  total_blocks = size_class->totalBlocks();
+            void* const ptr          = size_class->allocate(size_bytes, alignment);
+            if (size_class->totalBlocks() != total_blocks)
+            {
+                rebuildOwnerIndex();  // The class has grown by a new chunk.
+            }
+            return ptr;
+        }
+        return upstream_.allocate(size_bytes, alignment);
+    }
+
+    void do_deallocate(void* const ptr, const std::size_t size_bytes, const std::size_t alignment) override
+    {
+        if (ptr == nullptr)
+        {
+            return;
+        }
+        if (auto* const size_class = findOwnerOf(ptr))
+        {
+            size_class->deallocate(ptr, size_bytes, alignment);
+            return;
+        }
+        upstream_.deallocate(ptr, size_bytes, alignment);
+    }
+
+#if (__cplusplus < CETL_CPP_STANDARD_17)
+
+    void* do_reallocate(void* const       ptr,
+                        const std::size_t old_size_bytes,
+                        const std::size_t new_size_bytes,
+                        const std::size_t alignment) override
+    {
+        if (ptr != nullptr)
+        {
+            const auto* const size_class = findOwnerOf(ptr);
+            if ((size_class != nullptr) && (size_class == findClassOf(new_size_bytes, alignment)))
+            {
+                return ptr;
+            }
+        }
+
+        void* const new_ptr = do_allocate(new_size_bytes, alignment);
+        if ((new_ptr != nullptr) && (ptr != nullptr))
+        {
+            (void) std::memcpy(new_ptr, ptr, std::min(old_size_bytes, new_size_bytes));
+            do_deallocate(ptr, old_size_bytes, alignment);
+        }
+        return new_ptr;
+    }
+
+#endif
+
+    bool do_is_equal(const cetl::pmr::memory_resource& rhs) const noexcept override
+    {
+        return (&rhs == this);
+    }
+
+    cetl::pmr::memory_resource&                            upstream_;
+    std::vector<std::unique_ptr<FixedBlockMemoryResource>> classes_;
+    std::vector<ChunkRange>                                owner_index_;
+
+};  // PoolMemoryResource
+
+}  // namespace platform
+}  // namespace engine
+}  // namespace daemon
+}  // namespace ocvsmd
+
+#endif  // OCVSMD_DAEMON_ENGINE_PLATFORM_POOL_MEMORY_RESOURCE_HPP_INCLUDED
@@ -0,0 +1,95 @@
+//
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#ifndef OCVSMD_DAEMON_ENGINE_PLATFORM_RUNTIME_STATUS_HPP_INCLUDED
+#define OCVSMD_DAEMON_ENGINE_PLATFORM_RUNTIME_STATUS_HPP_INCLUDED
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <sched.h>
+#include <string>
+#include <sys/resource.h>
+#include <vector>
+
+namespace ocvsmd
+{
+namespace daemon
+{
+namespace engine
+{
+namespace platform
+{
+
+/// Defines the achieved real-time settings of the calling thread (and of its process) - see `[runtime]`.
+///
+/// Settings are queried from the OS (rather than taken from the configuration) - so that whatever
+/// has actually been granted (f.e. without `CAP_SYS_NICE` or with a low `RLIMIT_MEMLOCK`) is reported.
+///
+struct RuntimeStatus
+{
+    int                      sched_policy{SCHED_OTHER};
+    int                      sched_priority{0};
+    std::vector<std::size_t> cpu_affinity;     ///< CPUs the thread may run on (empty if unknown).
+    std::uint64_t            locked_bytes{0};  ///< Locked memory of the process (`VmLck`; linux only).
+    std::uint64_t            minor_faults{0};  ///< Page faults of the process so far (w/o I/O).
+    std::uint64_t            major_faults{0};  ///< Page faults of the process so far (with I/O).
+
+    static RuntimeStatus query()
+    {
+        RuntimeStatus status;
+
+        status.sched_policy = ::sched_getscheduler(0);
+        sched_param param{};
+        if (::sched_getparam(0, &param) == 0)
+        {
+            status.sched_priority = param.sched_priority;
+        }
+
+#ifndef PLATFORM_OS_TYPE_BSD
+        cpu_set_t cpu_set;
+        CPU_ZERO(&cpu_set);
+        if (::sched_getaffinity(0, sizeof(cpu_set), &cpu_set) == 0)
+        {
+            for (std::size_t cpu = 0; cpu < CPU_SETSIZE; ++cpu)
+            {
+                if (CPU_ISSET(cpu, &cpu_set))
+                {
+                    status.cpu_affinity.push_back(cpu);
+                }
+            }
+        }
+
+        std::ifstream proc_status{"/proc/self/status"};
+        std::string   line;
+        while (std::getline(proc_status, line))
+        {
+            static const std::string vm_lck_prefix = "VmLck:";
+            if (0 == line.compare(0, vm_lck_prefix.size(), vm_lck_prefix))
+            {
+                constexpr std::uint64_t KiB = 1024;
+                status.locked_bytes         = std::stoull(line.substr(vm_lck_prefix.size())) * KiB;
+                break;
+            }
+        }
+#endif
+
+        rusage usage{};
+        if (::getrusage(RUSAGE_SELF, &usage) == 0)
+        {
+            status.minor_faults = static_cast<std::uint64_t>(usage.ru_minflt);
+            status.major_faults = static_cast<std::uint64_t>(usage.ru_majflt);
+        }
+        return status;
+    }
+
+};  // RuntimeStatus
+
+}  // namespace platform
+}  // namespace engine
+}  // namespace daemon
+}  // namespace ocvsmd
+
+#endif  // OCVSMD_DAEMON_ENGINE_PLATFORM_RUNTIME_STATUS_HPP_INCLUDED
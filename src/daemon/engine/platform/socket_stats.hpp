@@ -0,0 +1,196 @@
+//
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#ifndef OCVSMD_DAEMON_ENGINE_PLATFORM_SOCKET_STATS_HPP_INCLUDED
+#define OCVSMD_DAEMON_ENGINE_PLATFORM_SOCKET_STATS_HPP_INCLUDED
+
+#include <cetl/pf17/cetlpf.hpp>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace ocvsmd
+{
+namespace daemon
+{
+namespace engine
+{
+namespace platform
+{
+
+/// Defines requested sizes of the kernel buffers of media sockets.
+///
+/// They are given per interface - as `rcvbuf=<bytes>` and `sndbuf=<bytes>` parameters of the interface address
+/// (f.e. 'udp://127.0.0.1?rcvbuf=1048576' or 'socketcan:can0?fd=1&rcvbuf=262144').
+/// Zero means the system default. Note that the kernel caps them by `net.core.rmem_max`/`wmem_max`.
+///
+/// RX sockets of UDP media may also busy poll the device queue for the given time on reception -
+/// see `busy_poll=<microseconds>` parameter (`SO_BUSY_POLL`); zero (default) disables it.
+///
+struct SocketBufferSizes
+{
+    std::size_t rcvbuf{0};
+    std::size_t sndbuf{0};
+    std::size_t busy_poll{0};
+
+    /// Parses a single `key=value` parameter of an interface address.
+    ///
+    /// @return `false` if it's not a supported parameter (or its value is not a number).
+    ///
+    bool parseParam(const cetl::string_view param)
+    {
+        const auto eq_pos = param.find('=');
+        if (eq_pos == cetl::string_view::npos)
+        {
+            return false;
+        }
+        const auto key = param.substr(0, eq_pos);
+
+        std::size_t* const target = (key == cetl::string_view{"rcvbuf"})      ? &rcvbuf
+                                    : (key == cetl::string_view{"sndbuf"})    ? &sndbuf
+                                    : (key == cetl::string_view{"busy_poll"}) ? &busy_poll
+                                                                              : nullptr;
+        if (target == nullptr)
+        {
+            return false;
+        }
+
+        const auto  value_sv = param.substr(eq_pos + 1);
+        std::string value{value_sv.data(), value_sv.size()};
+        char*       end = nullptr;
+        errno           = 0;
+        const auto size = std::strtoull(value.c_str(), &end, 10);  // NOLINT(*-magic-numbers)
+        if (value.empty() || (end != value.c_str() + value.size()) || (errno != 0))
+        {
+            return false;
+        }
+        *target = static_cast<std::size_t>(size);
+        return true;
+    }
+
+};  // SocketBufferSizes
+
+/// Defines statistics of a single system socket of a media.
+///
+struct SocketStats
+{
+    std::string   endpoint;            ///< F.e. 'tx', or multicast group of UDP RX socket ('239.0.0.1:9382').
+    bool          is_rx;               ///< RX socket (vs TX one).
+    std::size_t   buffer_size;         ///< Effective size of kernel `SO_RCVBUF` (`SO_SNDBUF`) buffer; 0 if unknown.
+    std::uint64_t kernel_drops;        ///< Frames (datagrams) dropped by the kernel b/c of full receive buffer.
+    std::uint32_t last_drops_counter;  ///< The last seen value of the kernel counter (see `noteKernelDrops`).
+
+    /// Updates kernel drops by the cumulative (wrapping) 32-bit counter of the socket (see `SO_RXQ_OVFL`).
+    ///
+    /// @return Number of frames dropped since the previous update.
+    ///
+    std::uint32_t noteKernelDrops(const std::uint32_t counter) noexcept
+    {
+        const std::uint32_t delta = counter - last_drops_counter;
+        last_drops_counter        = counter;
+        kernel_drops += delta;
+        return delta;
+    }
+
+};  // SocketStats
+
+/// Defines registry of live sockets of a media - so that their stats could be reported.
+///
+/// Sockets are owned by libcyphal, so each one registers itself via `Entry` member.
+/// Not thread-safe - in use on the engine thread only.
+///
+class SocketStatsRegistry final
+{
+public:
+    /// Defines registration (and stats) of a single socket.
+    ///
+    class Entry final
+    {
+    public:
+        Entry(SocketStatsRegistry& registry, std::string endpoint, const bool is_rx)
+            : registry_{registry}
+            , stats_{std::move(endpoint), is_rx, 0, 0, 0}
+        {
+            registry_.entries_.push_back(this);
+        }
+
+        ~Entry()
+        {
+            auto& entries = registry_.entries_;
+            entries.erase(std::remove(entries.begin(), entries.end(), this), entries.end());
+        }
+
+        Entry(const Entry&)                = delete;
+        Entry(Entry&&) noexcept            = delete;
+        Entry& operator=(const Entry&)     = delete;
+        Entry& operator=(Entry&&) noexcept = delete;
+
+        SocketStats& stats() noexcept
+        {
+            return stats_;
+        }
+
+        const SocketStats& stats() const noexcept
+        {
+            return stats_;
+        }
+
+    private:
+        SocketStatsRegistry& registry_;
+        SocketStats          stats_;
+
+    };  // Entry
+
+    SocketStatsRegistry() = default;
+
+    SocketStatsRegistry(const SocketStatsRegistry&)                = delete;
+    SocketStatsRegistry(SocketStatsRegistry&&) noexcept            = delete;
+    SocketStatsRegistry& operator=(const SocketStatsRegistry&)     = delete;
+    SocketStatsRegistry& operator=(SocketStatsRegistry&&) noexcept = delete;
+
+    ~SocketStatsRegistry() = default;
+
+    std::size_t size() const noexcept
+    {
+        return entries_.size();
+    }
+
+    std::vector<SocketStats> snapshot() const
+    {
+        std::vector<SocketStats> result;
+        result.reserve(entries_.size());
+        for (const auto* const entry : entries_)
+        {
+            result.push_back(entry->stats());
+        }
+        return result;
+    }
+
+private:
+    std::vector<const Entry*> entries_;
+
+};  // SocketStatsRegistry
+
+/// Defines sockets report of a single media of a transport.
+///
+struct MediaSocketsReport
+{
+    std::string              iface_address;
+    std::vector<SocketStats> sockets;
+
+};  // MediaSocketsReport
+
+}  // namespace platform
+}  // namespace engine
+}  // namespace daemon
+}  // namespace ocvsmd
+
+#endif  // OCVSMD_DAEMON_ENGINE_PLATFORM_SOCKET_STATS_HPP_INCLUDED
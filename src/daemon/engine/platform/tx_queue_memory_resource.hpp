@@ -0,0 +1,179 @@
+//
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#ifndef OCVSMD_DAEMON_ENGINE_PLATFORM_TX_QUEUE_MEMORY_RESOURCE_HPP_INCLUDED
+#define OCVSMD_DAEMON_ENGINE_PLATFORM_TX_QUEUE_MEMORY_RESOURCE_HPP_INCLUDED
+
+#include <cetl/cetl.hpp>
+#include <cetl/pf17/cetlpf.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace ocvsmd
+{
+namespace daemon
+{
+namespace engine
+{
+namespace platform
+{
+
+/// @brief Defines memory resource of transport TX queues - it tracks (and optionally limits) depth of the queues.
+///
+/// Every frame queued for transmission (by any media of a transport) holds one allocation of its payload
+/// (see `IMedia::getTxMemoryResource`), so the number of live allocations is the total depth of the TX queues.
+///
+/// In the fixed mode, depth is limited by libcyphal itself (by its TX queue capacity), and the resource only
+/// tracks it. In the adaptive mode, libcyphal is given practically unlimited capacity, and the resource limits
+/// depth instead: initially to the base capacity; on burst (when the limit is reached) the limit is doubled,
+/// as long as queued bytes fit the memory cap; once the queues are drained, the limit goes back to the base one.
+/// An allocation beyond the limit fails, and libcyphal reports it as a TX failure (see `noteOverflow`).
+///
+/// Not thread-safe - in use on the engine thread only.
+///
+class TxQueueMemoryResource final : public cetl::pmr::memory_resource
+{
+public:
+    struct Stats
+    {
+        bool          is_adaptive;
+        std::size_t   capacity;   ///< Current limit of the total depth (in frames).
+        std::size_t   depth;      ///< Current total depth (in frames).
+        std::size_t   depth_hwm;  ///< High-water mark of the total depth.
+        std::size_t   bytes;
+        std::size_t   bytes_hwm;
+        std::uint64_t overflows;
+        std::uint64_t grows;
+    };
+
+    explicit TxQueueMemoryResource(cetl::pmr::memory_resource& upstream)
+        : upstream_{upstream}
+    {
+    }
+
+    ~TxQueueMemoryResource() override = default;
+
+    TxQueueMemoryResource(const TxQueueMemoryResource&)                = delete;
+    TxQueueMemoryResource(TxQueueMemoryResource&&) noexcept            = delete;
+    TxQueueMemoryResource& operator=(const TxQueueMemoryResource&)     = delete;
+    TxQueueMemoryResource& operator=(TxQueueMemoryResource&&) noexcept = delete;
+
+    /// Sets limits of the queues.
+    ///
+    /// @param capacity Total capacity (in frames) of all TX queues of the transport.
+    /// @param adaptive Whether the capacity is grown under burst (see class description).
+    /// @param memory_cap Max total bytes of queued frames (in use by the adaptive mode only).
+    ///
+    void configure(const std::size_t capacity, const bool adaptive, const std::size_t memory_cap) noexcept
+    {
+        base_capacity_     = std::max<std::size_t>(capacity, 1);
+        memory_cap_        = memory_cap;
+        stats_.is_adaptive = adaptive;
+        stats_.capacity    = base_capacity_;
+    }
+
+    /// Counts a frame which didn't fit into a TX queue (as reported by libcyphal).
+    ///
+    void noteOverflow() noexcept
+    {
+        ++stats_.overflows;
+    }
+
+    Stats getStats() const noexcept
+    {
+        return stats_;
+    }
+
+private:
+    CETL_NODISCARD bool reserve(const std::size_t size_bytes) noexcept
+    {
+        if ((stats_.bytes + size_bytes) > memory_cap_)
+        {
+            return false;
+        }
+        if (stats_.depth >= stats_.capacity)
+        {
+            stats_.capacity *= 2;
+            ++stats_.grows;
+        }
+        return true;
+    }
+
+    // MARK: cetl::pmr::memory_resource
+
+    void* do_allocate(const std::size_t size_bytes, const std::size_t alignment) override
+    {
+        if (stats_.is_adaptive && !reserve(size_bytes))
+        {
+            return nullptr;
+        }
+
+        void* const ptr = upstream_.allocate(size_bytes, alignment);
+        if (ptr != nullptr)
+        {
+            ++stats_.depth;
+            stats_.bytes += size_bytes;
+            stats_.depth_hwm = std::max(stats_.depth_hwm, stats_.depth);
+            stats_.bytes_hwm = std::max(stats_.bytes_hwm, stats_.bytes);
+        }
+        return ptr;
+    }
+
+    void do_deallocate(void* const ptr, const std::size_t size_bytes, const std::size_t alignment) override
+    {
+        if (ptr == nullptr)
+        {
+            return;
+        }
+        upstream_.deallocate(ptr, size_bytes, alignment);
+
+        CETL_DEBUG_ASSERT(stats_.depth > 0, "");
+        --stats_.depth;
+        stats_.bytes -= std::min(stats_.bytes, size_bytes);
+        if (stats_.depth == 0)
+        {
+            stats_.capacity = base_capacity_;
+        }
+    }
+
+#if (__cplusplus < CETL_CPP_STANDARD_17)
+
+    void* do_reallocate(void* const       ptr,
+                        const std::size_t old_size_bytes,
+                        const std::size_t new_size_bytes,
+                        const std::size_t alignment) override
+    {
+        void* const new_ptr = do_allocate(new_size_bytes, alignment);
+        if ((new_ptr != nullptr) && (ptr != nullptr))
+        {
+            (void) std::memcpy(new_ptr, ptr, std::min(old_size_bytes, new_size_bytes));
+            do_deallocate(ptr, old_size_bytes, alignment);
+        }
+        return new_ptr;
+    }
+
+#endif
+
+    bool do_is_equal(const cetl::pmr::memory_resource& rhs) const noexcept override
+    {
+        return (&rhs == this);
+    }
+
+    cetl::pmr::memory_resource& upstream_;
+    std::size_t                 base_capacity_{1};
+    std::size_t                 memory_cap_{0};
+    Stats                       stats_{};
+
+};  // TxQueueMemoryResource
+
+}  // namespace platform
+}  // namespace engine
+}  // namespace daemon
+}  // namespace ocvsmd
+
+#endif  // OCVSMD_DAEMON_ENGINE_PLATFORM_TX_QUEUE_MEMORY_RESOURCE_HPP_INCLUDED
@@ -3,20 +3,32 @@
 // SPDX-License-Identifier: MIT
 //
 
-#include "udp.h"
-
+// Feature test macros must precede any system header (including the ones pulled by "udp.h").
 /// Enable SO_REUSEPORT.
 #ifndef _DEFAULT_SOURCE
 #    define _DEFAULT_SOURCE  // NOLINT(bugprone-reserved-identifier,cert-dcl37-c,cert-dcl51-cpp)
 #endif
+/// Enable `recvmmsg`, `sendmmsg` and `struct in_pktinfo`.
+#ifndef _GNU_SOURCE
+#    define _GNU_SOURCE  // NOLINT(bugprone-reserved-identifier,cert-dcl37-c,cert-dcl51-cpp)
+#endif
+
+#include "udp.h"
 
 #include <fcntl.h>
 #include <arpa/inet.h>
+#include <netinet/in.h>
 #include <sys/socket.h>
 #include <unistd.h>
 #include <poll.h>
 #include <errno.h>
 #include <limits.h>
+#include <string.h>
+#include <sys/uio.h>
+#include <time.h>
+
+/// The size of the ancillary data buffer of a single received datagram (enough for the RX timestamp and packet info).
+#define RX_CONTROL_SIZE 128U
 
 /// This is the value recommended by the Cyphal/UDP specification.
 #define OVERRIDE_TTL 16
@@ -29,12 +41,59 @@ static bool isMulticast(const uint32_t address)
     return (address & 0xF0000000UL) == 0xE0000000UL;  // NOLINT(*-magic-numbers)
 }
 
+static bool areValidTxDatagrams(const size_t count, const UDPTxDatagram* const datagrams)
+{
+    bool ok = (datagrams != NULL) && (count > 0);
+    for (size_t idx = 0; ok && (idx < count); idx++)
+    {
+        const UDPTxDatagram* const datagram = &datagrams[idx];
+        ok = (datagram->remote_address > 0) && (datagram->remote_port > 0) && (datagram->payload != NULL);
+    }
+    return ok;
+}
+
+/// Sets (unless zero) and then reads back the socket buffer size option (`SO_RCVBUF` or `SO_SNDBUF`).
+static int16_t setBufferSize(const int fd, const int option, const size_t size, size_t* const out_size)
+{
+    int16_t res = -EINVAL;
+    if ((fd >= 0) && (size <= (size_t) INT_MAX))
+    {
+        const int size_int = (int) size;
+        res                = 0;
+        if ((size > 0) && (setsockopt(fd, SOL_SOCKET, option, &size_int, sizeof(size_int)) != 0))
+        {
+            res = (int16_t) -errno;
+        }
+        int       effective_size = 0;
+        socklen_t optlen         = sizeof(effective_size);
+        if ((res == 0) && (out_size != NULL) && (getsockopt(fd, SOL_SOCKET, option, &effective_size, &optlen) == 0))
+        {
+            *out_size = (size_t) effective_size;
+        }
+    }
+    return res;
+}
+
+/// Applies the DSCP value to the socket unless it is already applied.
+static void applyDscp(UDPTxHandle* const self, const uint8_t dscp)
+{
+    if (self->dscp != dscp)
+    {
+        const int dscp_int = dscp << 2U;  // The 2 least significant bits are used for the ECN field.
+        if (setsockopt(self->fd, IPPROTO_IP, IP_TOS, &dscp_int, sizeof(dscp_int)) == 0)  // Best effort.
+        {
+            self->dscp = dscp;
+        }
+    }
+}
+
 int16_t udpTxInit(UDPTxHandle* const self, const uint32_t local_iface_address)
 {
     int16_t res = -EINVAL;
     if ((self != NULL) && (local_iface_address > 0))
     {
         self->fd                 = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+        self->dscp               = 0;  // The default TOS of a new socket.
         uint32_t  local_iface_be = htonl(local_iface_address);
         const int ttl            = OVERRIDE_TTL;
         bool      ok             = self->fd >= 0;
@@ -75,8 +134,7 @@ int16_t udpTxSend(UDPTxHandle* const self,
     if ((self != NULL) && (self->fd >= 0) && (remote_address > 0) && (remote_port > 0) && (payload != NULL) &&
         (dscp <= DSCP_MAX))
     {
-        const int dscp_int = dscp << 2U;  // The 2 least significant bits are used for the ECN field.
-        (void) setsockopt(self->fd, IPPROTO_IP, IP_TOS, &dscp_int, sizeof(dscp_int));  // Best effort.
+        applyDscp(self, dscp);
         const ssize_t send_result =
             sendto(self->fd,
                    payload,
@@ -102,6 +160,75 @@ int16_t udpTxSend(UDPTxHandle* const self,
     return res;
 }
 
+int16_t udpTxSendBatch(UDPTxHandle* const         self,
+                       const uint8_t              dscp,
+                       const size_t               count,
+                       const UDPTxDatagram* const datagrams)
+{
+    int16_t res = -EINVAL;
+    const size_t batch_count = (count > UDP_TX_BATCH_MAX) ? UDP_TX_BATCH_MAX : count;
+    if ((self != NULL) && (self->fd >= 0) && areValidTxDatagrams(batch_count, datagrams) && (dscp <= DSCP_MAX))
+    {
+        applyDscp(self, dscp);
+#ifdef __linux__
+        struct sockaddr_in addrs[UDP_TX_BATCH_MAX];
+        struct iovec       iovs[UDP_TX_BATCH_MAX];
+        struct mmsghdr     msgs[UDP_TX_BATCH_MAX];
+        (void) memset(addrs, 0, sizeof(addrs[0]) * batch_count);
+        (void) memset(msgs, 0, sizeof(msgs[0]) * batch_count);
+        for (size_t idx = 0; idx < batch_count; idx++)
+        {
+            addrs[idx].sin_family         = AF_INET;
+            addrs[idx].sin_addr.s_addr    = htonl(datagrams[idx].remote_address);
+            addrs[idx].sin_port           = htons(datagrams[idx].remote_port);
+            iovs[idx].iov_base            = (void*) datagrams[idx].payload;
+            iovs[idx].iov_len             = datagrams[idx].payload_size;
+            msgs[idx].msg_hdr.msg_name    = &addrs[idx];
+            msgs[idx].msg_hdr.msg_namelen = sizeof(addrs[idx]);
+            msgs[idx].msg_hdr.msg_iov     = &iovs[idx];
+            msgs[idx].msg_hdr.msg_iovlen  = 1;
+        }
+        const int send_result = sendmmsg(self->fd, msgs, (unsigned int) batch_count, MSG_DONTWAIT);
+        if (send_result >= 0)
+        {
+            res = (int16_t) send_result;
+        }
+        else if ((errno == EAGAIN) || (errno == EWOULDBLOCK))
+        {
+            res = 0;
+        }
+        else
+        {
+            res = (int16_t) -errno;
+        }
+#else
+        res = 0;
+        for (size_t idx = 0; idx < batch_count; idx++)
+        {
+            const int16_t one_result = udpTxSend(self,
+                                                 datagrams[idx].remote_address,
+                                                 datagrams[idx].remote_port,
+                                                 dscp,
+                                                 datagrams[idx].payload_size,
+                                                 datagrams[idx].payload);
+            if (one_result <= 0)
+            {
+                // Report an error only if nothing has been sent so far.
+                res = (res > 0) ? res : one_result;
+                break;
+            }
+            res++;
+        }
+#endif
+    }
+    return res;
+}
+
+int16_t udpTxSetBufferSize(UDPTxHandle* const self, const size_t size, size_t* const out_size)
+{
+    return (self != NULL) ? setBufferSize(self->fd, SO_SNDBUF, size, out_size) : -EINVAL;
+}
+
 void udpTxClose(UDPTxHandle* const self)
 {
     if ((self != NULL) && (self->fd >= 0))
@@ -121,6 +248,7 @@ int16_t udpRxInit(UDPRxHandle* const self,
     {
         const int reuse = 1;
         self->fd        = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+        self->drops     = 0;
         bool ok         = self->fd >= 0;
         // Set non-blocking mode.
         ok = ok && (fcntl(self->fd, F_SETFL, O_NONBLOCK) == 0);
@@ -162,6 +290,132 @@ int16_t udpRxInit(UDPRxHandle* const self,
     return res;
 }
 
+int16_t udpRxInitShared(UDPRxHandle* const self, const uint32_t local_iface_address, const uint16_t remote_port)
+{
+    int16_t res = -EINVAL;
+    if ((self != NULL) && (local_iface_address > 0) && (remote_port > 0))
+    {
+        const int reuse = 1;
+        const int on    = 1;
+        self->fd        = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+        self->drops     = 0;
+        bool ok         = self->fd >= 0;
+        ok              = ok && (fcntl(self->fd, F_SETFL, O_NONBLOCK) == 0);
+        ok              = ok && (setsockopt(self->fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse)) == 0);
+#ifdef SO_REUSEPORT  // Linux
+        ok = ok && (setsockopt(self->fd, SOL_SOCKET, SO_REUSEPORT, &reuse, sizeof(reuse)) == 0);
+#endif
+#ifdef IP_MULTICAST_ALL  // Linux
+        // By default, a socket receives datagrams of all groups joined by any socket of the host.
+        const int off = 0;
+        ok            = ok && (setsockopt(self->fd, IPPROTO_IP, IP_MULTICAST_ALL, &off, sizeof(off)) == 0);
+#endif
+        // The destination (group) address of each datagram is needed for the demultiplexing.
+        ok = ok && (setsockopt(self->fd, IPPROTO_IP, IP_PKTINFO, &on, sizeof(on)) == 0);
+
+        const struct sockaddr_in bind_addr = {
+            .sin_family = AF_INET,
+            .sin_addr   = {.s_addr = INADDR_ANY},
+            .sin_port   = htons(remote_port),
+        };
+        ok = ok && (bind(self->fd, (struct sockaddr*) &bind_addr, sizeof(bind_addr)) == 0);
+        if (ok)
+        {
+            res = 0;
+        }
+        else
+        {
+            res = (int16_t) -errno;
+            (void) close(self->fd);
+            self->fd = -1;
+        }
+    }
+    return res;
+}
+
+static int16_t updateGroupMembership(UDPRxHandle* const self,
+                                     const int          option,
+                                     const uint32_t     local_iface_address,
+                                     const uint32_t     multicast_group)
+{
+    int16_t res = -EINVAL;
+    if ((self != NULL) && (self->fd >= 0) && (local_iface_address > 0) && isMulticast(multicast_group))
+    {
+        const struct in_addr tuple[2] = {{.s_addr = htonl(multicast_group)}, {.s_addr = htonl(local_iface_address)}};
+        res = (setsockopt(self->fd, IPPROTO_IP, option, &tuple[0], sizeof(tuple)) == 0) ? 0 : (int16_t) -errno;
+    }
+    return res;
+}
+
+int16_t udpRxJoinGroup(UDPRxHandle* const self, const uint32_t local_iface_address, const uint32_t multicast_group)
+{
+    return updateGroupMembership(self, IP_ADD_MEMBERSHIP, local_iface_address, multicast_group);
+}
+
+int16_t udpRxLeaveGroup(UDPRxHandle* const self, const uint32_t local_iface_address, const uint32_t multicast_group)
+{
+    return updateGroupMembership(self, IP_DROP_MEMBERSHIP, local_iface_address, multicast_group);
+}
+
+int16_t udpRxEnableTimestamps(UDPRxHandle* const self)
+{
+    int16_t res = -EINVAL;
+    if ((self != NULL) && (self->fd >= 0))
+    {
+#ifdef SO_TIMESTAMPNS
+        const int en = 1;
+        res          = (setsockopt(self->fd, SOL_SOCKET, SO_TIMESTAMPNS, &en, sizeof(en)) == 0) ? 0 : (int16_t) -errno;
+#else
+        res = -ENOSYS;
+#endif
+    }
+    return res;
+}
+
+int16_t udpRxSetBufferSize(UDPRxHandle* const self, const size_t size, size_t* const out_size)
+{
+    return (self != NULL) ? setBufferSize(self->fd, SO_RCVBUF, size, out_size) : -EINVAL;
+}
+
+int16_t udpRxEnableDropCounter(UDPRxHandle* const self)
+{
+    int16_t res = -EINVAL;
+    if ((self != NULL) && (self->fd >= 0))
+    {
+#ifdef SO_RXQ_OVFL
+        const int en = 1;
+        res          = (setsockopt(self->fd, SOL_SOCKET, SO_RXQ_OVFL, &en, sizeof(en)) == 0) ? 0 : (int16_t) -errno;
+#else
+        res = -ENOSYS;
+#endif
+    }
+    return res;
+}
+
+int16_t udpRxSetBusyPoll(UDPRxHandle* const self, const uint32_t usec)
+{
+    int16_t res = -EINVAL;
+    if ((self != NULL) && (self->fd >= 0) && (usec <= INT_MAX))
+    {
+#ifdef SO_BUSY_POLL
+        const int  busy_poll = (int) usec;
+        const bool ok        = setsockopt(self->fd, SOL_SOCKET, SO_BUSY_POLL, &busy_poll, sizeof(busy_poll)) == 0;
+        res                  = ok ? 0 : (int16_t) -errno;
+#    ifdef SO_PREFER_BUSY_POLL
+        // Best effort - the preference is not supported by older kernels (before 5.11).
+        const int prefer = (usec > 0) ? 1 : 0;
+        if (res == 0)
+        {
+            (void) setsockopt(self->fd, SOL_SOCKET, SO_PREFER_BUSY_POLL, &prefer, sizeof(prefer));
+        }
+#    endif
+#else
+        res = -ENOSYS;
+#endif
+    }
+    return res;
+}
+
 int16_t udpRxReceive(UDPRxHandle* const self, size_t* const inout_payload_size, void* const out_payload)
 {
     int16_t res = -EINVAL;
@@ -185,6 +439,96 @@ int16_t udpRxReceive(UDPRxHandle* const self, size_t* const inout_payload_size,
     return res;
 }
 
+int16_t udpRxReceiveBatch(UDPRxHandle* const self, const size_t count, UDPRxDatagram* const datagrams)
+{
+    int16_t res = -EINVAL;
+    if ((self != NULL) && (self->fd >= 0) && (datagrams != NULL) && (count > 0))
+    {
+        const size_t batch_count = (count > UDP_RX_BATCH_MAX) ? UDP_RX_BATCH_MAX : count;
+#ifdef __linux__
+        struct iovec   iovs[UDP_RX_BATCH_MAX];
+        struct mmsghdr msgs[UDP_RX_BATCH_MAX];
+        // The ancillary data buffers are wrapped in a union to ensure they are suitably aligned.
+        union
+        {
+            uint8_t        buf[RX_CONTROL_SIZE];
+            struct cmsghdr align;
+        } controls[UDP_RX_BATCH_MAX];
+        (void) memset(msgs, 0, sizeof(msgs[0]) * batch_count);
+        for (size_t idx = 0; idx < batch_count; idx++)
+        {
+            iovs[idx].iov_base               = datagrams[idx].payload;
+            iovs[idx].iov_len                = datagrams[idx].capacity;
+            msgs[idx].msg_hdr.msg_iov        = &iovs[idx];
+            msgs[idx].msg_hdr.msg_iovlen     = 1;
+            msgs[idx].msg_hdr.msg_control    = controls[idx].buf;
+            msgs[idx].msg_hdr.msg_controllen = sizeof(controls[idx].buf);
+        }
+        const int recv_result = recvmmsg(self->fd, msgs, (unsigned int) batch_count, MSG_DONTWAIT, NULL);
+        if (recv_result >= 0)
+        {
+            for (size_t idx = 0; idx < (size_t) recv_result; idx++)
+            {
+                datagrams[idx].size         = msgs[idx].msg_len;
+                datagrams[idx].timestamp_ns = 0;
+                datagrams[idx].dst_address  = 0;
+
+                struct cmsghdr* cmsg = CMSG_FIRSTHDR(&msgs[idx].msg_hdr);
+                while (cmsg != NULL)
+                {
+                    if ((cmsg->cmsg_level == SOL_SOCKET) && (cmsg->cmsg_type == SCM_TIMESTAMPNS))
+                    {
+                        struct timespec ts;
+                        (void) memcpy(&ts, CMSG_DATA(cmsg), sizeof(ts));  // Copy to avoid alignment problems
+                        datagrams[idx].timestamp_ns = ((uint64_t) ts.tv_sec * 1000000000ULL) + (uint64_t) ts.tv_nsec;
+                    }
+                    if ((cmsg->cmsg_level == IPPROTO_IP) && (cmsg->cmsg_type == IP_PKTINFO))
+                    {
+                        struct in_pktinfo info;
+                        (void) memcpy(&info, CMSG_DATA(cmsg), sizeof(info));  // Copy to avoid alignment problems
+                        datagrams[idx].dst_address = ntohl(info.ipi_addr.s_addr);
+                    }
+#ifdef SO_RXQ_OVFL
+                    if ((cmsg->cmsg_level == SOL_SOCKET) && (cmsg->cmsg_type == SO_RXQ_OVFL))
+                    {
+                        // The counter is cumulative, so the one of the latest datagram is the most recent.
+                        (void) memcpy(&self->drops, CMSG_DATA(cmsg), sizeof(self->drops));
+                    }
+#endif
+                    cmsg = CMSG_NXTHDR(&msgs[idx].msg_hdr, cmsg);
+                }
+            }
+            res = (int16_t) recv_result;
+        }
+        else if ((errno == EAGAIN) || (errno == EWOULDBLOCK))
+        {
+            res = 0;
+        }
+        else
+        {
+            res = (int16_t) -errno;
+        }
+#else
+        res = 0;
+        for (size_t idx = 0; idx < batch_count; idx++)
+        {
+            datagrams[idx].size         = datagrams[idx].capacity;
+            datagrams[idx].timestamp_ns = 0;
+            datagrams[idx].dst_address  = 0;
+            const int16_t one_result = udpRxReceive(self, &datagrams[idx].size, datagrams[idx].payload);
+            if (one_result <= 0)
+            {
+                // Report an error only if nothing has been received so far.
+                res = (res > 0) ? res : one_result;
+                break;
+            }
+            res++;
+        }
+#endif
+    }
+    return res;
+}
+
 void udpRxClose(UDPRxHandle* const self)
 {
     if ((self != NULL) && (self->fd >= 0))
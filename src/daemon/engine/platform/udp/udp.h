@@ -37,11 +37,14 @@ extern "C"
     /// Note that LibUDPard does not require the same socket to be usable for both transmission and reception.
     typedef struct
     {
-        int fd;
+        int     fd;
+        uint8_t dscp;  ///< The DSCP value currently applied to the socket; cached to avoid redundant `setsockopt`.
     } UDPTxHandle;
     typedef struct
     {
-        int fd;
+        int      fd;
+        uint32_t drops;  ///< Datagrams dropped by the kernel (receive buffer overflows) since the socket creation,
+                         ///< as of the last batched reception - see `udpRxEnableDropCounter`. Wraps around.
     } UDPRxHandle;
 
     /// Initialize a TX socket for use with LibUDPard.
@@ -61,6 +64,34 @@ extern "C"
                       const size_t       payload_size,
                       const void* const  payload);
 
+    /// Describes a single datagram for the batched transmission.
+    typedef struct
+    {
+        uint32_t    remote_address;
+        uint16_t    remote_port;
+        size_t      payload_size;
+        const void* payload;
+    } UDPTxDatagram;
+
+/// The maximum number of datagrams which could be sent by a single batched transmission.
+#define UDP_TX_BATCH_MAX 64U
+
+    /// Send up to `count` (but not more than UDP_TX_BATCH_MAX) datagrams without blocking using the same DSCP value.
+    /// On GNU/Linux the whole batch is sent by a single system call (`sendmmsg`);
+    /// elsewhere datagrams are sent one by one.
+    /// Returns the number of sent datagrams (the leading part of the batch), 0 if the socket is not ready for sending,
+    /// or a negative error code.
+    int16_t udpTxSendBatch(UDPTxHandle* const         self,
+                           const uint8_t              dscp,
+                           const size_t               count,
+                           const UDPTxDatagram* const datagrams);
+
+    /// Set size of the kernel send buffer (`SO_SNDBUF`) of the socket; zero size keeps the current one.
+    /// The effective size (as reported back by the kernel - f.e. Linux doubles the requested size,
+    /// and caps it by `net.core.wmem_max`) is stored into `out_size` (if not NULL).
+    /// Returns 0 on success, or a negative error code.
+    int16_t udpTxSetBufferSize(UDPTxHandle* const self, const size_t size, size_t* const out_size);
+
     /// No effect if the argument is invalid.
     /// This function is guaranteed to invalidate the handle.
     void udpTxClose(UDPTxHandle* const self);
@@ -75,12 +106,70 @@ extern "C"
                       const uint32_t     multicast_group,
                       const uint16_t     remote_port);
 
+    /// Initialize a shared RX socket - a single socket (per interface) for all multicast groups of the given port.
+    /// Unlike `udpRxInit`, the socket is bound to the port only (INADDR_ANY); groups are joined and left later
+    /// (see `udpRxJoinGroup` and `udpRxLeaveGroup`), and the destination (group) address of each received datagram
+    /// is reported by the batched reception (via `IP_PKTINFO`) - see `UDPRxDatagram::dst_address`.
+    /// Only datagrams of the groups joined by this very socket (on the given interface) are received
+    /// (`IP_MULTICAST_ALL` is disabled where supported).
+    /// On error returns a negative error code.
+    int16_t udpRxInitShared(UDPRxHandle* const self, const uint32_t local_iface_address, const uint16_t remote_port);
+
+    /// Join (or leave) the multicast group on the given local interface by the shared RX socket.
+    /// Returns 0 on success, or a negative error code.
+    int16_t udpRxJoinGroup(UDPRxHandle* const self, const uint32_t local_iface_address, const uint32_t multicast_group);
+    int16_t udpRxLeaveGroup(UDPRxHandle* const self,
+                            const uint32_t     local_iface_address,
+                            const uint32_t     multicast_group);
+
+    /// Enable kernel timestamping of received datagrams (`SO_TIMESTAMPNS`) - see `UDPRxDatagram::timestamp_ns`.
+    /// Returns 0 on success, or a negative error code (f.e. if not supported by the platform).
+    int16_t udpRxEnableTimestamps(UDPRxHandle* const self);
+
+    /// Set size of the kernel receive buffer (`SO_RCVBUF`) of the socket - see `udpTxSetBufferSize` for details.
+    int16_t udpRxSetBufferSize(UDPRxHandle* const self, const size_t size, size_t* const out_size);
+
+    /// Enable reporting of the kernel drop counter (`SO_RXQ_OVFL`) - see `UDPRxHandle::drops`.
+    /// Returns 0 on success, or a negative error code (f.e. if not supported by the platform).
+    int16_t udpRxEnableDropCounter(UDPRxHandle* const self);
+
+    /// Set the time (in microseconds) to busy poll the device queue on reception (`SO_BUSY_POLL`),
+    /// and prefer busy polling over interrupts (`SO_PREFER_BUSY_POLL`, if supported). Zero disables busy polling.
+    /// Note that increasing the time over `net.core.busy_read` requires `CAP_NET_ADMIN`.
+    /// Returns 0 on success, or a negative error code (f.e. if not supported by the platform).
+    int16_t udpRxSetBusyPoll(UDPRxHandle* const self, const uint32_t usec);
+
     /// Read one datagram from the socket without blocking.
     /// The size of the destination buffer is specified in inout_payload_size; it is updated to the actual size of the
     /// received datagram upon return.
     /// Returns 1 on success, 0 if the socket is not ready for reading, or a negative error code.
     int16_t udpRxReceive(UDPRxHandle* const self, size_t* const inout_payload_size, void* const out_payload);
 
+    /// Describes a destination buffer of a single datagram for the batched reception.
+    /// The size of the buffer is specified in `capacity`;
+    /// `size` is updated to the actual size of the received datagram.
+    /// `timestamp_ns` is updated to the kernel arrival time (CLOCK_REALTIME) of the datagram if timestamping
+    /// is enabled (see `udpRxEnableTimestamps`), or to zero otherwise.
+    /// `dst_address` is updated to the destination address of the datagram for a shared socket
+    /// (see `udpRxInitShared`), or to zero otherwise.
+    typedef struct
+    {
+        void*    payload;
+        size_t   capacity;
+        size_t   size;
+        uint64_t timestamp_ns;
+        uint32_t dst_address;
+    } UDPRxDatagram;
+
+/// The maximum number of datagrams which could be read by a single batched reception.
+#define UDP_RX_BATCH_MAX 64U
+
+    /// Read up to `count` (but not more than UDP_RX_BATCH_MAX) datagrams from the socket without blocking.
+    /// On GNU/Linux the whole batch is read by a single system call (`recvmmsg`);
+    /// elsewhere datagrams are read one by one.
+    /// Returns the number of received datagrams, 0 if the socket is not ready for reading, or a negative error code.
+    int16_t udpRxReceiveBatch(UDPRxHandle* const self, const size_t count, UDPRxDatagram* const datagrams);
+
     /// No effect if the argument is invalid.
     /// This function is guaranteed to invalidate the handle.
     void udpRxClose(UDPRxHandle* const self);
@@ -6,6 +6,10 @@
 #ifndef OCVSMD_DAEMON_ENGINE_PLATFORM_UDP_MEDIA_HPP_INCLUDED
 #define OCVSMD_DAEMON_ENGINE_PLATFORM_UDP_MEDIA_HPP_INCLUDED
 
+#include "logging.hpp"
+#include "platform/media_health.hpp"
+#include "platform/socket_stats.hpp"
+#include "udp_rx_demux.hpp"
 #include "udp_sockets.hpp"
 
 #include <cetl/pf17/cetlpf.hpp>
@@ -18,6 +22,8 @@
 #include <array>
 #include <cstddef>
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace ocvsmd
 {
@@ -30,17 +36,34 @@ namespace platform
 namespace udp
 {
 
+/// Defines UDP media of a single interface.
+///
+/// The interface address is an IPv4 address optionally followed by `?`-separated query of `&`-separated parameters.
+/// Currently supported parameters are kernel buffer sizes, and busy polling of the sockets (see `SocketBufferSizes`).
+///
+/// Health of the media is shared by all its sockets (see `MediaHealth`) - they report their RX/TX activity and errors.
+///
+/// In the shared RX mode, all RX sockets of the media are served by a single system socket (see `UdpRxDemux`),
+/// which is made on the first RX socket request. A dedicated system socket is still made for an endpoint
+/// which the shared one can't serve (f.e. of a different UDP port), or if the shared one can't be made at all.
+///
 class UdpMedia final : public libcyphal::transport::udp::IMedia
 {
 public:
     UdpMedia(cetl::pmr::memory_resource& general_mr,
              libcyphal::IExecutor&       executor,
              const cetl::string_view     iface_address,
-             cetl::pmr::memory_resource& tx_mr)
+             cetl::pmr::memory_resource& tx_mr,
+             cetl::pmr::memory_resource& rx_mr,
+             const bool                  kernel_timestamps,
+             const bool                  shared_rx)
         : general_mr_{general_mr}
         , executor_{executor}
         , iface_address_{iface_address.data(), iface_address.size()}
         , tx_mr_{tx_mr}
+        , rx_mr_{rx_mr}
+        , kernel_timestamps_{kernel_timestamps}
+        , shared_rx_{shared_rx}
     {
     }
 
@@ -55,12 +78,50 @@ public:
         , executor_{other.executor_}
         , iface_address_{std::move(other.iface_address_)}
         , tx_mr_{other.tx_mr_}
+        , rx_mr_{other.rx_mr_}
+        , kernel_timestamps_{other.kernel_timestamps_}
+        , shared_rx_{other.shared_rx_}
+        , buffer_sizes_{other.buffer_sizes_}
     {
+        CETL_DEBUG_ASSERT(other.sockets_.size() == 0, "");
+        // The demux refers to the health of the media - so the media can't be moved once it's made.
+        CETL_DEBUG_ASSERT(!other.rx_demux_, "");
     }
 
     void setAddress(const cetl::string_view iface_address)
     {
-        iface_address_ = std::string{iface_address.data(), iface_address.size()};
+        const auto query_pos = iface_address.find('?');
+        const auto address   = iface_address.substr(0, query_pos);
+        iface_address_       = std::string{address.data(), address.size()};
+        buffer_sizes_        = {};
+        if (query_pos == cetl::string_view::npos)
+        {
+            return;
+        }
+
+        auto query = iface_address.substr(query_pos + 1);
+        while (!query.empty())
+        {
+            const auto next  = query.find('&');
+            const auto param = query.substr(0, next);
+            if (!param.empty() && !buffer_sizes_.parseParam(param))
+            {
+                common::getLogger("io")->warn("Unknown UDP interface parameter '{}' is ignored (iface='{}').",
+                                              std::string{param.data(), param.size()},
+                                              iface_address_);
+            }
+            query = (next == cetl::string_view::npos) ? cetl::string_view{} : query.substr(next + 1);
+        }
+    }
+
+    MediaHealthReport getHealthReport() const
+    {
+        return {iface_address_, health_.snapshot()};
+    }
+
+    MediaSocketsReport getSocketsReport() const
+    {
+        return {iface_address_, sockets_.snapshot()};
     }
 
 private:
@@ -68,12 +129,49 @@ private:
 
     MakeTxSocketResult::Type makeTxSocket() override
     {
-        return UdpTxSocket::make(general_mr_, executor_, iface_address_.data());
+        return UdpTxSocket::make(general_mr_,
+                                 executor_,
+                                 iface_address_.data(),
+                                 buffer_sizes_.sndbuf,
+                                 health_,
+                                 sockets_);
     }
 
     MakeRxSocketResult::Type makeRxSocket(const libcyphal::transport::udp::IpEndpoint& multicast_endpoint) override
     {
-        return UdpRxSocket::make(general_mr_, executor_, iface_address_.data(), multicast_endpoint);
+        if (shared_rx_)
+        {
+            if (!rx_demux_ && !is_rx_demux_failed_)
+            {
+                rx_demux_ = UdpRxDemux::make(executor_,
+                                             iface_address_,
+                                             multicast_endpoint.udp_port,
+                                             rx_mr_,
+                                             kernel_timestamps_,
+                                             buffer_sizes_,
+                                             health_,
+                                             sockets_);
+                is_rx_demux_failed_ = !rx_demux_;
+            }
+            if (rx_demux_ && (rx_demux_->udpPort() == multicast_endpoint.udp_port))
+            {
+                auto result = rx_demux_->makeSocket(general_mr_, multicast_endpoint);
+                if (nullptr == cetl::get_if<MakeRxSocketResult::Failure>(&result))
+                {
+                    return result;
+                }
+            }
+        }
+
+        return UdpRxSocket::make(general_mr_,
+                                 executor_,
+                                 iface_address_.data(),
+                                 multicast_endpoint,
+                                 rx_mr_,
+                                 kernel_timestamps_,
+                                 buffer_sizes_,
+                                 health_,
+                                 sockets_);
     }
 
     cetl::pmr::memory_resource& getTxMemoryResource() override
@@ -87,6 +185,14 @@ private:
     libcyphal::IExecutor&       executor_;
     std::string                 iface_address_;
     cetl::pmr::memory_resource& tx_mr_;
+    cetl::pmr::memory_resource& rx_mr_;
+    bool                        kernel_timestamps_;
+    bool                        shared_rx_;
+    bool                        is_rx_demux_failed_{false};
+    SocketBufferSizes           buffer_sizes_;
+    MediaHealth                 health_;
+    SocketStatsRegistry         sockets_;
+    UdpRxDemux::Ptr             rx_demux_;
 
 };  // UdpMedia
 
@@ -96,11 +202,14 @@ struct UdpMediaCollection
 {
     UdpMediaCollection(cetl::pmr::memory_resource& general_mr,
                        libcyphal::IExecutor&       executor,
-                       cetl::pmr::memory_resource& tx_mr)
+                       cetl::pmr::memory_resource& tx_mr,
+                       cetl::pmr::memory_resource& rx_mr,
+                       const bool                  kernel_timestamps,
+                       const bool                  shared_rx)
         : media_array_{{//
-                        {general_mr, executor, "", tx_mr},
-                        {general_mr, executor, "", tx_mr},
-                        {general_mr, executor, "", tx_mr}}}
+                        {general_mr, executor, "", tx_mr, rx_mr, kernel_timestamps, shared_rx},
+                        {general_mr, executor, "", tx_mr, rx_mr, kernel_timestamps, shared_rx},
+                        {general_mr, executor, "", tx_mr, rx_mr, kernel_timestamps, shared_rx}}}
     {
     }
 
@@ -143,6 +252,32 @@ struct UdpMediaCollection
         });
     }
 
+    std::vector<MediaHealthReport> getHealthReports() const
+    {
+        std::vector<MediaHealthReport> reports;
+        for (std::size_t i = 0; i < MaxUdpMedia; i++)
+        {
+            if (media_ifaces_[i] != nullptr)  // NOLINT
+            {
+                reports.push_back(media_array_[i].getHealthReport());  // NOLINT
+            }
+        }
+        return reports;
+    }
+
+    std::vector<MediaSocketsReport> getSocketsReports() const
+    {
+        std::vector<MediaSocketsReport> reports;
+        for (std::size_t i = 0; i < MaxUdpMedia; i++)
+        {
+            if (media_ifaces_[i] != nullptr)  // NOLINT
+            {
+                reports.push_back(media_array_[i].getSocketsReport());  // NOLINT
+            }
+        }
+        return reports;
+    }
+
 private:
     static constexpr std::size_t MaxUdpMedia = 3;
 
@@ -0,0 +1,478 @@
+//
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#ifndef OCVSMD_DAEMON_ENGINE_PLATFORM_UDP_RX_DEMUX_HPP_INCLUDED
+#define OCVSMD_DAEMON_ENGINE_PLATFORM_UDP_RX_DEMUX_HPP_INCLUDED
+
+#include "logging.hpp"
+#include "ocvsmd/platform/executor_profiler.hpp"
+#include "ocvsmd/platform/posix_executor_extension.hpp"
+#include "ocvsmd/platform/posix_platform_error.hpp"
+#include "platform/kernel_timestamp.hpp"
+#include "platform/media_health.hpp"
+#include "platform/socket_stats.hpp"
+#include "udp.h"
+#include "udp_sockets.hpp"
+
+#include <cetl/cetl.hpp>
+#include <cetl/pf17/cetlpf.hpp>
+#include <cetl/rtti.hpp>
+#include <libcyphal/errors.hpp>
+#include <libcyphal/executor.hpp>
+#include <libcyphal/transport/errors.hpp>
+#include <libcyphal/transport/types.hpp>
+#include <libcyphal/transport/udp/media.hpp>
+#include <libcyphal/transport/udp/tx_rx_sockets.hpp>
+#include <libcyphal/types.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+namespace ocvsmd
+{
+namespace daemon
+{
+namespace engine
+{
+namespace platform
+{
+namespace udp
+{
+
+class UdpRxDemux;
+
+/// Defines UDP RX "socket" of a single multicast group - as it's seen by libcyphal.
+///
+/// It doesn't have its own system socket - datagrams of its group are read by the shared socket of the media
+/// (see `UdpRxDemux`), and queued here. Once there are queued datagrams, libcyphal is notified via
+/// a regular (not I/O-awaitable) executor callback.
+///
+class UdpRxDemuxSocket final : public libcyphal::transport::udp::IRxSocket
+{
+public:
+    UdpRxDemuxSocket(UdpRxDemux& demux, libcyphal::IExecutor& executor, const std::uint32_t multicast_group)
+        : demux_{demux}
+        , executor_{executor}
+        , multicast_group_{multicast_group}
+    {
+    }
+
+    ~UdpRxDemuxSocket() override;
+
+    UdpRxDemuxSocket(const UdpRxDemuxSocket&)                = delete;
+    UdpRxDemuxSocket(UdpRxDemuxSocket&&) noexcept            = delete;
+    UdpRxDemuxSocket& operator=(const UdpRxDemuxSocket&)     = delete;
+    UdpRxDemuxSocket& operator=(UdpRxDemuxSocket&&) noexcept = delete;
+
+    /// Queues a datagram (and takes ownership of its buffer) for libcyphal.
+    ///
+    /// @return `false` if the queue is full - the buffer stays with the caller then.
+    ///
+    bool enqueue(const UDPRxDatagram& datagram, const libcyphal::TimePoint timestamp)
+    {
+        if (queue_count_ == QueueCapacity)
+        {
+            return false;
+        }
+        queue_[(queue_head_ + queue_count_) % QueueCapacity] = {timestamp, datagram};
+        if ((queue_count_++ == 0) && notify_callback_.has_value())
+        {
+            notify_callback_.schedule(Callback::Schedule::Once{timestamp});
+        }
+        return true;
+    }
+
+private:
+    using Callback = libcyphal::IExecutor::Callback;
+
+    static constexpr std::size_t QueueCapacity = 32;
+
+    struct Pending
+    {
+        libcyphal::TimePoint timestamp;
+        UDPRxDatagram        datagram;
+    };
+
+    // MARK: IRxSocket
+
+    CETL_NODISCARD ReceiveResult::Type receive() override;
+
+    CETL_NODISCARD libcyphal::IExecutor::Callback::Any registerCallback(
+        libcyphal::IExecutor::Callback::Function&& function) override
+    {
+        // libcyphal receives one datagram per callback call - so all queued datagrams are drained at once.
+        //
+        using Profiler = ocvsmd::platform::ExecutorProfiler;
+
+        rx_function_     = std::move(function);
+        notify_callback_ = executor_.registerCallback(
+            [this, profiler = cetl::rtti_cast<Profiler*>(&executor_)](const auto& arg) {
+                //
+                const Profiler::Scope scope{profiler, Profiler::Category::UdpRx};
+                std::size_t           calls = 0;
+                do
+                {
+                    rx_function_(arg);
+                } while ((queue_count_ > 0) && (++calls < QueueCapacity));
+                if (queue_count_ > 0)
+                {
+                    notify_callback_.schedule(Callback::Schedule::Once{arg.approx_now});
+                }
+            });
+
+        // The returned callback is just a handle for libcyphal - it's never scheduled (see `notify_callback_`).
+        return executor_.registerCallback([](const auto&) {});
+    }
+
+    // MARK: Data members:
+
+    UdpRxDemux&                              demux_;
+    libcyphal::IExecutor&                    executor_;
+    const std::uint32_t                      multicast_group_;
+    libcyphal::IExecutor::Callback::Function rx_function_;
+    Callback::Any                            notify_callback_;
+    std::array<Pending, QueueCapacity>       queue_{};
+    std::size_t                              queue_head_{0};
+    std::size_t                              queue_count_{0};
+
+};  // UdpRxDemuxSocket
+
+// MARK: -
+
+/// Defines shared UDP RX socket of a media (interface), which demultiplexes datagrams of all its multicast groups.
+///
+/// Instead of a separate system socket (and so epoll registration) per subscribed group, there is a single one
+/// per interface - it joins groups as libcyphal makes RX sockets (see `makeSocket`), reads datagrams in batches
+/// (like `UdpRxSocket` does), and dispatches them (by their destination address, see `IP_PKTINFO`)
+/// via a hash table to the queues of the corresponding `UdpRxDemuxSocket`-s.
+///
+/// Datagrams of unknown groups (f.e. just left ones), and the ones which don't fit into a full queue, are dropped.
+///
+class UdpRxDemux final
+{
+    /// Defines private specification for making interface unique ptr.
+    ///
+    struct Spec
+    {
+        explicit Spec() = default;
+    };
+
+public:
+    using Ptr = std::unique_ptr<UdpRxDemux>;
+
+    /// Makes a new demux of the given interface and port.
+    ///
+    /// @return `nullptr` if the shared socket can't be made (the failure is logged).
+    ///
+    CETL_NODISCARD static Ptr make(libcyphal::IExecutor&       executor,
+                                   const std::string&          address,
+                                   const std::uint16_t         udp_port,
+                                   cetl::pmr::memory_resource& rx_memory,
+                                   const bool                  kernel_timestamps,
+                                   const SocketBufferSizes&    buffer_sizes,
+                                   MediaHealth&                health,
+                                   SocketStatsRegistry&        sockets)
+    {
+        auto* const posix_executor_ext = cetl::rtti_cast<ocvsmd::platform::IPosixExecutorExtension*>(&executor);
+        if (nullptr == posix_executor_ext)
+        {
+            return nullptr;
+        }
+
+        const auto  iface_address = ::udpParseIfaceAddress(address.c_str());
+        UDPRxHandle handle{-1, 0};
+        const auto  result = ::udpRxInitShared(&handle, iface_address, udp_port);
+        if (result < 0)
+        {
+            common::getLogger("io")->warn("Failed to make shared UDP RX socket (iface='{}', port={}, err={}).",
+                                          address,
+                                          udp_port,
+                                          -result);
+            return nullptr;
+        }
+
+        bool is_kernel_timestamped = false;
+        if (kernel_timestamps)
+        {
+            is_kernel_timestamped = ::udpRxEnableTimestamps(&handle) >= 0;
+        }
+        const auto buffer_size = setupRxBuffer(handle, buffer_sizes);
+
+        auto demux = std::make_unique<UdpRxDemux>(Spec{},
+                                                  executor,
+                                                  handle,
+                                                  iface_address,
+                                                  udp_port,
+                                                  rx_memory,
+                                                  is_kernel_timestamped,
+                                                  health,
+                                                  sockets);
+        demux->stats_entry_.stats().buffer_size = buffer_size;
+        using Profiler   = ocvsmd::platform::ExecutorProfiler;
+        demux->callback_ = posix_executor_ext->registerAwaitableCallback(
+            [demux_ptr = demux.get(), profiler = cetl::rtti_cast<Profiler*>(&executor)](const auto&) {
+                //
+                const Profiler::Scope scope{profiler, Profiler::Category::UdpRx};
+                demux_ptr->handleReadable();
+            },
+            ocvsmd::platform::IPosixExecutorExtension::Trigger::Readable{handle.fd});
+        return demux;
+    }
+
+    UdpRxDemux(Spec,
+               libcyphal::IExecutor&       executor,
+               UDPRxHandle                 udp_handle,
+               const std::uint32_t         iface_address,
+               const std::uint16_t         udp_port,
+               cetl::pmr::memory_resource& rx_memory,
+               const bool                  is_kernel_timestamped,
+               MediaHealth&                health,
+               SocketStatsRegistry&        sockets)
+        : udp_handle_{udp_handle}
+        , executor_{executor}
+        , iface_address_{iface_address}
+        , udp_port_{udp_port}
+        , rx_memory_{rx_memory}
+        , is_kernel_timestamped_{is_kernel_timestamped}
+        , health_{health}
+        , stats_entry_{sockets, formatEndpoint(0, udp_port), true}
+    {
+        CETL_DEBUG_ASSERT(udp_handle_.fd >= 0, "");
+    }
+
+    ~UdpRxDemux()
+    {
+        CETL_DEBUG_ASSERT(sockets_.empty(), "All demux sockets must be released first.");
+
+        if (wakeups_ > 0)
+        {
+            common::getLogger("io")->debug("UDP RX demux stats (wakeups={}, datagrams={}, unmatched={}, dropped={}).",
+                                           wakeups_,
+                                           datagrams_,
+                                           unmatched_,
+                                           dropped_);
+        }
+
+        callback_.reset();
+        for (auto& datagram : batch_)
+        {
+            if (datagram.payload != nullptr)
+            {
+                rx_memory_.deallocate(datagram.payload, datagram.capacity);
+            }
+        }
+        ::udpRxClose(&udp_handle_);
+    }
+
+    UdpRxDemux(const UdpRxDemux&)                = delete;
+    UdpRxDemux(UdpRxDemux&&) noexcept            = delete;
+    UdpRxDemux& operator=(const UdpRxDemux&)     = delete;
+    UdpRxDemux& operator=(UdpRxDemux&&) noexcept = delete;
+
+    std::uint16_t udpPort() const noexcept
+    {
+        return udp_port_;
+    }
+
+    cetl::pmr::memory_resource& rxMemory() const noexcept
+    {
+        return rx_memory_;
+    }
+
+    /// Makes RX socket of the given multicast group (and joins the group by the shared socket).
+    ///
+    CETL_NODISCARD libcyphal::transport::udp::IMedia::MakeRxSocketResult::Type makeSocket(
+        cetl::pmr::memory_resource&                  memory,
+        const libcyphal::transport::udp::IpEndpoint& endpoint)
+    {
+        CETL_DEBUG_ASSERT(endpoint.udp_port == udp_port_, "");
+
+        if (sockets_.find(endpoint.ip_address) != sockets_.end())
+        {
+            return libcyphal::ArgumentError{};
+        }
+
+        const auto result = ::udpRxJoinGroup(&udp_handle_, iface_address_, endpoint.ip_address);
+        if (result < 0)
+        {
+            return libcyphal::transport::PlatformError{ocvsmd::platform::PosixPlatformError{-result}};
+        }
+
+        auto rx_socket = libcyphal::makeUniquePtr<libcyphal::transport::udp::IRxSocket, UdpRxDemuxSocket>(  //
+            memory,
+            *this,
+            executor_,
+            endpoint.ip_address);
+        if (rx_socket == nullptr)
+        {
+            (void) ::udpRxLeaveGroup(&udp_handle_, iface_address_, endpoint.ip_address);
+            return libcyphal::MemoryError{};
+        }
+        // NOLINTNEXTLINE(*-static-cast-downcast)
+        sockets_[endpoint.ip_address] = static_cast<UdpRxDemuxSocket*>(rx_socket.get());
+        return rx_socket;
+    }
+
+    /// Unregisters (and leaves the group of) the socket which is being destroyed.
+    ///
+    void release(const std::uint32_t multicast_group)
+    {
+        sockets_.erase(multicast_group);
+        (void) ::udpRxLeaveGroup(&udp_handle_, iface_address_, multicast_group);
+    }
+
+private:
+    static constexpr std::size_t BatchSize  = 16;
+    static constexpr std::size_t MaxBatches = 4;
+    static_assert(BatchSize <= UDP_RX_BATCH_MAX, "");
+
+    /// Reads and dispatches datagrams - until the socket is drained (or up to `MaxBatches` batches).
+    ///
+    /// The rest (if any) is left for the next wakeup - the socket stays readable, so other callbacks aren't starved.
+    ///
+    void handleReadable()
+    {
+        for (std::size_t batch = 0; batch < MaxBatches; ++batch)
+        {
+            const std::size_t available = prepareBuffers();
+            if (available == 0)
+            {
+                return;
+            }
+
+            const std::int16_t result = ::udpRxReceiveBatch(&udp_handle_, available, batch_.data());
+            if (result <= 0)
+            {
+                if ((result < 0) && health_.noteError(executor_.now(), -result, false))
+                {
+                    common::getLogger("io")->warn("UDP media is down (err={}).", -result);
+                }
+                return;
+            }
+
+            const auto count       = static_cast<std::size_t>(result);
+            const auto now         = executor_.now();
+            const auto realtime_ns = is_kernel_timestamped_ ? realtimeNowNs() : 0;
+            ++wakeups_;
+            datagrams_ += count;
+            health_.noteRx(now, count);
+            health_.noteKernelDrops(stats_entry_.stats().noteKernelDrops(udp_handle_.drops));
+
+            for (std::size_t index = 0; index < count; ++index)
+            {
+                dispatch(batch_[index], now, realtime_ns);  // NOLINT
+            }
+            if (count < available)
+            {
+                return;
+            }
+        }
+    }
+
+    void dispatch(UDPRxDatagram& datagram, const libcyphal::TimePoint now, const std::uint64_t now_realtime_ns)
+    {
+        const auto it = sockets_.find(datagram.dst_address);
+        if (it == sockets_.end())
+        {
+            ++unmatched_;
+            return;
+        }
+
+        const auto timestamp =
+            is_kernel_timestamped_ ? fromKernelTimestamp(now, now_realtime_ns, datagram.timestamp_ns) : now;
+        if (!it->second->enqueue(datagram, timestamp))
+        {
+            ++dropped_;
+            return;
+        }
+        // The buffer now belongs to the socket queue.
+        datagram.payload = nullptr;
+    }
+
+    /// Makes sure that batch buffers are allocated - only the ones handed over to sockets are reallocated.
+    ///
+    std::size_t prepareBuffers()
+    {
+        std::size_t available = 0;
+        for (auto& datagram : batch_)
+        {
+            if (datagram.payload == nullptr)
+            {
+                datagram.payload  = rx_memory_.allocate(UdpRxSocket::BufferSize);
+                datagram.capacity = UdpRxSocket::BufferSize;
+                if (datagram.payload == nullptr)
+                {
+                    break;
+                }
+            }
+            ++available;
+        }
+        return available;
+    }
+
+    // MARK: Data members:
+
+    UDPRxHandle                                           udp_handle_;
+    libcyphal::IExecutor&                                 executor_;
+    const std::uint32_t                                   iface_address_;
+    const std::uint16_t                                   udp_port_;
+    cetl::pmr::memory_resource&                           rx_memory_;
+    const bool                                            is_kernel_timestamped_;
+    MediaHealth&                                          health_;
+    SocketStatsRegistry::Entry                            stats_entry_;
+    libcyphal::IExecutor::Callback::Any                   callback_;
+    std::unordered_map<std::uint32_t, UdpRxDemuxSocket*> sockets_;
+    std::array<UDPRxDatagram, BatchSize>                  batch_{};
+    std::uint64_t                                         wakeups_{0};
+    std::uint64_t                                         datagrams_{0};
+    std::uint64_t                                         unmatched_{0};
+    std::uint64_t                                         dropped_{0};
+
+};  // UdpRxDemux
+
+// MARK: -
+
+inline UdpRxDemuxSocket::~UdpRxDemuxSocket()
+{
+    demux_.release(multicast_group_);
+
+    for (std::size_t offset = 0; offset < queue_count_; ++offset)
+    {
+        const auto& datagram = queue_[(queue_head_ + offset) % QueueCapacity].datagram;
+        demux_.rxMemory().deallocate(datagram.payload, datagram.capacity);
+    }
+}
+
+inline auto UdpRxDemuxSocket::receive() -> ReceiveResult::Type
+{
+    if (queue_count_ == 0)
+    {
+        return cetl::nullopt;
+    }
+
+    const auto pending = queue_[queue_head_];
+    queue_head_        = (queue_head_ + 1) % QueueCapacity;
+    --queue_count_;
+
+    // Hand over the datagram buffer "as is" - see `UdpRxSocket::receive` for details.
+    //
+    auto* const data = static_cast<cetl::byte*>(pending.datagram.payload);
+    return ReceiveResult::Metadata{pending.timestamp,
+                                   {data, libcyphal::PmrRawBytesDeleter{pending.datagram.size, &demux_.rxMemory()}}};
+}
+
+}  // namespace udp
+}  // namespace platform
+}  // namespace engine
+}  // namespace daemon
+}  // namespace ocvsmd
+
+#endif  // OCVSMD_DAEMON_ENGINE_PLATFORM_UDP_RX_DEMUX_HPP_INCLUDED
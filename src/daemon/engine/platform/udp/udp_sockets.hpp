@@ -6,8 +6,13 @@
 #ifndef OCVSMD_DAEMON_ENGINE_PLATFORM_UDP_SOCKETS_HPP_INCLUDED
 #define OCVSMD_DAEMON_ENGINE_PLATFORM_UDP_SOCKETS_HPP_INCLUDED
 
+#include "logging.hpp"
+#include "ocvsmd/platform/executor_profiler.hpp"
 #include "ocvsmd/platform/posix_executor_extension.hpp"
 #include "ocvsmd/platform/posix_platform_error.hpp"
+#include "platform/kernel_timestamp.hpp"
+#include "platform/media_health.hpp"
+#include "platform/socket_stats.hpp"
 #include "udp.h"
 
 #include <cetl/cetl.hpp>
@@ -21,10 +26,13 @@
 #include <libcyphal/transport/udp/tx_rx_sockets.hpp>
 #include <libcyphal/types.hpp>
 
+#include <algorithm>
 #include <array>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
+#include <string>
 #include <utility>
 
 namespace ocvsmd
@@ -38,22 +46,114 @@ namespace platform
 namespace udp
 {
 
+/// Formats the given IPv4 endpoint (f.e. '239.0.0.1:9382') - for socket stats.
+///
+inline std::string formatEndpoint(const std::uint32_t address, const std::uint16_t port)
+{
+    constexpr std::uint32_t ByteMask = 0xFFU;
+
+    std::string result;
+    for (std::uint32_t shift = 24U; shift > 0; shift -= 8U)  // NOLINT(*-magic-numbers)
+    {
+        result += std::to_string((address >> shift) & ByteMask);
+        result += '.';
+    }
+    result += std::to_string(address & ByteMask);
+    result += ':';
+    result += std::to_string(port);
+    return result;
+}
+
+/// Applies the requested size (if any) of the kernel receive buffer, and busy polling (if any),
+/// and enables the kernel drop counter.
+///
+/// Failures are not fatal - they are logged, and the socket is used as is.
+///
+/// @return The effective size of the buffer (or zero if unknown).
+///
+inline std::size_t setupRxBuffer(UDPRxHandle& handle, const SocketBufferSizes& buffer_sizes)
+{
+    std::size_t buffer_size = 0;
+    const auto  result      = ::udpRxSetBufferSize(&handle, buffer_sizes.rcvbuf, &buffer_size);
+    if (result < 0)
+    {
+        common::getLogger("io")->warn("Failed to set UDP RX buffer size (size={}, err={}).",
+                                      buffer_sizes.rcvbuf,
+                                      -result);
+    }
+
+    if (buffer_sizes.busy_poll > 0)
+    {
+        const auto busy_poll   = static_cast<std::uint32_t>(buffer_sizes.busy_poll);
+        const auto poll_result = ::udpRxSetBusyPoll(&handle, busy_poll);
+        if (poll_result < 0)
+        {
+            common::getLogger("io")->warn("Failed to set UDP RX busy polling (usec={}, err={}).",
+                                          busy_poll,
+                                          -poll_result);
+        }
+    }
+
+    const auto ovfl_result = ::udpRxEnableDropCounter(&handle);
+    if (ovfl_result < 0)
+    {
+        common::getLogger("io")->debug("Failed to enable UDP kernel drop counter (err={}).", -ovfl_result);
+    }
+    return buffer_size;
+}
+
+// MARK: -
+
+/// Defines UDP TX socket which sends frames in batches.
+///
+/// Frames given by libcyphal are staged (copied) into the socket, and then all of them are sent by a single system call
+/// (see `udpTxSendBatch`) from a deferred callback - normally, within the same executor spin. So, all frames which
+/// libcyphal has ready for a TX wakeup (f.e. all frames of a multi-frame transfer) go out together.
+/// Frames with different DSCP values are sent in separate runs; the DSCP value is cached by the socket handle,
+/// so `IP_TOS` is updated only on change.
+///
+/// If the socket is not ready for sending, staged frames are retried (until their deadlines), and new frames are not
+/// accepted once the staging area is full - so libcyphal keeps them in its own TX queue, and so keeps its TX callback
+/// (see `registerCallback`) registered for the socket writability. The callback wrapper sends staged frames first,
+/// and only then lets libcyphal send more. This is the only writable registration of the socket - a second one
+/// (for the same fd) would clash with the libcyphal one in the executor. While libcyphal has nothing queued,
+/// staged frames are retried by a short timer instead.
+///
+/// While the media is down (see `MediaHealth`), new frames are skipped (dropped as if sent), except for a periodic
+/// (with backoff) probe frame - its successful sending brings the media up again.
+///
 class UdpTxSocket final : public libcyphal::transport::udp::ITxSocket
 {
 public:
     CETL_NODISCARD static libcyphal::transport::udp::IMedia::MakeTxSocketResult::Type make(
         cetl::pmr::memory_resource& memory,
         libcyphal::IExecutor&       executor,
-        const char* const           iface_address)
+        const char* const           iface_address,
+        const std::size_t           sndbuf,
+        MediaHealth&                health,
+        SocketStatsRegistry&        sockets)
     {
-        UDPTxHandle handle{-1};
+        UDPTxHandle handle{-1, 0};
         const auto  result = ::udpTxInit(&handle, ::udpParseIfaceAddress(iface_address));
         if (result < 0)
         {
             return libcyphal::transport::PlatformError{ocvsmd::platform::PosixPlatformError{-result}};
         }
 
-        auto tx_socket = libcyphal::makeUniquePtr<ITxSocket, UdpTxSocket>(memory, executor, handle);
+        std::size_t buffer_size = 0;
+        const auto  buf_result  = ::udpTxSetBufferSize(&handle, sndbuf, &buffer_size);
+        if (buf_result < 0)
+        {
+            common::getLogger("io")->warn("Failed to set UDP TX buffer size (size={}, err={}).", sndbuf, -buf_result);
+        }
+
+        auto tx_socket = libcyphal::makeUniquePtr<ITxSocket, UdpTxSocket>(  //
+            memory,
+            executor,
+            handle,
+            buffer_size,
+            health,
+            sockets);
         if (tx_socket == nullptr)
         {
             ::udpTxClose(&handle);
@@ -63,15 +163,39 @@ public:
         return tx_socket;
     }
 
-    UdpTxSocket(libcyphal::IExecutor& executor, UDPTxHandle udp_handle)
+    UdpTxSocket(libcyphal::IExecutor& executor,
+                UDPTxHandle           udp_handle,
+                const std::size_t     buffer_size,
+                MediaHealth&          health,
+                SocketStatsRegistry&  sockets)
         : udp_handle_{udp_handle}
         , executor_{executor}
+        , health_{health}
+        , stats_entry_{sockets, "tx", false}
     {
         CETL_DEBUG_ASSERT(udp_handle_.fd >= 0, "");
+
+        stats_entry_.stats().buffer_size = buffer_size;
+
+        flush_callback_ = executor_.registerCallback([this](const auto& arg) {
+            //
+            handleFlush(arg.approx_now);
+        });
     }
 
     ~UdpTxSocket()
     {
+        // Best effort to send the rest of staged frames.
+        (void) flushFrames(executor_.now());
+
+        if (syscalls_ > 0)
+        {
+            common::getLogger("io")->debug("UDP TX socket stats (frames={}, syscalls={}, expired={}, failed={}).",
+                                           sent_frames_,
+                                           syscalls_,
+                                           expired_frames_,
+                                           failed_frames_);
+        }
         ::udpTxClose(&udp_handle_);
     }
 
@@ -81,28 +205,169 @@ public:
     UdpTxSocket& operator=(UdpTxSocket&&) noexcept = delete;
 
 private:
+    using Callback = libcyphal::IExecutor::Callback;
+
+    static constexpr std::size_t BatchSize  = 16;
+    static constexpr std::size_t BufferSize = 2000;
+    static_assert(BatchSize <= UDP_TX_BATCH_MAX, "");
+
+    struct Frame
+    {
+        libcyphal::TimePoint               deadline;
+        std::uint8_t                       dscp;
+        UDPTxDatagram                      datagram;
+        std::array<cetl::byte, BufferSize> buffer;
+    };
+
+    Frame& frameAt(const std::size_t offset) noexcept
+    {
+        return frames_[(frames_head_ + offset) % BatchSize];
+    }
+
+    void popFrames(const std::size_t count) noexcept
+    {
+        CETL_DEBUG_ASSERT(count <= frames_count_, "");
+        frames_head_ = (frames_head_ + count) % BatchSize;
+        frames_count_ -= count;
+    }
+
+    /// Sends all staged frames (in runs of the same DSCP value), and drops the expired ones.
+    ///
+    /// Stops at the first run which the socket is not ready for - the rest stays staged.
+    /// On failure, the frame which caused it is dropped (like libcyphal does on a send failure).
+    ///
+    CETL_NODISCARD cetl::optional<SendResult::Failure> flushFrames(const libcyphal::TimePoint now)
+    {
+        std::array<UDPTxDatagram, BatchSize> datagrams{};
+        while (frames_count_ > 0)
+        {
+            const auto& head = frameAt(0);
+            if (head.deadline < now)
+            {
+                ++expired_frames_;
+                popFrames(1);
+                continue;
+            }
+
+            std::size_t run_count = 0;
+            while ((run_count < frames_count_) && (frameAt(run_count).dscp == head.dscp) &&
+                   (frameAt(run_count).deadline >= now))
+            {
+                datagrams[run_count] = frameAt(run_count).datagram;  // NOLINT
+                ++run_count;
+            }
+
+            const std::int16_t result = ::udpTxSendBatch(&udp_handle_, head.dscp, run_count, datagrams.data());
+            if (result < 0)
+            {
+                ++failed_frames_;
+                popFrames(1);
+                if (health_.noteError(now, -result, true))
+                {
+                    common::getLogger("io")->warn("UDP media is down (err={}).", -result);
+                }
+                return SendResult::Failure{
+                    libcyphal::transport::PlatformError{ocvsmd::platform::PosixPlatformError{-result}}};
+            }
+            if (result == 0)
+            {
+                break;
+            }
+            ++syscalls_;
+            sent_frames_ += static_cast<std::size_t>(result);
+            popFrames(static_cast<std::size_t>(result));
+            health_.noteTx(static_cast<std::size_t>(result));
+        }
+        return cetl::nullopt;
+    }
+
+    void handleFlush(const libcyphal::TimePoint now)
+    {
+        constexpr auto RetryPeriod = std::chrono::milliseconds{1};
+
+        if (flushFrames(now).has_value())
+        {
+            common::getLogger("io")->debug("UDP TX socket failed to send staged frame.");
+        }
+        if (frames_count_ > 0)
+        {
+            // The socket is not ready for the rest of staged frames. If libcyphal has frames queued as well
+            // (f.e. refused b/c the staging area is full), its TX callback resumes the flush as soon as the socket
+            // becomes writable - otherwise the timer does it.
+            //
+            flush_callback_.schedule(Callback::Schedule::Once{now + RetryPeriod});
+        }
+    }
+
     // MARK: ITxSocket
 
-    SendResult::Type send(const libcyphal::TimePoint,
+    SendResult::Type send(const libcyphal::TimePoint                   deadline,
                           const libcyphal::transport::udp::IpEndpoint  multicast_endpoint,
                           const std::uint8_t                           dscp,
                           const libcyphal::transport::PayloadFragments payload_fragments) override
     {
         CETL_DEBUG_ASSERT(udp_handle_.fd >= 0, "");
-        CETL_DEBUG_ASSERT(payload_fragments.size() == 1, "");
-
-        const std::int16_t result = ::udpTxSend(&udp_handle_,
-                                                multicast_endpoint.ip_address,
-                                                multicast_endpoint.udp_port,
-                                                dscp,
-                                                payload_fragments[0].size(),
-                                                payload_fragments[0].data());
-        if (result < 0)
+
+        std::size_t payload_size = 0;
+        for (const auto& fragment : payload_fragments)
         {
-            return libcyphal::transport::PlatformError{ocvsmd::platform::PosixPlatformError{-result}};
+            payload_size += fragment.size();
+        }
+        if (payload_size > BufferSize)
+        {
+            return libcyphal::ArgumentError{};
         }
 
-        return SendResult::Success{result == 1};
+        // Skip (drop as if sent) frames of a down media - otherwise libcyphal would keep them queued for it.
+        // Once in a while (with backoff) a frame is let through to probe the media.
+        //
+        if (!health_.isUp())
+        {
+            const auto now = executor_.now();
+            if (!health_.isProbeDue(now))
+            {
+                health_.noteTxSkipped();
+                return SendResult::Success{true};
+            }
+            health_.noteProbe(now, false);
+        }
+
+        // Make room for the new frame (if needed) - the socket might be ready again.
+        //
+        if (frames_count_ == BatchSize)
+        {
+            if (auto failure = flushFrames(executor_.now()))
+            {
+                return std::move(*failure);
+            }
+            if (frames_count_ == BatchSize)
+            {
+                return SendResult::Success{false};
+            }
+        }
+
+        auto& frame    = frameAt(frames_count_++);
+        frame.deadline = deadline;
+        frame.dscp     = dscp;
+        frame.datagram = {multicast_endpoint.ip_address,  //
+                          multicast_endpoint.udp_port,
+                          payload_size,
+                          frame.buffer.data()};
+
+        std::size_t offset = 0;
+        for (const auto& fragment : payload_fragments)
+        {
+            (void) std::memcpy(frame.buffer.data() + offset, fragment.data(), fragment.size());  // NOLINT
+            offset += fragment.size();
+        }
+
+        // The first staged frame arms the flush - the rest of the current wakeup frames will join it.
+        //
+        if (frames_count_ == 1)
+        {
+            flush_callback_.schedule(Callback::Schedule::Once{executor_.now()});
+        }
+        return SendResult::Success{true};
     }
 
     CETL_NODISCARD libcyphal::IExecutor::Callback::Any registerCallback(
@@ -114,21 +379,58 @@ private:
             return {};
         }
 
+        // The wrapper below sends staged frames first (they were accepted earlier than anything libcyphal
+        // is going to send now), and profiles the libcyphal callback (if the executor supports profiling).
+        //
+        tx_function_ = std::move(function);
+
+        using Profiler = ocvsmd::platform::ExecutorProfiler;
         CETL_DEBUG_ASSERT(udp_handle_.fd >= 0, "");
         return posix_executor_ext->registerAwaitableCallback(  //
-            std::move(function),
+            [this, profiler = cetl::rtti_cast<Profiler*>(&executor_)](const auto& arg) {
+                //
+                const Profiler::Scope scope{profiler, Profiler::Category::UdpTx};
+                if (frames_count_ > 0)
+                {
+                    handleFlush(arg.approx_now);
+                }
+                tx_function_(arg);
+            },
             ocvsmd::platform::IPosixExecutorExtension::Trigger::Writable{udp_handle_.fd});
     }
 
     // MARK: Data members:
 
-    UDPTxHandle           udp_handle_;
-    libcyphal::IExecutor& executor_;
+    UDPTxHandle                              udp_handle_;
+    libcyphal::IExecutor&                    executor_;
+    MediaHealth&                             health_;
+    SocketStatsRegistry::Entry               stats_entry_;
+    Callback::Any                            flush_callback_;
+    libcyphal::IExecutor::Callback::Function tx_function_;
+    std::array<Frame, BatchSize>             frames_{};
+    std::size_t                              frames_head_{0};
+    std::size_t                              frames_count_{0};
+    std::uint64_t                            sent_frames_{0};
+    std::uint64_t                            syscalls_{0};
+    std::uint64_t                            expired_frames_{0};
+    std::uint64_t                            failed_frames_{0};
 
 };  // UdpTxSocket
 
 // MARK: -
 
+/// Defines UDP RX socket which reads datagrams in batches.
+///
+/// On each readiness event, up to `BatchSize` datagrams are read by a single system call (see `udpRxReceiveBatch`)
+/// directly into blocks of the given memory resource, and then handed over to libcyphal one by one - without copying.
+/// The memory resource must tolerate deallocation by a smaller size than it was allocated with
+/// (like `FixedBlockMemoryResource` does) b/c the receiver frees a datagram block by the datagram size.
+///
+/// Datagrams are timestamped either by the executor time of the wakeup (the same for the whole batch),
+/// or (if requested and supported) by their kernel arrival time - see `SO_TIMESTAMPNS`.
+///
+/// Datagrams dropped by the kernel (b/c of the full receive buffer) are counted - see `SO_RXQ_OVFL`.
+///
 class UdpRxSocket final : public libcyphal::transport::udp::IRxSocket
 {
 public:
@@ -136,9 +438,14 @@ public:
         cetl::pmr::memory_resource&                  memory,
         libcyphal::IExecutor&                        executor,
         const std::string&                           address,
-        const libcyphal::transport::udp::IpEndpoint& endpoint)
+        const libcyphal::transport::udp::IpEndpoint& endpoint,
+        cetl::pmr::memory_resource&                  rx_memory,
+        const bool                                   kernel_timestamps,
+        const SocketBufferSizes&                     buffer_sizes,
+        MediaHealth&                                 health,
+        SocketStatsRegistry&                         sockets)
     {
-        UDPRxHandle handle{-1};
+        UDPRxHandle handle{-1, 0};
         const auto  result =
             ::udpRxInit(&handle, ::udpParseIfaceAddress(address.c_str()), endpoint.ip_address, endpoint.udp_port);
         if (result < 0)
@@ -146,7 +453,29 @@ public:
             return libcyphal::transport::PlatformError{ocvsmd::platform::PosixPlatformError{-result}};
         }
 
-        auto rx_socket = libcyphal::makeUniquePtr<IRxSocket, UdpRxSocket>(memory, executor, handle, memory);
+        bool is_kernel_timestamped = false;
+        if (kernel_timestamps)
+        {
+            const auto ts_result = ::udpRxEnableTimestamps(&handle);
+            if (ts_result < 0)
+            {
+                common::getLogger("io")->warn("Failed to enable UDP kernel timestamps - using executor time (err={}).",
+                                              -ts_result);
+            }
+            is_kernel_timestamped = ts_result >= 0;
+        }
+        const auto buffer_size = setupRxBuffer(handle, buffer_sizes);
+
+        auto rx_socket = libcyphal::makeUniquePtr<IRxSocket, UdpRxSocket>(  //
+            memory,
+            executor,
+            handle,
+            rx_memory,
+            is_kernel_timestamped,
+            health,
+            sockets,
+            formatEndpoint(endpoint.ip_address, endpoint.udp_port),
+            buffer_size);
         if (rx_socket == nullptr)
         {
             ::udpRxClose(&handle);
@@ -156,16 +485,43 @@ public:
         return rx_socket;
     }
 
-    UdpRxSocket(libcyphal::IExecutor& executor, UDPRxHandle udp_handle, cetl::pmr::memory_resource& memory)
+    UdpRxSocket(libcyphal::IExecutor&       executor,
+                UDPRxHandle                 udp_handle,
+                cetl::pmr::memory_resource& rx_memory,
+                const bool                  is_kernel_timestamped,
+                MediaHealth&                health,
+                SocketStatsRegistry&        sockets,
+                std::string                 endpoint,
+                const std::size_t           buffer_size)
         : udp_handle_{udp_handle}
         , executor_{executor}
-        , memory_{memory}
+        , rx_memory_{rx_memory}
+        , is_kernel_timestamped_{is_kernel_timestamped}
+        , health_{health}
+        , stats_entry_{sockets, std::move(endpoint), true}
     {
         CETL_DEBUG_ASSERT(udp_handle_.fd >= 0, "");
+
+        stats_entry_.stats().buffer_size = buffer_size;
     }
 
     ~UdpRxSocket()
     {
+        if (wakeups_ > 0)
+        {
+            common::getLogger("io")->debug("UDP RX socket stats (wakeups={}, datagrams={}, max_batch={}).",
+                                           wakeups_,
+                                           datagrams_,
+                                           max_batch_);
+        }
+
+        for (auto& datagram : batch_)
+        {
+            if (datagram.payload != nullptr)
+            {
+                rx_memory_.deallocate(datagram.payload, datagram.capacity);
+            }
+        }
         ::udpRxClose(&udp_handle_);
     }
 
@@ -174,41 +530,102 @@ public:
     UdpRxSocket& operator=(const UdpRxSocket&)     = delete;
     UdpRxSocket& operator=(UdpRxSocket&&) noexcept = delete;
 
-private:
+    /// Defines max size of a datagram, and so size of each datagram buffer.
+    ///
     static constexpr std::size_t BufferSize = 2000;
 
-    // MARK: IRxSocket
+private:
+    static constexpr std::size_t BatchSize = 16;
+    static_assert(BatchSize <= UDP_RX_BATCH_MAX, "");
 
-    CETL_NODISCARD ReceiveResult::Type receive() override
+    bool hasPendingDatagrams() const noexcept
     {
-        CETL_DEBUG_ASSERT(udp_handle_.fd >= 0, "");
+        return batch_head_ < batch_count_;
+    }
 
-        // Current Udpard api limitation is not allowing to pass bigger buffer than actual data size is.
-        // Hence, we need temp buffer on stack, and then memory copying.
-        // TODO: Eliminate tmp buffer and memmove when https://github.com/OpenCyphal/libudpard/issues/58 is resolved.
-        //
-        std::array<cetl::byte, BufferSize> buffer{};
-        std::size_t                        inout_size = buffer.size();
-        const std::int16_t                 result     = ::udpRxReceive(&udp_handle_, &inout_size, buffer.data());
+    /// Reads the next batch of datagrams (if any).
+    ///
+    /// Only buffers handed over to libcyphal are reallocated - the rest are reused by the next batch.
+    ///
+    CETL_NODISCARD cetl::optional<ReceiveResult::Failure> receiveBatch()
+    {
+        batch_head_  = 0;
+        batch_count_ = 0;
+
+        std::size_t available = 0;
+        for (auto& datagram : batch_)
+        {
+            if (datagram.payload == nullptr)
+            {
+                datagram.payload  = rx_memory_.allocate(BufferSize);
+                datagram.capacity = BufferSize;
+                if (datagram.payload == nullptr)
+                {
+                    break;
+                }
+            }
+            ++available;
+        }
+        if (available == 0)
+        {
+            return ReceiveResult::Failure{libcyphal::MemoryError{}};
+        }
+
+        const std::int16_t result = ::udpRxReceiveBatch(&udp_handle_, available, batch_.data());
         if (result < 0)
         {
-            return libcyphal::transport::PlatformError{ocvsmd::platform::PosixPlatformError{-result}};
+            if (health_.noteError(executor_.now(), -result, false))
+            {
+                common::getLogger("io")->warn("UDP media is down (err={}).", -result);
+            }
+            return ReceiveResult::Failure{
+                libcyphal::transport::PlatformError{ocvsmd::platform::PosixPlatformError{-result}}};
         }
-        if (result == 0)
+
+        batch_count_       = static_cast<std::size_t>(result);
+        batch_timestamp_   = executor_.now();
+        batch_realtime_ns_ = is_kernel_timestamped_ ? realtimeNowNs() : 0;
+        if (batch_count_ > 0)
         {
-            return cetl::nullopt;
+            ++wakeups_;
+            datagrams_ += batch_count_;
+            max_batch_ = std::max(max_batch_, batch_count_);
+            health_.noteRx(batch_timestamp_, batch_count_);
+            health_.noteKernelDrops(stats_entry_.stats().noteKernelDrops(udp_handle_.drops));
         }
-        //
-        auto* const allocated_buffer = memory_.allocate(inout_size);
-        if (nullptr == allocated_buffer)
+        return cetl::nullopt;
+    }
+
+    // MARK: IRxSocket
+
+    CETL_NODISCARD ReceiveResult::Type receive() override
+    {
+        CETL_DEBUG_ASSERT(udp_handle_.fd >= 0, "");
+
+        if (!hasPendingDatagrams())
         {
-            return libcyphal::MemoryError{};
+            if (auto failure = receiveBatch())
+            {
+                return std::move(*failure);
+            }
+            if (!hasPendingDatagrams())
+            {
+                return cetl::nullopt;
+            }
         }
-        (void) std::memmove(allocated_buffer, buffer.data(), inout_size);
 
-        return ReceiveResult::Metadata{executor_.now(),
-                                       {static_cast<cetl::byte*>(allocated_buffer),
-                                        libcyphal::PmrRawBytesDeleter{inout_size, &memory_}}};
+        // Hand over the datagram buffer "as is" - its ownership goes to libcyphal (and then to libudpard).
+        // Note that the deleter is given the datagram size (and not the buffer capacity) - this is what libudpard
+        // will use on deallocation (see https://github.com/OpenCyphal/libudpard/issues/58).
+        //
+        auto& datagram   = batch_[batch_head_++];
+        auto* const data = static_cast<cetl::byte*>(datagram.payload);
+        datagram.payload = nullptr;
+
+        const auto timestamp = is_kernel_timestamped_
+                                   ? fromKernelTimestamp(batch_timestamp_, batch_realtime_ns_, datagram.timestamp_ns)
+                                   : batch_timestamp_;
+        return ReceiveResult::Metadata{timestamp, {data, libcyphal::PmrRawBytesDeleter{datagram.size, &rx_memory_}}};
     }
 
     CETL_NODISCARD libcyphal::IExecutor::Callback::Any registerCallback(
@@ -220,17 +637,44 @@ private:
             return {};
         }
 
+        // libcyphal receives one datagram per callback call, but the socket will not become readable again
+        // (and so will not wake us up) if the whole batch has been already read out of it.
+        // Hence, the wrapper below drains all pending datagrams of the current batch within the same wakeup.
+        //
+        rx_function_ = std::move(function);
+
+        using Profiler = ocvsmd::platform::ExecutorProfiler;
         CETL_DEBUG_ASSERT(udp_handle_.fd >= 0, "");
         return posix_executor_ext->registerAwaitableCallback(  //
-            std::move(function),
+            [this, profiler = cetl::rtti_cast<Profiler*>(&executor_)](const auto& arg) {
+                //
+                const Profiler::Scope scope{profiler, Profiler::Category::UdpRx};
+                std::size_t calls = 0;
+                do
+                {
+                    rx_function_(arg);
+                } while (hasPendingDatagrams() && (++calls < BatchSize));
+            },
             ocvsmd::platform::IPosixExecutorExtension::Trigger::Readable{udp_handle_.fd});
     }
 
     // MARK: Data members:
 
-    UDPRxHandle                 udp_handle_;
-    libcyphal::IExecutor&       executor_;
-    cetl::pmr::memory_resource& memory_;
+    UDPRxHandle                              udp_handle_;
+    libcyphal::IExecutor&                    executor_;
+    cetl::pmr::memory_resource&              rx_memory_;
+    const bool                               is_kernel_timestamped_;
+    MediaHealth&                             health_;
+    SocketStatsRegistry::Entry               stats_entry_;
+    libcyphal::IExecutor::Callback::Function rx_function_;
+    std::array<UDPRxDatagram, BatchSize>     batch_{};
+    std::size_t                              batch_head_{0};
+    std::size_t                              batch_count_{0};
+    libcyphal::TimePoint                     batch_timestamp_{};
+    std::uint64_t                            batch_realtime_ns_{0};
+    std::uint64_t                            wakeups_{0};
+    std::uint64_t                            datagrams_{0};
+    std::size_t                              max_batch_{0};
 
 };  // UdpRxSocket
 
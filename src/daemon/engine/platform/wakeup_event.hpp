@@ -0,0 +1,108 @@
+//
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#ifndef OCVSMD_DAEMON_ENGINE_PLATFORM_WAKEUP_EVENT_HPP_INCLUDED
+#define OCVSMD_DAEMON_ENGINE_PLATFORM_WAKEUP_EVENT_HPP_INCLUDED
+
+#include <cstdint>
+#include <fcntl.h>
+#include <unistd.h>
+
+#ifndef PLATFORM_OS_TYPE_BSD
+#    include <sys/eventfd.h>
+#endif
+
+namespace ocvsmd
+{
+namespace daemon
+{
+namespace engine
+{
+namespace platform
+{
+
+/// Defines an event which wakes up the engine thread blocked in polling of the executor awaitables.
+///
+/// The `fd()` becomes readable when the event is signaled, so it should be registered (as an `Event` trigger)
+/// in the executor - which drains (resets) the event before its callback. `signal()` is async-signal-safe,
+/// so it could be called from a signal handler (or from any other thread).
+///
+/// Based on `eventfd` on Linux, and on a non-blocking "self-pipe" elsewhere.
+///
+class WakeupEvent final
+{
+public:
+    WakeupEvent()
+    {
+#ifdef PLATFORM_OS_TYPE_BSD
+        int fds[2]{-1, -1};  // NOLINT(*-avoid-c-arrays)
+        if (::pipe(fds) == 0)
+        {
+            for (const int fd : fds)
+            {
+                ::fcntl(fd, F_SETFL, ::fcntl(fd, F_GETFL) | O_NONBLOCK);  // NOLINT(*-vararg)
+                ::fcntl(fd, F_SETFD, FD_CLOEXEC);                         // NOLINT(*-vararg)
+            }
+            read_fd_  = fds[0];
+            write_fd_ = fds[1];
+        }
+#else
+        read_fd_  = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        write_fd_ = read_fd_;
+#endif
+    }
+
+    WakeupEvent(const WakeupEvent&)                = delete;
+    WakeupEvent(WakeupEvent&&) noexcept            = delete;
+    WakeupEvent& operator=(const WakeupEvent&)     = delete;
+    WakeupEvent& operator=(WakeupEvent&&) noexcept = delete;
+
+    ~WakeupEvent()
+    {
+        if (write_fd_ >= 0 && write_fd_ != read_fd_)
+        {
+            ::close(write_fd_);
+        }
+        if (read_fd_ >= 0)
+        {
+            ::close(read_fd_);
+        }
+    }
+
+    bool isValid() const noexcept
+    {
+        return read_fd_ >= 0;
+    }
+
+    /// Gets the file descriptor to await for (readability).
+    ///
+    int fd() const noexcept
+    {
+        return read_fd_;
+    }
+
+    /// Signals the event. Multiple signals (before the drain by the executor) are coalesced into one wake-up.
+    ///
+    void signal() const noexcept
+    {
+        if (write_fd_ >= 0)
+        {
+            const std::uint64_t value = 1;
+            (void) ::write(write_fd_, &value, sizeof(value));
+        }
+    }
+
+private:
+    int read_fd_{-1};
+    int write_fd_{-1};
+
+};  // WakeupEvent
+
+}  // namespace platform
+}  // namespace engine
+}  // namespace daemon
+}  // namespace ocvsmd
+
+#endif  // OCVSMD_DAEMON_ENGINE_PLATFORM_WAKEUP_EVENT_HPP_INCLUDED
@@ -0,0 +1,201 @@
+//
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "plugin_host.hpp"
+
+#include "config.hpp"
+#include "logging.hpp"
+#include "ocvsmd/plugin/plugin.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+#include <libcyphal/executor.hpp>
+#include <libcyphal/presentation/presentation.hpp>
+
+#include <cstddef>
+#include <dlfcn.h>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace ocvsmd
+{
+namespace daemon
+{
+namespace engine
+{
+namespace plugin
+{
+namespace
+{
+
+class PluginHostImpl final : public PluginHost
+{
+public:
+    PluginHostImpl(cetl::pmr::memory_resource&            memory,
+                   libcyphal::IExecutor&                  executor,
+                   libcyphal::presentation::Presentation& presentation)
+        : memory_{memory}
+        , executor_{executor}
+        , presentation_{presentation}
+    {
+    }
+
+    ~PluginHostImpl() override
+    {
+        // Unload in reverse order - later plugins might depend on earlier ones.
+        while (!loaded_.empty())
+        {
+            loaded_.pop_back();
+        }
+    }
+
+    PluginHostImpl(const PluginHostImpl&)                = delete;
+    PluginHostImpl(PluginHostImpl&&) noexcept            = delete;
+    PluginHostImpl& operator=(const PluginHostImpl&)     = delete;
+    PluginHostImpl& operator=(PluginHostImpl&&) noexcept = delete;
+
+    void load(const Config::Plugin& plugin_cfg)
+    {
+        logger_->debug("Loading plugin (path='{}')…", plugin_cfg.path);
+
+        // `RTLD_LOCAL` b/c plugins should not see (and clash with) symbols of each other.
+        //
+        auto loaded = std::make_unique<Loaded>(::dlopen(plugin_cfg.path.c_str(), RTLD_NOW | RTLD_LOCAL),
+                                               plugin_cfg.params,
+                                               memory_,
+                                               executor_,
+                                               presentation_);
+        if (loaded->dl_handle == nullptr)
+        {
+            logger_->error("Failed to load plugin (path='{}'): {}.", plugin_cfg.path, ::dlerror());
+            return;
+        }
+
+        const auto abi_version_fn = findSymbol<OcvsmdPluginAbiVersionFn>(*loaded, OCVSMD_PLUGIN_ABI_VERSION_SYMBOL);
+        const auto create_fn      = findSymbol<OcvsmdPluginCreateFn>(*loaded, OCVSMD_PLUGIN_CREATE_SYMBOL);
+        loaded->destroy_fn        = findSymbol<OcvsmdPluginDestroyFn>(*loaded, OCVSMD_PLUGIN_DESTROY_SYMBOL);
+        if ((abi_version_fn == nullptr) || (create_fn == nullptr) || (loaded->destroy_fn == nullptr))
+        {
+            logger_->error("Plugin doesn't export required entry points (path='{}').", plugin_cfg.path);
+            return;
+        }
+
+        const auto abi_version = abi_version_fn();
+        if (abi_version != ocvsmd::plugin::AbiVersion)
+        {
+            logger_->error("Incompatible plugin ABI version (path='{}', ver={}, expected={}).",
+                           plugin_cfg.path,
+                           abi_version,
+                           ocvsmd::plugin::AbiVersion);
+            return;
+        }
+
+        loaded->instance = create_fn(loaded->context);
+        if (loaded->instance == nullptr)
+        {
+            logger_->error("Failed to create plugin (path='{}').", plugin_cfg.path);
+            return;
+        }
+
+        logger_->info("Loaded plugin '{}' (path='{}').", loaded->instance->name(), plugin_cfg.path);
+        loaded_.push_back(std::move(loaded));
+    }
+
+    // PluginHost
+
+    std::size_t count() const noexcept override
+    {
+        return loaded_.size();
+    }
+
+    const char* pluginName(const std::size_t index) const noexcept override
+    {
+        return (index < loaded_.size()) ? loaded_[index]->instance->name() : nullptr;
+    }
+
+private:
+    /// Holds a loaded shared object, and (optionally) the plugin instance created by it.
+    ///
+    /// The instance is destroyed by the same shared object which has created it, and strictly before unloading.
+    /// The plugin context (and its params string) is owned here as well - so it outlives the instance.
+    ///
+    struct Loaded final
+    {
+        Loaded(void* const                            handle,
+               std::string                            params_str,
+               cetl::pmr::memory_resource&            memory,
+               libcyphal::IExecutor&                  executor,
+               libcyphal::presentation::Presentation& presentation)
+            : dl_handle{handle}
+            , params{std::move(params_str)}
+            , context{memory, executor, presentation, params.c_str()}
+        {
+        }
+
+        ~Loaded()
+        {
+            if ((instance != nullptr) && (destroy_fn != nullptr))
+            {
+                destroy_fn(instance);
+            }
+            if (dl_handle != nullptr)
+            {
+                (void) ::dlclose(dl_handle);
+            }
+        }
+
+        Loaded(const Loaded&)                = delete;
+        Loaded(Loaded&&) noexcept            = delete;
+        Loaded& operator=(const Loaded&)     = delete;
+        Loaded& operator=(Loaded&&) noexcept = delete;
+
+        // NOLINTBEGIN(*-non-private-member-variables-in-classes)
+        void*                         dl_handle;
+        const std::string             params;
+        const ocvsmd::plugin::Context context;
+        OcvsmdPluginDestroyFn         destroy_fn{nullptr};
+        ocvsmd::plugin::IPlugin*      instance{nullptr};
+        // NOLINTEND(*-non-private-member-variables-in-classes)
+
+    };  // Loaded
+
+    template <typename Fn>
+    static Fn findSymbol(const Loaded& loaded, const char* const symbol)
+    {
+        // No lint b/c `dlsym` API is inherently about such casting.
+        // NOLINTNEXTLINE(*-reinterpret-cast)
+        return reinterpret_cast<Fn>(::dlsym(loaded.dl_handle, symbol));
+    }
+
+    cetl::pmr::memory_resource&            memory_;
+    libcyphal::IExecutor&                  executor_;
+    libcyphal::presentation::Presentation& presentation_;
+    common::LoggerPtr                      logger_{common::getLogger("engine")};
+    std::vector<std::unique_ptr<Loaded>>   loaded_;
+
+};  // PluginHostImpl
+
+}  // namespace
+
+PluginHost::Ptr PluginHost::make(cetl::pmr::memory_resource&            memory,
+                                 libcyphal::IExecutor&                  executor,
+                                 libcyphal::presentation::Presentation& presentation,
+                                 const Config::Ptr&                     config)
+{
+    CETL_DEBUG_ASSERT(config, "");
+
+    auto host = std::make_unique<PluginHostImpl>(memory, executor, presentation);
+    for (const auto& plugin_cfg : config->getPlugins())
+    {
+        host->load(plugin_cfg);
+    }
+    return host;
+}
+
+}  // namespace plugin
+}  // namespace engine
+}  // namespace daemon
+}  // namespace ocvsmd
@@ -0,0 +1,75 @@
+//
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#ifndef OCVSMD_DAEMON_ENGINE_PLUGIN_PLUGIN_HOST_HPP_INCLUDED
+#define OCVSMD_DAEMON_ENGINE_PLUGIN_PLUGIN_HOST_HPP_INCLUDED
+
+#include "config.hpp"
+
+#include <cetl/cetl.hpp>
+#include <cetl/pf17/cetlpf.hpp>
+#include <libcyphal/executor.hpp>
+#include <libcyphal/presentation/presentation.hpp>
+
+#include <cstddef>
+#include <memory>
+
+namespace ocvsmd
+{
+namespace daemon
+{
+namespace engine
+{
+namespace plugin
+{
+
+/// @brief Defines host of in-process plugins (shared objects) listed in the configuration.
+///
+/// Each plugin is loaded (via `dlopen`), checked for ABI compatibility (see `ocvsmd/plugin/plugin.hpp`),
+/// and then created with references to the engine core components. Plugins are destroyed (and unloaded)
+/// in reverse order together with the host, so the host should be destroyed before the presentation layer.
+///
+class PluginHost
+{
+public:
+    using Ptr = std::unique_ptr<PluginHost>;
+
+    /// Loads all configured plugins.
+    ///
+    /// A plugin which fails to load is logged and skipped - it doesn't prevent other plugins from loading.
+    ///
+    CETL_NODISCARD static Ptr make(cetl::pmr::memory_resource&            memory,
+                                   libcyphal::IExecutor&                  executor,
+                                   libcyphal::presentation::Presentation& presentation,
+                                   const Config::Ptr&                     config);
+
+    PluginHost(const PluginHost&)                = delete;
+    PluginHost(PluginHost&&) noexcept            = delete;
+    PluginHost& operator=(const PluginHost&)     = delete;
+    PluginHost& operator=(PluginHost&&) noexcept = delete;
+
+    virtual ~PluginHost() = default;
+
+    /// Gets number of successfully loaded plugins.
+    ///
+    virtual std::size_t count() const noexcept = 0;
+
+    /// Gets name of a loaded plugin (as reported by the plugin itself) - by its index in the loading order.
+    ///
+    /// @return `nullptr` if the index is out of range.
+    ///
+    virtual const char* pluginName(const std::size_t index) const noexcept = 0;
+
+protected:
+    PluginHost() = default;
+
+};  // PluginHost
+
+}  // namespace plugin
+}  // namespace engine
+}  // namespace daemon
+}  // namespace ocvsmd
+
+#endif  // OCVSMD_DAEMON_ENGINE_PLUGIN_PLUGIN_HOST_HPP_INCLUDED
@@ -0,0 +1,142 @@
+//
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "executor_stats_service.hpp"
+
+#include "ipc/channel.hpp"
+#include "ipc/server_router.hpp"
+#include "logging.hpp"
+#include "ocvsmd/platform/executor_profiler.hpp"
+#include "ocvsmd/platform/log_linear_histogram.hpp"
+#include "svc/diag/executor_stats_spec.hpp"
+#include "svc/svc_helpers.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+#include <cetl/rtti.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+
+namespace ocvsmd
+{
+namespace daemon
+{
+namespace engine
+{
+namespace svc
+{
+namespace diag
+{
+namespace
+{
+
+/// Defines 'Diagnostics: Executor Stats' service implementation.
+///
+/// It's passed (as a functor) to the IPC server router to handle incoming service requests.
+/// See `ipc::ServerRouter::registerChannel` for details, and below `operator()` for the actual implementation.
+///
+class ExecutorStatsServiceImpl final
+{
+public:
+    using Spec    = common::svc::diag::ExecutorStatsSpec;
+    using Channel = common::ipc::Channel<Spec::Request, Spec::Response>;
+
+    explicit ExecutorStatsServiceImpl(const ScvContext& context)
+        : context_{context}
+    {
+    }
+
+    /// Handles the `diag::ExecutorStats` service request of a new IPC channel.
+    ///
+    /// The service is stateless (the stats are tracked by the executor profiler), has no async operations,
+    /// sends multiple responses (per each callback category, then the loop spins, and then their lateness),
+    /// and then completes the channel immediately. Nothing is sent if the executor doesn't support profiling.
+    ///
+    /// Defined as a functor operator - as it's required/expected by the IPC server router.
+    ///
+    void operator()(Channel channel, const Spec::Request&) const
+    {
+        using Profiler = ocvsmd::platform::ExecutorProfiler;
+
+        logger_->debug("New '{}' service channel.", Spec::svc_full_name());
+
+        if (const auto* const profiler = cetl::rtti_cast<const Profiler*>(&context_.executor))
+        {
+            const auto budget = toNanoseconds(profiler->callbackBudget());
+            for (std::size_t index = 0; index < Profiler::categoriesCount(); ++index)
+            {
+                const auto  category = static_cast<Profiler::Category>(index);
+                const auto& stats    = profiler->callbackStats(category);
+                sendReport(channel, Spec::Response::KIND_CALLBACK, Profiler::categoryName(category), stats, budget);
+            }
+            sendReport(channel, Spec::Response::KIND_SPIN, "spin", profiler->spinStats(), budget);
+            sendReport(channel, Spec::Response::KIND_LATENESS, "lateness", {profiler->latenessHistogram(), 0}, 0);
+        }
+
+        if (const auto opt_error = channel.complete())
+        {
+            logger_->warn("ExecutorStatsSvc: failed to send ipc completion (err={}).", *opt_error);
+        }
+    }
+
+private:
+    static std::uint64_t toNanoseconds(const ocvsmd::platform::ExecutorProfiler::Duration duration)
+    {
+        return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count());
+    }
+
+    void sendReport(Channel&                                         channel,
+                    const std::uint8_t                               kind,
+                    const char* const                                name,
+                    const ocvsmd::platform::ExecutorProfiler::Stats& stats,
+                    const std::uint64_t                              budget_ns) const
+    {
+        constexpr auto MaxNameLen = Spec::Response::_traits_::ArrayCapacity::name;
+
+        const auto& histogram = stats.histogram;
+
+        Spec::Response ipc_response{&context_.memory};
+        ipc_response.kind = kind;
+        const auto name_len = std::min<std::size_t>(std::strlen(name), MaxNameLen);
+        std::copy_n(name, name_len, std::back_inserter(ipc_response.name));
+        ipc_response.count       = histogram.count();
+        ipc_response.total_ns    = histogram.sum();
+        ipc_response.max_ns      = histogram.max();
+        ipc_response.p50_ns      = histogram.percentile(50.0);  // NOLINT(*-magic-numbers)
+        ipc_response.p90_ns      = histogram.percentile(90.0);  // NOLINT(*-magic-numbers)
+        ipc_response.p99_ns      = histogram.percentile(99.0);  // NOLINT(*-magic-numbers)
+        ipc_response.p999_ns     = histogram.percentile(99.9);  // NOLINT(*-magic-numbers)
+        ipc_response.over_budget = stats.over_budget;
+        ipc_response.budget_ns   = budget_ns;
+
+        if (const auto opt_error = channel.send(ipc_response))
+        {
+            logger_->warn("ExecutorStatsSvc: failed to send ipc response (err={}).", *opt_error);
+        }
+    }
+
+    const ScvContext  context_;
+    common::LoggerPtr logger_{common::getLogger("engine")};
+
+};  // ExecutorStatsServiceImpl
+
+}  // namespace
+
+void ExecutorStatsService::registerWithContext(const ScvContext& context)
+{
+    using Impl = ExecutorStatsServiceImpl;
+
+    context.ipc_router.registerChannel<Impl::Channel>(Impl::Spec::svc_full_name(), Impl{context});
+}
+
+}  // namespace diag
+}  // namespace svc
+}  // namespace engine
+}  // namespace daemon
+}  // namespace ocvsmd
@@ -0,0 +1,41 @@
+//
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#ifndef OCVSMD_DAEMON_ENGINE_SVC_DIAG_EXECUTOR_STATS_SERVICE_HPP_INCLUDED
+#define OCVSMD_DAEMON_ENGINE_SVC_DIAG_EXECUTOR_STATS_SERVICE_HPP_INCLUDED
+
+#include "svc/svc_helpers.hpp"
+
+namespace ocvsmd
+{
+namespace daemon
+{
+namespace engine
+{
+namespace svc
+{
+namespace diag
+{
+
+/// Defines registration factory of the 'Diagnostics: Executor Stats' service.
+///
+/// Stats are of the engine executor only. In the `dedicated_ipc` threading mode IPC sockets are served
+/// by another executor (see `threading::ThreadedServerPipe`), so the `ipc_*` callback stats are zero then.
+///
+class ExecutorStatsService
+{
+public:
+    ExecutorStatsService() = delete;
+    static void registerWithContext(const ScvContext& context);
+
+};  // ExecutorStatsService
+
+}  // namespace diag
+}  // namespace svc
+}  // namespace engine
+}  // namespace daemon
+}  // namespace ocvsmd
+
+#endif  // OCVSMD_DAEMON_ENGINE_SVC_DIAG_EXECUTOR_STATS_SERVICE_HPP_INCLUDED
@@ -0,0 +1,152 @@
+//
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "media_health_service.hpp"
+
+#include "cyphal/any_transport_bag.hpp"
+#include "ipc/channel.hpp"
+#include "ipc/server_router.hpp"
+#include "logging.hpp"
+#include "platform/media_health.hpp"
+#include "svc/diag/media_health_spec.hpp"
+#include "svc/svc_helpers.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+#include <libcyphal/types.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+
+namespace ocvsmd
+{
+namespace daemon
+{
+namespace engine
+{
+namespace svc
+{
+namespace diag
+{
+namespace
+{
+
+/// Defines 'Diagnostics: Media Health' service implementation.
+///
+/// It's passed (as a functor) to the IPC server router to handle incoming service requests.
+/// See `ipc::ServerRouter::registerChannel` for details, and below `operator()` for the actual implementation.
+///
+class MediaHealthServiceImpl final
+{
+public:
+    using Spec    = common::svc::diag::MediaHealthSpec;
+    using Channel = common::ipc::Channel<Spec::Request, Spec::Response>;
+
+    MediaHealthServiceImpl(const ScvContext&              context,
+                           const cyphal::AnyTransportBag& transport_bag,
+                           const cyphal::AnyTransportBag* bridge_transport_bag)
+        : context_{context}
+        , transport_bag_{transport_bag}
+        , bridge_transport_bag_{bridge_transport_bag}
+    {
+    }
+
+    /// Handles the `diag::MediaHealth` service request of a new IPC channel.
+    ///
+    /// The service is stateless (the health is tracked by the media themselves), has no async operations,
+    /// sends multiple responses (per each media of the primary transport, and then of the bridge one - if any),
+    /// and then completes the channel immediately.
+    ///
+    /// Defined as a functor operator - as it's required/expected by the IPC server router.
+    ///
+    void operator()(Channel channel, const Spec::Request&) const
+    {
+        logger_->debug("New '{}' service channel.", Spec::svc_full_name());
+
+        const auto now = context_.executor.now();
+        sendReports(channel, now, Spec::Response::TRANSPORT_PRIMARY, transport_bag_);
+        if (bridge_transport_bag_ != nullptr)
+        {
+            sendReports(channel, now, Spec::Response::TRANSPORT_BRIDGE, *bridge_transport_bag_);
+        }
+
+        if (const auto opt_error = channel.complete())
+        {
+            logger_->warn("MediaHealthSvc: failed to send ipc completion (err={}).", *opt_error);
+        }
+    }
+
+private:
+    void sendReports(Channel&                       channel,
+                     const libcyphal::TimePoint     now,
+                     const std::uint8_t             transport,
+                     const cyphal::AnyTransportBag& transport_bag) const
+    {
+        constexpr auto MaxIfaceLen = Spec::Response::_traits_::ArrayCapacity::iface_address;
+
+        Spec::Response ipc_response{&context_.memory};
+        ipc_response.transport = transport;
+
+        const auto reports = transport_bag.getMediaHealthReports();
+        for (std::size_t index = 0; index < reports.size(); ++index)
+        {
+            const auto& report = reports[index];
+            const auto& health = report.health;
+
+            ipc_response.media_index = static_cast<std::uint8_t>(index);
+            ipc_response.iface_address.clear();
+            const auto iface_len = std::min<std::size_t>(report.iface_address.size(), MaxIfaceLen);
+            std::copy_n(report.iface_address.cbegin(), iface_len, std::back_inserter(ipc_response.iface_address));
+
+            ipc_response.is_up           = health.is_up;
+            ipc_response.rx_frames       = health.rx_frames;
+            ipc_response.tx_frames       = health.tx_frames;
+            ipc_response.rx_errors       = health.rx_errors;
+            ipc_response.rx_kernel_drops = health.rx_kernel_drops;
+            ipc_response.tx_errors       = health.tx_errors;
+            ipc_response.tx_skipped      = health.tx_skipped;
+            ipc_response.reopens         = health.reopens;
+            ipc_response.last_errno      = health.last_error;
+
+            ipc_response.last_rx_age_us = Spec::Response::NEVER;
+            if (health.rx_frames > 0)
+            {
+                const auto age = std::chrono::duration_cast<std::chrono::microseconds>(now - health.last_rx_time);
+                ipc_response.last_rx_age_us = static_cast<std::uint64_t>(std::max<std::int64_t>(age.count(), 0));
+            }
+
+            if (const auto opt_error = channel.send(ipc_response))
+            {
+                logger_->warn("MediaHealthSvc: failed to send ipc response (err={}).", *opt_error);
+            }
+        }
+    }
+
+    const ScvContext               context_;
+    const cyphal::AnyTransportBag& transport_bag_;
+    const cyphal::AnyTransportBag* bridge_transport_bag_;
+    common::LoggerPtr              logger_{common::getLogger("engine")};
+
+};  // MediaHealthServiceImpl
+
+}  // namespace
+
+void MediaHealthService::registerWithContext(const ScvContext&              context,
+                                             const cyphal::AnyTransportBag& transport_bag,
+                                             const cyphal::AnyTransportBag* bridge_transport_bag)
+{
+    using Impl = MediaHealthServiceImpl;
+
+    context.ipc_router.registerChannel<Impl::Channel>(Impl::Spec::svc_full_name(),
+                                                      Impl{context, transport_bag, bridge_transport_bag});
+}
+
+}  // namespace diag
+}  // namespace svc
+}  // namespace engine
+}  // namespace daemon
+}  // namespace ocvsmd
@@ -0,0 +1,41 @@
+//
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#ifndef OCVSMD_DAEMON_ENGINE_SVC_DIAG_MEDIA_HEALTH_SERVICE_HPP_INCLUDED
+#define OCVSMD_DAEMON_ENGINE_SVC_DIAG_MEDIA_HEALTH_SERVICE_HPP_INCLUDED
+
+#include "cyphal/any_transport_bag.hpp"
+#include "svc/svc_helpers.hpp"
+
+namespace ocvsmd
+{
+namespace daemon
+{
+namespace engine
+{
+namespace svc
+{
+namespace diag
+{
+
+/// Defines registration factory of the 'Diagnostics: Media Health' service.
+///
+class MediaHealthService
+{
+public:
+    MediaHealthService() = delete;
+    static void registerWithContext(const ScvContext&              context,
+                                    const cyphal::AnyTransportBag& transport_bag,
+                                    const cyphal::AnyTransportBag* bridge_transport_bag);
+
+};  // MediaHealthService
+
+}  // namespace diag
+}  // namespace svc
+}  // namespace engine
+}  // namespace daemon
+}  // namespace ocvsmd
+
+#endif  // OCVSMD_DAEMON_ENGINE_SVC_DIAG_MEDIA_HEALTH_SERVICE_HPP_INCLUDED
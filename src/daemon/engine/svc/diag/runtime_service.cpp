@@ -0,0 +1,123 @@
+//
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "runtime_service.hpp"
+
+#include "ipc/channel.hpp"
+#include "ipc/server_router.hpp"
+#include "logging.hpp"
+#include "platform/runtime_status.hpp"
+#include "svc/diag/runtime_spec.hpp"
+#include "svc/svc_helpers.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+
+#include <cstdint>
+#include <sched.h>
+
+namespace ocvsmd
+{
+namespace daemon
+{
+namespace engine
+{
+namespace svc
+{
+namespace diag
+{
+namespace
+{
+
+/// Defines 'Diagnostics: Runtime' service implementation.
+///
+/// It's passed (as a functor) to the IPC server router to handle incoming service requests.
+/// See `ipc::ServerRouter::registerChannel` for details, and below `operator()` for the actual implementation.
+///
+class RuntimeServiceImpl final
+{
+public:
+    using Spec    = common::svc::diag::RuntimeSpec;
+    using Channel = common::ipc::Channel<Spec::Request, Spec::Response>;
+
+    explicit RuntimeServiceImpl(const ScvContext& context)
+        : context_{context}
+    {
+    }
+
+    /// Handles the `diag::Runtime` service request of a new IPC channel.
+    ///
+    /// The service is stateless (settings are queried from the OS on the engine thread), has no async operations,
+    /// sends a single response, and then completes the channel immediately.
+    ///
+    /// Defined as a functor operator - as it's required/expected by the IPC server router.
+    ///
+    void operator()(Channel channel, const Spec::Request&) const
+    {
+        constexpr auto MaxCpus = Spec::Response::_traits_::ArrayCapacity::cpu_affinity;
+
+        logger_->debug("New '{}' service channel.", Spec::svc_full_name());
+
+        const auto status = platform::RuntimeStatus::query();
+
+        Spec::Response ipc_response{&context_.memory};
+        ipc_response.sched_policy   = toPolicy(status.sched_policy);
+        ipc_response.sched_priority = status.sched_priority;
+        for (const auto cpu : status.cpu_affinity)
+        {
+            if (ipc_response.cpu_affinity.size() == MaxCpus)
+            {
+                break;
+            }
+            ipc_response.cpu_affinity.push_back(static_cast<std::uint16_t>(cpu));
+        }
+        ipc_response.locked_bytes = status.locked_bytes;
+        ipc_response.minor_faults = status.minor_faults;
+        ipc_response.major_faults = status.major_faults;
+
+        if (const auto opt_error = channel.send(ipc_response))
+        {
+            logger_->warn("RuntimeSvc: failed to send ipc response (err={}).", *opt_error);
+        }
+        if (const auto opt_error = channel.complete())
+        {
+            logger_->warn("RuntimeSvc: failed to send ipc completion (err={}).", *opt_error);
+        }
+    }
+
+private:
+    static std::uint8_t toPolicy(const int sched_policy)
+    {
+        switch (sched_policy)
+        {
+        case SCHED_OTHER:
+            return Spec::Response::POLICY_OTHER;
+        case SCHED_FIFO:
+            return Spec::Response::POLICY_FIFO;
+        case SCHED_RR:
+            return Spec::Response::POLICY_RR;
+        default:
+            return Spec::Response::POLICY_UNKNOWN;
+        }
+    }
+
+    const ScvContext  context_;
+    common::LoggerPtr logger_{common::getLogger("engine")};
+
+};  // RuntimeServiceImpl
+
+}  // namespace
+
+void RuntimeService::registerWithContext(const ScvContext& context)
+{
+    using Impl = RuntimeServiceImpl;
+
+    context.ipc_router.registerChannel<Impl::Channel>(Impl::Spec::svc_full_name(), Impl{context});
+}
+
+}  // namespace diag
+}  // namespace svc
+}  // namespace engine
+}  // namespace daemon
+}  // namespace ocvsmd
@@ -0,0 +1,38 @@
+//
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#ifndef OCVSMD_DAEMON_ENGINE_SVC_DIAG_RUNTIME_SERVICE_HPP_INCLUDED
+#define OCVSMD_DAEMON_ENGINE_SVC_DIAG_RUNTIME_SERVICE_HPP_INCLUDED
+
+#include "svc/svc_helpers.hpp"
+
+namespace ocvsmd
+{
+namespace daemon
+{
+namespace engine
+{
+namespace svc
+{
+namespace diag
+{
+
+/// Defines registration factory of the 'Diagnostics: Runtime' service.
+///
+class RuntimeService
+{
+public:
+    RuntimeService() = delete;
+    static void registerWithContext(const ScvContext& context);
+
+};  // RuntimeService
+
+}  // namespace diag
+}  // namespace svc
+}  // namespace engine
+}  // namespace daemon
+}  // namespace ocvsmd
+
+#endif  // OCVSMD_DAEMON_ENGINE_SVC_DIAG_RUNTIME_SERVICE_HPP_INCLUDED
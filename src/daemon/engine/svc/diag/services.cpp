@@ -0,0 +1,42 @@
+//
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "services.hpp"
+
+#include "cyphal/any_transport_bag.hpp"
+#include "executor_stats_service.hpp"
+#include "media_health_service.hpp"
+#include "runtime_service.hpp"
+#include "sockets_service.hpp"
+#include "svc/svc_helpers.hpp"
+#include "tx_queues_service.hpp"
+
+namespace ocvsmd
+{
+namespace daemon
+{
+namespace engine
+{
+namespace svc
+{
+namespace diag
+{
+
+void registerAllServices(const ScvContext&              context,
+                         const cyphal::AnyTransportBag& transport_bag,
+                         const cyphal::AnyTransportBag* bridge_transport_bag)
+{
+    MediaHealthService::registerWithContext(context, transport_bag, bridge_transport_bag);
+    TxQueuesService::registerWithContext(context, transport_bag, bridge_transport_bag);
+    SocketsService::registerWithContext(context, transport_bag, bridge_transport_bag);
+    ExecutorStatsService::registerWithContext(context);
+    RuntimeService::registerWithContext(context);
+}
+
+}  // namespace diag
+}  // namespace svc
+}  // namespace engine
+}  // namespace daemon
+}  // namespace ocvsmd
@@ -0,0 +1,41 @@
+//
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#ifndef OCVSMD_DAEMON_ENGINE_SVC_DIAG_SERVICES_HPP_INCLUDED
+#define OCVSMD_DAEMON_ENGINE_SVC_DIAG_SERVICES_HPP_INCLUDED
+
+#include "cyphal/any_transport_bag.hpp"
+#include "svc/svc_helpers.hpp"
+
+namespace ocvsmd
+{
+namespace daemon
+{
+namespace engine
+{
+namespace svc
+{
+namespace diag
+{
+
+/// Registers all "diag"-related services.
+///
+/// The bridge transport bag is optional (`nullptr` if there is no bridge).
+///
+/// Note that these services are IPC-only - the SDK (and so the CLI) intentionally has no clients for them.
+/// They are meant for ad hoc introspection tools talking the `ocvsmd.svc.diag.*` IPC protocol directly,
+/// so their DSDL schemas (see `ocvsmd/common/svc/diag/`) are free to change between daemon releases.
+///
+void registerAllServices(const ScvContext&              context,
+                         const cyphal::AnyTransportBag& transport_bag,
+                         const cyphal::AnyTransportBag* bridge_transport_bag);
+
+}  // namespace diag
+}  // namespace svc
+}  // namespace engine
+}  // namespace daemon
+}  // namespace ocvsmd
+
+#endif  // OCVSMD_DAEMON_ENGINE_SVC_DIAG_SERVICES_HPP_INCLUDED
@@ -0,0 +1,142 @@
+//
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "sockets_service.hpp"
+
+#include "cyphal/any_transport_bag.hpp"
+#include "ipc/channel.hpp"
+#include "ipc/server_router.hpp"
+#include "logging.hpp"
+#include "platform/socket_stats.hpp"
+#include "svc/diag/sockets_spec.hpp"
+#include "svc/svc_helpers.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+
+namespace ocvsmd
+{
+namespace daemon
+{
+namespace engine
+{
+namespace svc
+{
+namespace diag
+{
+namespace
+{
+
+/// Defines 'Diagnostics: Sockets' service implementation.
+///
+/// It's passed (as a functor) to the IPC server router to handle incoming service requests.
+/// See `ipc::ServerRouter::registerChannel` for details, and below `operator()` for the actual implementation.
+///
+class SocketsServiceImpl final
+{
+public:
+    using Spec    = common::svc::diag::SocketsSpec;
+    using Channel = common::ipc::Channel<Spec::Request, Spec::Response>;
+
+    SocketsServiceImpl(const ScvContext&              context,
+                       const cyphal::AnyTransportBag& transport_bag,
+                       const cyphal::AnyTransportBag* bridge_transport_bag)
+        : context_{context}
+        , transport_bag_{transport_bag}
+        , bridge_transport_bag_{bridge_transport_bag}
+    {
+    }
+
+    /// Handles the `diag::Sockets` service request of a new IPC channel.
+    ///
+    /// The service is stateless (the stats are tracked by the media themselves), has no async operations,
+    /// sends multiple responses (per each live socket of each media of the primary transport, and then
+    /// of the bridge one - if any), and then completes the channel immediately.
+    ///
+    /// Defined as a functor operator - as it's required/expected by the IPC server router.
+    ///
+    void operator()(Channel channel, const Spec::Request&) const
+    {
+        logger_->debug("New '{}' service channel.", Spec::svc_full_name());
+
+        sendReports(channel, Spec::Response::TRANSPORT_PRIMARY, transport_bag_);
+        if (bridge_transport_bag_ != nullptr)
+        {
+            sendReports(channel, Spec::Response::TRANSPORT_BRIDGE, *bridge_transport_bag_);
+        }
+
+        if (const auto opt_error = channel.complete())
+        {
+            logger_->warn("SocketsSvc: failed to send ipc completion (err={}).", *opt_error);
+        }
+    }
+
+private:
+    void sendReports(Channel& channel, const std::uint8_t transport, const cyphal::AnyTransportBag& transport_bag) const
+    {
+        constexpr auto MaxIfaceLen    = Spec::Response::_traits_::ArrayCapacity::iface_address;
+        constexpr auto MaxEndpointLen = Spec::Response::_traits_::ArrayCapacity::endpoint;
+
+        Spec::Response ipc_response{&context_.memory};
+        ipc_response.transport = transport;
+
+        const auto reports = transport_bag.getMediaSocketsReports();
+        for (std::size_t index = 0; index < reports.size(); ++index)
+        {
+            const auto& report = reports[index];
+
+            ipc_response.media_index = static_cast<std::uint8_t>(index);
+            ipc_response.iface_address.clear();
+            const auto iface_len = std::min<std::size_t>(report.iface_address.size(), MaxIfaceLen);
+            std::copy_n(report.iface_address.cbegin(), iface_len, std::back_inserter(ipc_response.iface_address));
+
+            for (const auto& socket : report.sockets)
+            {
+                ipc_response.endpoint.clear();
+                const auto endpoint_len = std::min<std::size_t>(socket.endpoint.size(), MaxEndpointLen);
+                std::copy_n(socket.endpoint.cbegin(), endpoint_len, std::back_inserter(ipc_response.endpoint));
+
+                ipc_response.is_rx        = socket.is_rx;
+                ipc_response.buffer_size  = static_cast<std::uint32_t>(
+                    std::min<std::size_t>(socket.buffer_size, std::numeric_limits<std::uint32_t>::max()));
+                ipc_response.kernel_drops = socket.kernel_drops;
+
+                if (const auto opt_error = channel.send(ipc_response))
+                {
+                    logger_->warn("SocketsSvc: failed to send ipc response (err={}).", *opt_error);
+                }
+            }
+        }
+    }
+
+    const ScvContext               context_;
+    const cyphal::AnyTransportBag& transport_bag_;
+    const cyphal::AnyTransportBag* bridge_transport_bag_;
+    common::LoggerPtr              logger_{common::getLogger("engine")};
+
+};  // SocketsServiceImpl
+
+}  // namespace
+
+void SocketsService::registerWithContext(const ScvContext&              context,
+                                         const cyphal::AnyTransportBag& transport_bag,
+                                         const cyphal::AnyTransportBag* bridge_transport_bag)
+{
+    using Impl = SocketsServiceImpl;
+
+    context.ipc_router.registerChannel<Impl::Channel>(Impl::Spec::svc_full_name(),
+                                                      Impl{context, transport_bag, bridge_transport_bag});
+}
+
+}  // namespace diag
+}  // namespace svc
+}  // namespace engine
+}  // namespace daemon
+}  // namespace ocvsmd
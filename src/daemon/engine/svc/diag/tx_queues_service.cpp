@@ -0,0 +1,121 @@
+//
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "tx_queues_service.hpp"
+
+#include "cyphal/any_transport_bag.hpp"
+#include "ipc/channel.hpp"
+#include "ipc/server_router.hpp"
+#include "logging.hpp"
+#include "svc/diag/tx_queues_spec.hpp"
+#include "svc/svc_helpers.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+
+#include <cstdint>
+
+namespace ocvsmd
+{
+namespace daemon
+{
+namespace engine
+{
+namespace svc
+{
+namespace diag
+{
+namespace
+{
+
+/// Defines 'Diagnostics: TX Queues' service implementation.
+///
+/// It's passed (as a functor) to the IPC server router to handle incoming service requests.
+/// See `ipc::ServerRouter::registerChannel` for details, and below `operator()` for the actual implementation.
+///
+class TxQueuesServiceImpl final
+{
+public:
+    using Spec    = common::svc::diag::TxQueuesSpec;
+    using Channel = common::ipc::Channel<Spec::Request, Spec::Response>;
+
+    TxQueuesServiceImpl(const ScvContext&              context,
+                        const cyphal::AnyTransportBag& transport_bag,
+                        const cyphal::AnyTransportBag* bridge_transport_bag)
+        : context_{context}
+        , transport_bag_{transport_bag}
+        , bridge_transport_bag_{bridge_transport_bag}
+    {
+    }
+
+    /// Handles the `diag::TxQueues` service request of a new IPC channel.
+    ///
+    /// The service is stateless (the queues are tracked by the transport bags), has no async operations,
+    /// sends a response per transport (the primary one, and then the bridge one - if any),
+    /// and then completes the channel immediately.
+    ///
+    /// Defined as a functor operator - as it's required/expected by the IPC server router.
+    ///
+    void operator()(Channel channel, const Spec::Request&) const
+    {
+        logger_->debug("New '{}' service channel.", Spec::svc_full_name());
+
+        sendStats(channel, Spec::Response::TRANSPORT_PRIMARY, transport_bag_);
+        if (bridge_transport_bag_ != nullptr)
+        {
+            sendStats(channel, Spec::Response::TRANSPORT_BRIDGE, *bridge_transport_bag_);
+        }
+
+        if (const auto opt_error = channel.complete())
+        {
+            logger_->warn("TxQueuesSvc: failed to send ipc completion (err={}).", *opt_error);
+        }
+    }
+
+private:
+    void sendStats(Channel& channel, const std::uint8_t transport, const cyphal::AnyTransportBag& transport_bag) const
+    {
+        const auto stats = transport_bag.getTxQueueStats();
+
+        Spec::Response ipc_response{&context_.memory};
+        ipc_response.transport   = transport;
+        ipc_response.is_adaptive = stats.is_adaptive;
+        ipc_response.capacity    = static_cast<std::uint32_t>(stats.capacity);
+        ipc_response.depth       = static_cast<std::uint32_t>(stats.depth);
+        ipc_response.depth_hwm   = static_cast<std::uint32_t>(stats.depth_hwm);
+        ipc_response.bytes       = stats.bytes;
+        ipc_response.bytes_hwm   = stats.bytes_hwm;
+        ipc_response.overflows   = stats.overflows;
+        ipc_response.grows       = stats.grows;
+
+        if (const auto opt_error = channel.send(ipc_response))
+        {
+            logger_->warn("TxQueuesSvc: failed to send ipc response (err={}).", *opt_error);
+        }
+    }
+
+    const ScvContext               context_;
+    const cyphal::AnyTransportBag& transport_bag_;
+    const cyphal::AnyTransportBag* bridge_transport_bag_;
+    common::LoggerPtr              logger_{common::getLogger("engine")};
+
+};  // TxQueuesServiceImpl
+
+}  // namespace
+
+void TxQueuesService::registerWithContext(const ScvContext&              context,
+                                          const cyphal::AnyTransportBag& transport_bag,
+                                          const cyphal::AnyTransportBag* bridge_transport_bag)
+{
+    using Impl = TxQueuesServiceImpl;
+
+    context.ipc_router.registerChannel<Impl::Channel>(Impl::Spec::svc_full_name(),
+                                                      Impl{context, transport_bag, bridge_transport_bag});
+}
+
+}  // namespace diag
+}  // namespace svc
+}  // namespace engine
+}  // namespace daemon
+}  // namespace ocvsmd
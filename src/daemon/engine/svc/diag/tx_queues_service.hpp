@@ -0,0 +1,41 @@
+//
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#ifndef OCVSMD_DAEMON_ENGINE_SVC_DIAG_TX_QUEUES_SERVICE_HPP_INCLUDED
+#define OCVSMD_DAEMON_ENGINE_SVC_DIAG_TX_QUEUES_SERVICE_HPP_INCLUDED
+
+#include "cyphal/any_transport_bag.hpp"
+#include "svc/svc_helpers.hpp"
+
+namespace ocvsmd
+{
+namespace daemon
+{
+namespace engine
+{
+namespace svc
+{
+namespace diag
+{
+
+/// Defines registration factory of the 'Diagnostics: TX Queues' service.
+///
+class TxQueuesService
+{
+public:
+    TxQueuesService() = delete;
+    static void registerWithContext(const ScvContext&              context,
+                                    const cyphal::AnyTransportBag& transport_bag,
+                                    const cyphal::AnyTransportBag* bridge_transport_bag);
+
+};  // TxQueuesService
+
+}  // namespace diag
+}  // namespace svc
+}  // namespace engine
+}  // namespace daemon
+}  // namespace ocvsmd
+
+#endif  // OCVSMD_DAEMON_ENGINE_SVC_DIAG_TX_QUEUES_SERVICE_HPP_INCLUDED
@@ -209,7 +209,11 @@ private:
             if (const auto cy_failure = cy_raw_publisher_->publish(deadline, fragments))
             {
                 opt_error = cyFailureToOptError(*cy_failure);
-                logger().warn("RawPublisherSvc: failed to publish raw message (err={}, fsm_id={})", opt_error, id_);
+                OCVSMD_LOG_RATE_LIMITED(logger(),
+                                        spdlog::level::warn,
+                                        "RawPublisherSvc: failed to publish raw message (err={}, fsm_id={})",
+                                        opt_error,
+                                        id_);
             }
 
             sendPublishResponse(opt_error);
@@ -244,9 +248,11 @@ private:
 
             if (const auto send_opt_error = channel_.send(ipc_response))
             {
-                logger().warn("RawPublisherSvc: failed to send ipc response (err={}, fsm_id={}).",
-                              *send_opt_error,
-                              id_);
+                OCVSMD_LOG_RATE_LIMITED(logger(),
+                                        spdlog::level::warn,
+                                        "RawPublisherSvc: failed to send ipc response (err={}, fsm_id={}).",
+                                        *send_opt_error,
+                                        id_);
             }
         }
 
@@ -180,7 +180,11 @@ private:
             common::io::SocketBuffer sock_buff{raw_msg_buff};
             if (const auto opt_error = channel_.send(ipc_response, sock_buff))
             {
-                logger().warn("RawSubscriberSvc: failed to send ipc response (err={}, fsm_id={}).", *opt_error, id_);
+                OCVSMD_LOG_RATE_LIMITED(logger(),
+                                        spdlog::level::warn,
+                                        "RawSubscriberSvc: failed to send ipc response (err={}, fsm_id={}).",
+                                        *opt_error,
+                                        id_);
             }
         }
 
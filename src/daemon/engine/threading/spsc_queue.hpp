@@ -0,0 +1,127 @@
+//
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#ifndef OCVSMD_DAEMON_ENGINE_THREADING_SPSC_QUEUE_HPP_INCLUDED
+#define OCVSMD_DAEMON_ENGINE_THREADING_SPSC_QUEUE_HPP_INCLUDED
+
+#include <atomic>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace ocvsmd
+{
+namespace daemon
+{
+namespace engine
+{
+namespace threading
+{
+
+/// Defines bounded lock-free queue of a single producer thread and a single consumer thread.
+///
+/// Items are moved in and out of preallocated slots - so neither `tryPush` nor `tryPop` allocate memory
+/// (the item itself may own some though). The capacity is rounded up to a power of two.
+///
+/// Head (of the consumer) and tail (of the producer) indices live on separate cache lines,
+/// and each side caches the last seen index of the other side - so that the shared cache lines are touched
+/// only when the queue looks full (or empty).
+///
+template <typename T>
+class SpscQueue final
+{
+public:
+    explicit SpscQueue(const std::size_t capacity)
+        : slots_(roundUpToPowerOfTwo(capacity))
+        , mask_{slots_.size() - 1}
+    {
+    }
+
+    SpscQueue(const SpscQueue&)                = delete;
+    SpscQueue(SpscQueue&&) noexcept            = delete;
+    SpscQueue& operator=(const SpscQueue&)     = delete;
+    SpscQueue& operator=(SpscQueue&&) noexcept = delete;
+
+    ~SpscQueue() = default;
+
+    std::size_t capacity() const noexcept
+    {
+        return slots_.size();
+    }
+
+    /// Pushes the item to the tail of the queue. Called by the producer thread only.
+    ///
+    /// @return `false` if the queue is full - the item is left intact then.
+    ///
+    bool tryPush(T&& item)
+    {
+        const auto tail = tail_.load(std::memory_order_relaxed);
+        if ((tail - head_cache_) == slots_.size())
+        {
+            head_cache_ = head_.load(std::memory_order_acquire);
+            if ((tail - head_cache_) == slots_.size())
+            {
+                return false;
+            }
+        }
+        slots_[tail & mask_] = std::move(item);
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /// Pops the item from the head of the queue. Called by the consumer thread only.
+    ///
+    /// @return `false` if the queue is empty.
+    ///
+    bool tryPop(T& item)
+    {
+        const auto head = head_.load(std::memory_order_relaxed);
+        if (head == tail_cache_)
+        {
+            tail_cache_ = tail_.load(std::memory_order_acquire);
+            if (head == tail_cache_)
+            {
+                return false;
+            }
+        }
+        item = std::move(slots_[head & mask_]);
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+private:
+    static constexpr std::size_t CacheLineSize = 64;
+
+    static std::size_t roundUpToPowerOfTwo(const std::size_t value)
+    {
+        std::size_t result = 1;
+        while (result < value)
+        {
+            result <<= 1U;
+        }
+        return result;
+    }
+
+    // MARK: Data members:
+
+    std::vector<T>    slots_;
+    const std::size_t mask_;
+
+    // Consumer side.
+    alignas(CacheLineSize) std::atomic<std::size_t> head_{0};
+    std::size_t tail_cache_{0};
+
+    // Producer side.
+    alignas(CacheLineSize) std::atomic<std::size_t> tail_{0};
+    std::size_t head_cache_{0};
+
+};  // SpscQueue
+
+}  // namespace threading
+}  // namespace engine
+}  // namespace daemon
+}  // namespace ocvsmd
+
+#endif  // OCVSMD_DAEMON_ENGINE_THREADING_SPSC_QUEUE_HPP_INCLUDED
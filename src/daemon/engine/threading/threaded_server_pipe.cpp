@@ -0,0 +1,261 @@
+//
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "threaded_server_pipe.hpp"
+
+#include "io/socket_address.hpp"
+#include "io/socket_buffer.hpp"
+#include "ipc/pipe/server_pipe.hpp"
+#include "ipc/pipe/socket_server.hpp"
+#include "logging.hpp"
+#include "ocvsmd/platform/defines.hpp"
+#include "ocvsmd/platform/posix_executor_extension.hpp"
+#include "ocvsmd/sdk/defines.hpp"
+
+#include <cetl/cetl.hpp>
+#include <cetl/pf17/cetlpf.hpp>
+#include <cetl/rtti.hpp>
+#include <libcyphal/executor.hpp>
+#include <libcyphal/types.hpp>
+
+#include <cstddef>
+#include <cstring>
+#include <future>
+#include <memory>
+#include <thread>
+#include <utility>
+
+namespace ocvsmd
+{
+namespace daemon
+{
+namespace engine
+{
+namespace threading
+{
+namespace
+{
+
+using PosixExecutorExtension = ocvsmd::platform::IPosixExecutorExtension;
+
+common::LoggerPtr logger()
+{
+    return common::getLogger("ipc");
+}
+
+}  // namespace
+
+ThreadedServerPipe::ThreadedServerPipe(libcyphal::IExecutor& executor, const common::io::SocketAddress& address)
+    : socket_address_{address}
+{
+    auto* const posix_executor_ext = cetl::rtti_cast<PosixExecutorExtension*>(&executor);
+    CETL_DEBUG_ASSERT(posix_executor_ext != nullptr, "");
+
+    engine_wakeup_callback_ = posix_executor_ext->registerAwaitableCallback(  //
+        [this](const auto&) {
+            //
+            handleInboundFrames();
+        },
+        PosixExecutorExtension::Trigger::Event{engine_wakeup_.fd()});
+}
+
+ThreadedServerPipe::~ThreadedServerPipe()
+{
+    is_stopping_ = true;
+    ipc_wakeup_.signal();
+    if (ipc_thread_.joinable())
+    {
+        ipc_thread_.join();
+    }
+}
+
+sdk::OptError ThreadedServerPipe::start(EventHandler event_handler)
+{
+    CETL_DEBUG_ASSERT(event_handler, "");
+    CETL_DEBUG_ASSERT(!ipc_thread_.joinable(), "");
+
+    if (!engine_wakeup_.isValid() || !ipc_wakeup_.isValid())
+    {
+        logger()->error("Failed to create IPC thread wake-up events.");
+        return sdk::Error{sdk::Error::Code::Other};
+    }
+
+    event_handler_ = std::move(event_handler);
+
+    std::promise<sdk::OptError> started;
+    auto                        started_future = started.get_future();
+    ipc_thread_ = std::thread{[this, promise = std::move(started)]() mutable { runIpcThread(promise); }};
+
+    // The inner socket server is started on the IPC thread, but its result is still reported synchronously.
+    //
+    return started_future.get();
+}
+
+sdk::OptError ThreadedServerPipe::send(const ClientId client_id, common::io::SocketBuffer& sock_buff)
+{
+    // The IPC thread might send the frame at any moment later, so fragments (which are just references)
+    // have to be flattened into an owned buffer right here.
+    //
+    Frame frame{Frame::Kind::Message, client_id, nullptr, sock_buff.size()};
+    frame.buffer = std::make_unique<cetl::byte[]>(frame.size);  // NOLINT(*-avoid-c-arrays)
+    std::size_t offset = 0;
+    for (const auto& fragment : sock_buff.listFragments())
+    {
+        std::memmove(frame.buffer.get() + offset, fragment.data(), fragment.size());
+        offset += fragment.size();
+    }
+
+    if (!to_ipc_.tryPush(std::move(frame)))
+    {
+        logger()->warn("IPC thread queue is full - dropping outbound frame (client={}).", client_id);
+        return sdk::Error{sdk::Error::Code::Busy};
+    }
+    ipc_wakeup_.signal();
+    return cetl::nullopt;
+}
+
+void ThreadedServerPipe::runIpcThread(std::promise<sdk::OptError>& started)
+{
+    ocvsmd::platform::SingleThreadedExecutor executor;
+
+    auto* const posix_executor_ext = cetl::rtti_cast<PosixExecutorExtension*>(&executor);
+    CETL_DEBUG_ASSERT(posix_executor_ext != nullptr, "");
+
+    const auto wakeup_callback = posix_executor_ext->registerAwaitableCallback(  //
+        [this](const auto&) {
+            //
+            handleOutboundFrames();
+        },
+        PosixExecutorExtension::Trigger::Event{ipc_wakeup_.fd()});
+
+    common::ipc::pipe::SocketServer socket_server{executor, socket_address_};
+    ServerPipe&                     server_pipe = socket_server;
+    ipc_server_                                 = &server_pipe;
+
+    const auto opt_error = server_pipe.start([this](const Event::Var& event) {
+        //
+        return forwardToEngine(event);
+    });
+    started.set_value(opt_error);
+    if (opt_error)
+    {
+        return;
+    }
+    logger()->debug("IPC thread is running.");
+
+    // Tickless loop (the same as the engine one) - woken up either by IPC sockets,
+    // or by the engine thread (on outbound frames and on stop).
+    //
+    while (!is_stopping_)
+    {
+        const auto spin_result = executor.spinOnce();
+
+        cetl::optional<libcyphal::Duration> timeout;
+        if (spin_result.next_exec_time.has_value())
+        {
+            timeout = spin_result.next_exec_time.value() - executor.now();
+        }
+        if (executor.pollAwaitableResourcesFor(timeout))
+        {
+            logger()->warn("Failed to poll IPC thread awaitable resources.");
+        }
+    }
+    logger()->debug("IPC thread is stopped.");
+}
+
+sdk::OptError ThreadedServerPipe::forwardToEngine(const Event::Var& event)
+{
+    Frame frame;
+    if (const auto* const connected = cetl::get_if<Event::Connected>(&event))
+    {
+        frame.kind      = Frame::Kind::Connected;
+        frame.client_id = connected->client_id;
+    }
+    else if (const auto* const message = cetl::get_if<Event::Message>(&event))
+    {
+        frame.kind      = Frame::Kind::Message;
+        frame.client_id = message->client_id;
+        frame.size      = message->payload.size();
+        frame.buffer    = std::make_unique<cetl::byte[]>(frame.size);  // NOLINT(*-avoid-c-arrays)
+        std::memmove(frame.buffer.get(), message->payload.data(), frame.size);
+    }
+    else if (const auto* const disconnected = cetl::get_if<Event::Disconnected>(&event))
+    {
+        frame.kind      = Frame::Kind::Disconnected;
+        frame.client_id = disconnected->client_id;
+    }
+
+    // Backpressure - if the engine is behind, the IPC thread (and so its sockets reading) waits for it.
+    //
+    while (!to_engine_.tryPush(std::move(frame)))
+    {
+        if (is_stopping_)
+        {
+            return sdk::Error{sdk::Error::Code::Shutdown};
+        }
+        engine_wakeup_.signal();
+        std::this_thread::yield();
+    }
+    engine_wakeup_.signal();
+    return cetl::nullopt;
+}
+
+void ThreadedServerPipe::handleInboundFrames()
+{
+    // Limit the batch by the queue capacity - so that a busy IPC thread can't starve other engine callbacks.
+    // The rest (if any) is handled on the next spin.
+    //
+    Frame frame;
+    for (std::size_t count = 0; count < to_engine_.capacity(); ++count)
+    {
+        if (!to_engine_.tryPop(frame))
+        {
+            return;
+        }
+
+        sdk::OptError opt_error;
+        switch (frame.kind)
+        {
+        case Frame::Kind::Connected:
+            opt_error = event_handler_(Event::Connected{frame.client_id});
+            break;
+        case Frame::Kind::Message: {
+            const common::io::Payload payload{frame.buffer.get(), frame.size};
+            opt_error = event_handler_(Event::Message{frame.client_id, payload});
+            break;
+        }
+        case Frame::Kind::Disconnected:
+            opt_error = event_handler_(Event::Disconnected{frame.client_id});
+            break;
+        default:
+            break;
+        }
+        if (opt_error)
+        {
+            logger()->warn("Failed to handle IPC client event (client={}, err={}).", frame.client_id, *opt_error);
+        }
+    }
+    engine_wakeup_.signal();
+}
+
+void ThreadedServerPipe::handleOutboundFrames()
+{
+    CETL_DEBUG_ASSERT(ipc_server_ != nullptr, "");
+
+    Frame frame;
+    while (to_ipc_.tryPop(frame))
+    {
+        common::io::SocketBuffer sock_buff{common::io::Payload{frame.buffer.get(), frame.size}};
+        if (const auto opt_error = ipc_server_->send(frame.client_id, sock_buff))
+        {
+            logger()->warn("Failed to send IPC frame (client={}, err={}).", frame.client_id, *opt_error);
+        }
+    }
+}
+
+}  // namespace threading
+}  // namespace engine
+}  // namespace daemon
+}  // namespace ocvsmd
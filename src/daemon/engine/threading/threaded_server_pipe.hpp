@@ -0,0 +1,112 @@
+//
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#ifndef OCVSMD_DAEMON_ENGINE_THREADING_THREADED_SERVER_PIPE_HPP_INCLUDED
+#define OCVSMD_DAEMON_ENGINE_THREADING_THREADED_SERVER_PIPE_HPP_INCLUDED
+
+#include "io/socket_address.hpp"
+#include "io/socket_buffer.hpp"
+#include "ipc/pipe/server_pipe.hpp"
+#include "ocvsmd/sdk/defines.hpp"
+#include "platform/wakeup_event.hpp"
+#include "spsc_queue.hpp"
+
+#include <cetl/cetl.hpp>
+#include <cetl/pf17/cetlpf.hpp>
+#include <libcyphal/executor.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <thread>
+
+namespace ocvsmd
+{
+namespace daemon
+{
+namespace engine
+{
+namespace threading
+{
+
+/// Defines server pipe which runs the IPC socket server on its own dedicated thread.
+///
+/// The engine thread keeps the transport, presentation layer, IPC router and services - only the socket I/O
+/// (accepting connections, reading and writing of the IPC frames) moves to the IPC thread. The threads exchange
+/// whole frames via two bounded SPSC queues, and wake each other with `platform::WakeupEvent`s
+/// (`eventfd` on Linux) registered in their executors - so both loops stay tickless.
+///
+/// From the point of view of the IPC router it's just another `ServerPipe` - all pipe events are delivered
+/// (and all `send` calls are expected) on the engine thread. Note that inbound frames are copied once
+/// (on the IPC thread), and outbound ones are flattened into a single buffer (on the engine thread).
+///
+/// The IPC thread runs its own (private) executor - so callbacks of IPC sockets are not seen by the profiler
+/// of the engine executor (see `ExecutorStatsService`).
+///
+class ThreadedServerPipe final : public common::ipc::pipe::ServerPipe
+{
+public:
+    /// Capacity (in frames) of each of the queues between the engine and the IPC threads.
+    ///
+    static constexpr std::size_t QueueCapacity = 1024;
+
+    ThreadedServerPipe(libcyphal::IExecutor& executor, const common::io::SocketAddress& address);
+
+    ThreadedServerPipe(const ThreadedServerPipe&)                = delete;
+    ThreadedServerPipe(ThreadedServerPipe&&) noexcept            = delete;
+    ThreadedServerPipe& operator=(const ThreadedServerPipe&)     = delete;
+    ThreadedServerPipe& operator=(ThreadedServerPipe&&) noexcept = delete;
+
+    ~ThreadedServerPipe() override;
+
+private:
+    struct Frame final
+    {
+        enum class Kind : std::uint8_t
+        {
+            Connected,
+            Message,
+            Disconnected,
+        };
+
+        Kind                          kind{Kind::Message};
+        ClientId                      client_id{0};
+        std::unique_ptr<cetl::byte[]> buffer;  // NOLINT(*-avoid-c-arrays)
+        std::size_t                   size{0};
+    };
+
+    void          runIpcThread(std::promise<sdk::OptError>& started);
+    sdk::OptError forwardToEngine(const Event::Var& event);
+    void          handleInboundFrames();
+    void          handleOutboundFrames();
+
+    // ServerPipe
+    //
+    CETL_NODISCARD sdk::OptError start(EventHandler event_handler) override;
+    CETL_NODISCARD sdk::OptError send(const ClientId client_id, common::io::SocketBuffer& sock_buff) override;
+
+    // MARK: Data members:
+
+    const common::io::SocketAddress     socket_address_;
+    EventHandler                        event_handler_;
+    std::atomic<bool>                   is_stopping_{false};
+    SpscQueue<Frame>                    to_engine_{QueueCapacity};
+    SpscQueue<Frame>                    to_ipc_{QueueCapacity};
+    platform::WakeupEvent               engine_wakeup_;
+    platform::WakeupEvent               ipc_wakeup_;
+    libcyphal::IExecutor::Callback::Any engine_wakeup_callback_;
+    ServerPipe*                         ipc_server_{nullptr};  // Accessed on the IPC thread only.
+    std::thread                         ipc_thread_;
+
+};  // ThreadedServerPipe
+
+}  // namespace threading
+}  // namespace engine
+}  // namespace daemon
+}  // namespace ocvsmd
+
+#endif  // OCVSMD_DAEMON_ENGINE_THREADING_THREADED_SERVER_PIPE_HPP_INCLUDED
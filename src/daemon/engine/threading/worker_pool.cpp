@@ -0,0 +1,175 @@
+//
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "worker_pool.hpp"
+
+#include "logging.hpp"
+#include "ocvsmd/platform/posix_executor_extension.hpp"
+
+#include <cetl/cetl.hpp>
+#include <cetl/rtti.hpp>
+#include <libcyphal/executor.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <pthread.h>
+#include <sched.h>
+#include <thread>
+#include <utility>
+
+namespace ocvsmd
+{
+namespace daemon
+{
+namespace engine
+{
+namespace threading
+{
+namespace
+{
+
+using PosixExecutorExtension = ocvsmd::platform::IPosixExecutorExtension;
+
+}  // namespace
+
+WorkerPool::Ptr WorkerPool::make(libcyphal::IExecutor& executor, const std::size_t threads_count)
+{
+    auto worker_pool = std::make_unique<WorkerPool>(executor, threads_count);
+    if ((threads_count > 0) && !worker_pool->completion_callback_.has_value())
+    {
+        return nullptr;
+    }
+    return worker_pool;
+}
+
+WorkerPool::WorkerPool(libcyphal::IExecutor& executor, const std::size_t threads_count)
+    : is_stopping_{false}
+{
+    if (threads_count == 0)
+    {
+        return;
+    }
+
+    auto* const posix_executor_ext = cetl::rtti_cast<PosixExecutorExtension*>(&executor);
+    if ((posix_executor_ext == nullptr) || !completion_event_.isValid())
+    {
+        return;
+    }
+    completion_callback_ = posix_executor_ext->registerAwaitableCallback(  //
+        [this](const auto&) {
+            //
+            handleCompletions();
+        },
+        PosixExecutorExtension::Trigger::Event{completion_event_.fd()});
+
+    threads_.reserve(threads_count);
+    for (std::size_t index = 0; index < threads_count; ++index)
+    {
+        threads_.emplace_back([this] { runWorker(); });
+    }
+    common::getLogger("engine")->debug("Worker pool is started (threads={}).", threads_count);
+}
+
+WorkerPool::~WorkerPool()
+{
+    {
+        const std::lock_guard<std::mutex> lock{mutex_};
+        is_stopping_ = true;
+    }
+    work_cv_.notify_all();
+    for (auto& thread : threads_)
+    {
+        thread.join();
+    }
+    completion_callback_.reset();
+}
+
+void WorkerPool::post(Work work, Completion completion)
+{
+    if (threads_.empty())
+    {
+        work();
+        if (completion)
+        {
+            completion();
+        }
+        return;
+    }
+
+    {
+        const std::lock_guard<std::mutex> lock{mutex_};
+        pending_jobs_.push_back(Job{std::move(work), std::move(completion)});
+    }
+    work_cv_.notify_one();
+}
+
+void WorkerPool::runWorker()
+{
+    // Workers should never compete with the engine thread - which might be a real-time one (inherited by workers).
+    //
+    const sched_param param{};
+    (void) ::pthread_setschedparam(::pthread_self(), SCHED_OTHER, &param);
+
+    while (true)
+    {
+        Job job;
+        {
+            std::unique_lock<std::mutex> lock{mutex_};
+            work_cv_.wait(lock, [this] { return is_stopping_ || !pending_jobs_.empty(); });
+            if (is_stopping_)
+            {
+                // Completions won't be delivered anymore (so their work is dropped),
+                // but "fire-and-forget" work still has to be done.
+                //
+                const auto it = std::find_if(pending_jobs_.begin(), pending_jobs_.end(), [](const Job& pending) {
+                    return !pending.completion;
+                });
+                if (it == pending_jobs_.end())
+                {
+                    return;
+                }
+                job = std::move(*it);
+                pending_jobs_.erase(it);
+            }
+            else
+            {
+                job = std::move(pending_jobs_.front());
+                pending_jobs_.pop_front();
+            }
+        }
+
+        job.work();
+
+        if (job.completion)
+        {
+            {
+                const std::lock_guard<std::mutex> lock{mutex_};
+                completions_.push_back(std::move(job.completion));
+            }
+            completion_event_.signal();
+        }
+    }
+}
+
+void WorkerPool::handleCompletions()
+{
+    std::deque<Completion> completions;
+    {
+        const std::lock_guard<std::mutex> lock{mutex_};
+        completions.swap(completions_);
+    }
+    for (auto& completion : completions)
+    {
+        completion();
+    }
+}
+
+}  // namespace threading
+}  // namespace engine
+}  // namespace daemon
+}  // namespace ocvsmd
@@ -0,0 +1,117 @@
+//
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#ifndef OCVSMD_DAEMON_ENGINE_THREADING_WORKER_POOL_HPP_INCLUDED
+#define OCVSMD_DAEMON_ENGINE_THREADING_WORKER_POOL_HPP_INCLUDED
+
+#include "platform/wakeup_event.hpp"
+
+#include <cetl/cetl.hpp>
+#include <cetl/pf17/cetlpf.hpp>
+#include <libcyphal/executor.hpp>
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ocvsmd
+{
+namespace daemon
+{
+namespace engine
+{
+namespace threading
+{
+
+/// Defines a small pool of worker threads for CPU-heavy or blocking work (f.e. file system access) -
+/// so that such work doesn't stall the engine loop (and so all Cyphal and IPC traffic).
+///
+/// Work is posted from the executor thread, executed by one of the workers, and then its completion
+/// is called back on the executor thread - woken up by a `platform::WakeupEvent` registered in the executor
+/// (as an `Event` trigger). Workers run with the default (time-sharing) scheduling policy,
+/// so they never compete with a real-time engine thread (see `[runtime]` config).
+///
+/// Without worker threads (zero count), work and its completion are executed right away by the `post` call.
+///
+/// Not thread-safe - `post` is expected on the executor thread only. On destruction, the pool waits for
+/// the work in progress (if any), and for pending work without completion (f.e. a config save, which must not
+/// be lost on shutdown); the rest of pending work and all completions are dropped.
+///
+class WorkerPool final
+{
+public:
+    using Ptr        = std::unique_ptr<WorkerPool>;
+    using Work       = std::function<void()>;
+    using Completion = std::function<void()>;
+
+    /// Makes a new pool - `nullptr` if the executor has no awaitable resources, or the wake-up event has failed.
+    ///
+    CETL_NODISCARD static Ptr make(libcyphal::IExecutor& executor, const std::size_t threads_count);
+
+    WorkerPool(libcyphal::IExecutor& executor, const std::size_t threads_count);
+
+    WorkerPool(const WorkerPool&)                = delete;
+    WorkerPool(WorkerPool&&) noexcept            = delete;
+    WorkerPool& operator=(const WorkerPool&)     = delete;
+    WorkerPool& operator=(WorkerPool&&) noexcept = delete;
+
+    ~WorkerPool();
+
+    std::size_t threadsCount() const noexcept
+    {
+        return threads_.size();
+    }
+
+    /// Posts work to a worker thread - its completion (if any) will be called on the executor thread.
+    ///
+    void post(Work work, Completion completion);
+
+    /// Submits a task (which returns a result) to a worker thread - the result is passed to
+    /// the `on_result` handler on the executor thread.
+    ///
+    template <typename Task, typename OnResult>
+    void submit(Task&& task, OnResult&& on_result)
+    {
+        using Result = std::decay_t<decltype(task())>;
+
+        auto result = std::make_shared<cetl::optional<Result>>();
+        post([result, task = std::forward<Task>(task)]() mutable { result->emplace(task()); },
+             [result, on_result = std::forward<OnResult>(on_result)]() mutable { on_result(std::move(**result)); });
+    }
+
+private:
+    struct Job
+    {
+        Work       work;
+        Completion completion;
+    };
+
+    void runWorker();
+    void handleCompletions();
+
+    platform::WakeupEvent               completion_event_;
+    libcyphal::IExecutor::Callback::Any completion_callback_;
+    std::mutex                          mutex_;
+    std::condition_variable             work_cv_;
+    std::deque<Job>                     pending_jobs_;
+    std::deque<Completion>              completions_;
+    bool                                is_stopping_;
+    std::vector<std::thread>            threads_;
+
+};  // WorkerPool
+
+}  // namespace threading
+}  // namespace engine
+}  // namespace daemon
+}  // namespace ocvsmd
+
+#endif  // OCVSMD_DAEMON_ENGINE_THREADING_WORKER_POOL_HPP_INCLUDED
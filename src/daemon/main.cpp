@@ -6,10 +6,12 @@
 #include "engine/config.hpp"
 #include "engine/engine.hpp"
 #include "setup_logging.hpp"
+#include "setup_runtime.hpp"
 
 #include <spdlog/spdlog.h>
 
 #include <array>
+#include <atomic>
 #include <cassert>
 #include <cstdio>
 #include <cstdlib>
@@ -33,6 +35,11 @@ const auto* const s_init_complete = "init_complete";
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 volatile sig_atomic_t g_running = 1;
 
+// The running engine (if any) - to wake up its (tickless) loop on termination signals,
+// and to request its executor statistics dump (on `SIGUSR1`).
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+std::atomic<const ocvsmd::daemon::engine::Engine*> g_engine{nullptr};
+
 extern "C" void signalHandler(const int sig)
 {
     switch (sig)
@@ -40,6 +47,16 @@ extern "C" void signalHandler(const int sig)
     case SIGTERM:
     case SIGINT:
         g_running = 0;
+        if (const auto* const engine = g_engine.load())
+        {
+            engine->wakeUp();
+        }
+        break;
+    case SIGUSR1:
+        if (const auto* const engine = g_engine.load())
+        {
+            engine->requestStatsDump();
+        }
         break;
     default:
         break;
@@ -53,6 +70,7 @@ void setupSignalHandlers()
     sigbreak.sa_handler = &signalHandler;
     ::sigaction(SIGINT, &sigbreak, nullptr);
     ::sigaction(SIGTERM, &sigbreak, nullptr);
+    ::sigaction(SIGUSR1, &sigbreak, nullptr);
 }
 
 void exitWithFailure(const int fd, const char* const msg)
@@ -358,9 +376,13 @@ int main(const int argc, const char** const argv)
     }
 
     const auto config = loadConfig(pipe_write_fd, should_daemonize, argc, argv);
+
+    // Real-time settings go first - before the logging creates its threads, so they inherit the settings as well.
+    const auto runtime_warnings = setupRuntime(config);
     setupLogging(pipe_write_fd, should_daemonize, argc, argv, config);
 
     spdlog::info("OCVSMD started (ver='{}.{}').", VERSION_MAJOR, VERSION_MINOR);
+    logRuntime(runtime_warnings);
     int result = EXIT_SUCCESS;
     {
         try
@@ -373,6 +395,7 @@ int main(const int argc, const char** const argv)
                 // Report the failure to the parent process (if daemonized; otherwise goes to stderr).
                 writeString(pipe_write_fd, "Failed to init engine: ");
                 writeString(pipe_write_fd, failure_str->c_str());
+                spdlog::shutdown();
                 ::exit(EXIT_FAILURE);
             }
             if (should_daemonize)
@@ -380,12 +403,15 @@ int main(const int argc, const char** const argv)
                 step_14_notify_init_complete(pipe_write_fd);
             }
 
+            g_engine = &engine;
             engine.runWhile([] { return g_running == 1; });
+            g_engine = nullptr;
 
             config->save();
 
         } catch (const std::exception& ex)
         {
+            g_engine = nullptr;
             spdlog::critical("Unhandled exception: {}", ex.what());
             result = EXIT_FAILURE;
         }
@@ -397,5 +423,8 @@ int main(const int argc, const char** const argv)
     }
     spdlog::info("OCVSMD daemon terminated.");
 
+    // Flushes all queued (asynchronous) log messages, and stops the logging threads.
+    spdlog::shutdown();
+
     return result;
 }
@@ -10,6 +10,8 @@
 
 #include <cetl/cetl.hpp>
 
+#include <spdlog/async.h>
+#include <spdlog/async_logger.h>
 #include <spdlog/cfg/argv.h>
 #include <spdlog/cfg/helpers.h>  // NOLINT
 #include <spdlog/common.h>
@@ -18,6 +20,8 @@
 #include <spdlog/sinks/syslog_sink.h>
 #include <spdlog/spdlog.h>
 
+#include <chrono>
+#include <cstddef>
 #include <cstdlib>
 #include <cstring>
 #include <exception>
@@ -86,6 +90,19 @@ inline void loadArgvFlushLevels(const int argc, const char** const argv)
     }
 }
 
+/// Makes a new logger - asynchronous one if there is the logging thread pool.
+///
+inline std::shared_ptr<spdlog::logger> makeLogger(const std::string&                            name,
+                                                  const std::initializer_list<spdlog::sink_ptr> sinks)
+{
+    if (const auto thread_pool = spdlog::thread_pool())
+    {
+        using spdlog::async_overflow_policy;
+        return std::make_shared<spdlog::async_logger>(name, sinks, thread_pool, async_overflow_policy::overrun_oldest);
+    }
+    return std::make_shared<spdlog::logger>(name, sinks);
+}
+
 }  // namespace detail
 
 inline bool writeString(const int fd, const char* const str)
@@ -100,6 +117,11 @@ inline bool writeString(const int fd, const char* const str)
 /// The syslog sink is used for the default logger only (with Info default level),
 /// while the file sink is used for all loggers (with Debug default level).
 ///
+/// Unless disabled (by zero `[logging] queue_size`), loggers are asynchronous - messages are formatted
+/// by the calling thread, and then written to the sinks (and periodically flushed) by a background thread.
+/// The queue is bounded, and on overflow the oldest messages are dropped, so that a burst of logging
+/// never blocks the engine thread on disk or syslog I/O.
+///
 inline void setupLogging(const int                                  err_fd,
                          const bool                                 is_daemonized,
                          const int                                  argc,
@@ -108,8 +130,10 @@ inline void setupLogging(const int                                  err_fd,
 {
     CETL_DEBUG_ASSERT(config, "");
 
-    using spdlog::sinks::syslog_sink_st;
-    using spdlog::sinks::rotating_file_sink_st;
+    // Sinks are shared by all loggers, including those used on the IPC thread (see `[engine] threading`).
+    //
+    using spdlog::sinks::syslog_sink_mt;
+    using spdlog::sinks::rotating_file_sink_mt;
 
     try
     {
@@ -128,25 +152,32 @@ inline void setupLogging(const int                                  err_fd,
         // Drop all existing loggers, including the default one, so that we can reconfigure them.
         spdlog::drop_all();
 
-        const auto file_sink = std::make_shared<rotating_file_sink_st>(log_file_path, log_file_max_size, log_files_max);
+        // Single background thread serves all asynchronous loggers - so the order of messages is preserved.
+        //
+        if (const auto queue_size = config->getLoggingQueueSize())
+        {
+            spdlog::init_thread_pool(queue_size, 1);
+        }
+
+        const auto file_sink = std::make_shared<rotating_file_sink_mt>(log_file_path, log_file_max_size, log_files_max);
         file_sink->set_pattern("[%Y-%m-%d %H:%M:%S.%e] [%P] [%n] [%l] %v");
 
         const int  syslog_facility = is_daemonized ? LOG_DAEMON : LOG_USER;
-        const auto syslog_sink     = std::make_shared<syslog_sink_st>(log_prefix, LOG_PID, syslog_facility, true);
+        const auto syslog_sink     = std::make_shared<syslog_sink_mt>(log_prefix, LOG_PID, syslog_facility, true);
         syslog_sink->set_pattern("[%l] '%n' | %v");
 
         // The default logger goes to all sinks.
         //
         const std::initializer_list<spdlog::sink_ptr> sinks{syslog_sink, file_sink};
-        const auto                                    default_logger = std::make_shared<spdlog::logger>("", sinks);
+        const auto                                    default_logger = detail::makeLogger("", sinks);
         register_logger(default_logger);
         set_default_logger(default_logger);
 
         // Register specific subsystem loggers - they go to the file sink only.
         //
-        register_logger(std::make_shared<spdlog::logger>("io", file_sink));
-        register_logger(std::make_shared<spdlog::logger>("ipc", file_sink));
-        register_logger(std::make_shared<spdlog::logger>("engine", file_sink));
+        register_logger(detail::makeLogger("io", {file_sink}));
+        register_logger(detail::makeLogger("ipc", {file_sink}));
+        register_logger(detail::makeLogger("engine", {file_sink}));
 
         // Setup log levels from the configuration file.
         // Also accept `SPDLOG_LEVEL` & `SPDLOG_FLUSH_LEVEL` arguments if any (like `SPDLOG_LEVEL=debug,ipc=trace`).
@@ -162,6 +193,11 @@ inline void setupLogging(const int                                  err_fd,
         spdlog::cfg::load_argv_levels(argc, argv);
         detail::loadArgvFlushLevels(argc, argv);
 
+        // Unflushed messages (below the flush level) still reach the disk in a timely manner.
+        //
+        constexpr std::chrono::seconds flush_interval{1};
+        spdlog::flush_every(flush_interval);
+
         // Insert "--…--" just to have clearer separation in the log file between two different process runs.
         //
         if (spdlog::default_logger()->should_log(spdlog::level::info))
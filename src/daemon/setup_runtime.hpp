@@ -0,0 +1,182 @@
+//
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#ifndef OCVSMD_DAEMON_SETUP_RUNTIME_HPP_INCLUDED
+#define OCVSMD_DAEMON_SETUP_RUNTIME_HPP_INCLUDED
+
+#include "config.hpp"
+#include "platform/runtime_status.hpp"
+
+#include <cetl/cetl.hpp>
+
+#include <spdlog/fmt/ranges.h>
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstddef>
+#include <cstring>
+#include <sched.h>
+#include <string>
+#include <sys/mman.h>
+#include <vector>
+
+#ifdef __GLIBC__
+#    include <malloc.h>
+#endif
+
+/// Collects (not yet logged) warnings of the runtime setup - it's done before the logging is set up.
+///
+using RuntimeWarnings = std::vector<std::string>;
+
+namespace detail
+{
+
+inline void setupScheduling(const ocvsmd::daemon::engine::Config::Runtime& runtime, RuntimeWarnings& warnings)
+{
+    using SchedPolicy = ocvsmd::daemon::engine::Config::Runtime::SchedPolicy;
+
+    if (runtime.sched_policy == SchedPolicy::Other)
+    {
+        return;
+    }
+
+    const int policy       = (runtime.sched_policy == SchedPolicy::Fifo) ? SCHED_FIFO : SCHED_RR;
+    const int min_priority = ::sched_get_priority_min(policy);
+    const int max_priority = ::sched_get_priority_max(policy);
+
+    sched_param param{};
+    param.sched_priority = std::min(std::max(runtime.sched_priority, min_priority), max_priority);
+    if (param.sched_priority != runtime.sched_priority)
+    {
+        warnings.push_back(fmt::format("Scheduling priority {} is out of range [{}, {}] - using {}.",
+                                       runtime.sched_priority,
+                                       min_priority,
+                                       max_priority,
+                                       param.sched_priority));
+    }
+
+    if (::sched_setscheduler(0, policy, &param) != 0)
+    {
+        const int err = errno;
+        warnings.push_back(fmt::format("Failed to set real-time scheduling (policy={}, priority={}): {}.",
+                                       policy,
+                                       param.sched_priority,
+                                       std::strerror(err)));
+    }
+}
+
+inline void setupCpuAffinity(const ocvsmd::daemon::engine::Config::Runtime& runtime, RuntimeWarnings& warnings)
+{
+    if (runtime.cpu_affinity.empty())
+    {
+        return;
+    }
+
+#ifdef PLATFORM_OS_TYPE_BSD
+    warnings.emplace_back("CPU affinity is not supported on this platform - ignored.");
+#else
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    for (const auto cpu : runtime.cpu_affinity)
+    {
+        if (cpu >= CPU_SETSIZE)
+        {
+            warnings.push_back(fmt::format("CPU {} is out of range - ignored.", cpu));
+            continue;
+        }
+        CPU_SET(cpu, &cpu_set);
+    }
+    if (::sched_setaffinity(0, sizeof(cpu_set), &cpu_set) != 0)
+    {
+        const int err = errno;
+        warnings.push_back(fmt::format("Failed to set CPU affinity (cpus=[{}]): {}.",
+                                       fmt::join(runtime.cpu_affinity, ","),
+                                       std::strerror(err)));
+    }
+#endif
+}
+
+/// Touches a part of (not yet used) stack - so that its pages are faulted in (and locked, if requested)
+/// before the hot path.
+///
+inline void prefaultStack()
+{
+    constexpr std::size_t StackSize = 256UL * 1024UL;
+    constexpr std::size_t PageSize  = 4096;
+
+    std::array<volatile unsigned char, StackSize> stack;  // NOLINT(*-member-init)
+    for (std::size_t offset = 0; offset < stack.size(); offset += PageSize)
+    {
+        stack[offset] = 0;  // NOLINT(*-constant-array-index)
+    }
+}
+
+inline void setupMemory(const ocvsmd::daemon::engine::Config::Runtime& runtime, RuntimeWarnings& warnings)
+{
+    if (runtime.prefault)
+    {
+#ifdef __GLIBC__
+        // Keep freed heap memory in the process (instead of trimming it, or unmapping big blocks) -
+        // so that once faulted in, it stays so.
+        //
+        (void) ::mallopt(M_TRIM_THRESHOLD, -1);
+        (void) ::mallopt(M_MMAP_MAX, 0);
+#endif
+        prefaultStack();
+    }
+
+    if (runtime.lock_memory && (::mlockall(MCL_CURRENT | MCL_FUTURE) != 0))
+    {
+        const int err = errno;
+        warnings.push_back(fmt::format("Failed to lock memory (mlockall): {}.", std::strerror(err)));
+    }
+}
+
+}  // namespace detail
+
+/// Sets up real-time settings of the daemon process (see `[runtime]` section of the configuration).
+///
+/// Scheduling and affinity are applied to the calling thread only, and are inherited by threads it creates later.
+/// So it should be called (on the main thread) after daemonizing, but before any other thread is created -
+/// before the logging setup (its async and flush threads) and the engine init. Then also memory pools
+/// of the engine are allocated already locked (see also `PoolMemoryResource::prefault`).
+///
+/// @return Warnings about failed settings - failures are not fatal; see `logRuntime`.
+///
+inline RuntimeWarnings setupRuntime(const ocvsmd::daemon::engine::Config::Ptr& config)
+{
+    CETL_DEBUG_ASSERT(config, "");
+
+    RuntimeWarnings warnings;
+    const auto      runtime = config->getRuntime();
+    detail::setupScheduling(runtime, warnings);
+    detail::setupCpuAffinity(runtime, warnings);
+    detail::setupMemory(runtime, warnings);
+    return warnings;
+}
+
+/// Logs warnings of the runtime setup, and the achieved settings (which are also available
+/// via the 'ocvsmd.svc.diag.runtime' IPC service).
+///
+/// Should be called once the logging is set up.
+///
+inline void logRuntime(const RuntimeWarnings& warnings)
+{
+    for (const auto& warning : warnings)
+    {
+        spdlog::warn("{}", warning);
+    }
+
+    const auto status = ocvsmd::daemon::engine::platform::RuntimeStatus::query();
+    spdlog::info("Runtime settings (sched_policy={}, sched_priority={}, cpus=[{}], locked_bytes={}).",
+                 status.sched_policy,
+                 status.sched_priority,
+                 fmt::join(status.cpu_affinity, ","),
+                 status.locked_bytes);
+}
+
+#endif  // OCVSMD_DAEMON_SETUP_RUNTIME_HPP_INCLUDED
@@ -0,0 +1,63 @@
+//
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "logging.hpp"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstddef>
+
+namespace
+{
+
+using ocvsmd::common::LogRateLimiter;
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+class TestLogging : public testing::Test
+{};
+
+// MARK: - Tests:
+
+TEST_F(TestLogging, rate_limiter_burst_and_suppressed)
+{
+    using std::chrono::milliseconds;
+
+    LogRateLimiter rate_limiter{milliseconds{100}, 2};
+
+    const auto  start      = LogRateLimiter::Clock::time_point{} + milliseconds{1000};
+    std::size_t suppressed = 42;
+
+    // The first `burst` messages are passed, and the rest of the interval is suppressed.
+    //
+    EXPECT_TRUE(rate_limiter.tryPass(start, suppressed));
+    EXPECT_THAT(suppressed, 0U);
+    EXPECT_TRUE(rate_limiter.tryPass(start + milliseconds{10}, suppressed));
+    EXPECT_THAT(suppressed, 0U);
+    suppressed = 42;
+    EXPECT_FALSE(rate_limiter.tryPass(start + milliseconds{20}, suppressed));
+    EXPECT_FALSE(rate_limiter.tryPass(start + milliseconds{30}, suppressed));
+    EXPECT_FALSE(rate_limiter.tryPass(start + milliseconds{99}, suppressed));
+    EXPECT_THAT(suppressed, 42U);
+
+    // The next interval reports the number of suppressed messages (once).
+    //
+    EXPECT_TRUE(rate_limiter.tryPass(start + milliseconds{100}, suppressed));
+    EXPECT_THAT(suppressed, 3U);
+    EXPECT_TRUE(rate_limiter.tryPass(start + milliseconds{110}, suppressed));
+    EXPECT_THAT(suppressed, 0U);
+    EXPECT_FALSE(rate_limiter.tryPass(start + milliseconds{120}, suppressed));
+
+    // A quiet period starts a new interval as well.
+    //
+    EXPECT_TRUE(rate_limiter.tryPass(start + milliseconds{500}, suppressed));
+    EXPECT_THAT(suppressed, 1U);
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+}  // namespace
@@ -0,0 +1,286 @@
+//
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "bridge/transport_bridge.hpp"
+
+#include "config.hpp"
+#include "cyphal/transfer_id_map.hpp"
+#include "daemon/engine/cyphal/msg_sessions_mock.hpp"
+#include "daemon/engine/cyphal/scattered_buffer_storage_mock.hpp"
+#include "daemon/engine/cyphal/transport_gtest_helpers.hpp"
+#include "daemon/engine/cyphal/transport_mock.hpp"
+#include "tracking_memory_resource.hpp"
+#include "verify_utilz.hpp"
+#include "virtual_time_scheduler.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+#include <libcyphal/presentation/presentation.hpp>
+#include <libcyphal/transport/types.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <utility>
+
+namespace
+{
+
+using ocvsmd::daemon::engine::Config;
+using ocvsmd::daemon::engine::bridge::TransportBridge;
+using ocvsmd::daemon::engine::cyphal::TransferIdMap;
+
+using ocvsmd::verify_utilz::b;
+
+using testing::_;
+using testing::Invoke;
+using testing::Return;
+using testing::IsEmpty;
+using testing::NotNull;
+using testing::NiceMock;
+using testing::StrictMock;
+
+// https://github.com/llvm/llvm-project/issues/53444
+// NOLINTBEGIN(misc-unused-using-decls, misc-include-cleaner)
+using std::literals::chrono_literals::operator""s;
+using std::literals::chrono_literals::operator""ms;
+// NOLINTEND(misc-unused-using-decls, misc-include-cleaner)
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+class TestTransportBridge : public testing::Test
+{
+protected:
+    using CyNodeId                     = libcyphal::transport::NodeId;
+    using CyPortId                     = libcyphal::transport::PortId;
+    using CyPriority                   = libcyphal::transport::Priority;
+    using CyTransferId                 = libcyphal::transport::TransferId;
+    using CyPresentation               = libcyphal::presentation::Presentation;
+    using CyMsgRxTransfer              = libcyphal::transport::MessageRxTransfer;
+    using CyProtocolParams             = libcyphal::transport::ProtocolParams;
+    using CyTransportMock              = StrictMock<libcyphal::transport::TransportMock>;
+    using CyMsgRxSessionMock           = StrictMock<libcyphal::transport::MessageRxSessionMock>;
+    using CyUniquePtrMsgRxSpec         = CyMsgRxSessionMock::RefWrapper::Spec;
+    using CyMsgTxSessionMock           = StrictMock<libcyphal::transport::MessageTxSessionMock>;
+    using CyUniquePtrMsgTxSpec         = CyMsgTxSessionMock::RefWrapper::Spec;
+    using CyScatteredBuffer            = libcyphal::transport::ScatteredBuffer;
+    using CyScatteredBufferStorageMock = libcyphal::transport::ScatteredBufferStorageMock;
+
+    struct CySessCntx
+    {
+        CyMsgRxSessionMock                              msg_rx_mock;
+        CyMsgRxSessionMock::OnReceiveCallback::Function msg_rx_cb_fn;
+        CyMsgTxSessionMock                              msg_tx_mock;
+    };
+
+    void SetUp() override
+    {
+        cetl::pmr::set_default_resource(&mr_);
+
+        for (auto* const transport_mock : {&udp_transport_mock_, &can_transport_mock_})
+        {
+            EXPECT_CALL(*transport_mock, getProtocolParams())
+                .WillRepeatedly(Return(CyProtocolParams{std::numeric_limits<CyTransferId>::max(), 0, 0}));
+        }
+        EXPECT_CALL(udp_transport_mock_, getLocalNodeId()).WillRepeatedly(Return(cetl::optional<CyNodeId>{13}));
+        EXPECT_CALL(can_transport_mock_, getLocalNodeId()).WillRepeatedly(Return(cetl::optional<CyNodeId>{42}));
+    }
+
+    void TearDown() override
+    {
+        EXPECT_THAT(mr_.allocations, IsEmpty());
+        EXPECT_THAT(mr_.total_allocated_bytes, mr_.total_deallocated_bytes);
+    }
+
+    libcyphal::TimePoint now() const
+    {
+        return scheduler_.now();
+    }
+
+    /// Expects a route (of the given number of incarnations) from the source to the destination transport.
+    ///
+    void expectCyRoute(CySessCntx&       cy_sess_cntx,
+                       CyTransportMock&  src_transport_mock,
+                       CyTransportMock&  dst_transport_mock,
+                       const CyPortId    subject_id,
+                       const std::size_t extent,
+                       const int         times = 1)
+    {
+        using libcyphal::transport::MessageRxParamsEq;
+        using libcyphal::transport::MessageTxParamsEq;
+
+        const libcyphal::transport::MessageTxParams tx_params{subject_id};
+        EXPECT_CALL(cy_sess_cntx.msg_tx_mock, getParams())  //
+            .WillRepeatedly(Return(tx_params));
+        EXPECT_CALL(dst_transport_mock, makeMessageTxSession(MessageTxParamsEq(tx_params)))  //
+            .Times(times)
+            .WillRepeatedly(Invoke([&](const auto&) {  //
+                return libcyphal::detail::makeUniquePtr<CyUniquePtrMsgTxSpec>(mr_, cy_sess_cntx.msg_tx_mock);
+            }));
+        EXPECT_CALL(cy_sess_cntx.msg_tx_mock, deinit()).Times(times);
+
+        const libcyphal::transport::MessageRxParams rx_params{extent, subject_id};
+        EXPECT_CALL(cy_sess_cntx.msg_rx_mock, getParams())  //
+            .WillRepeatedly(Return(rx_params));
+        EXPECT_CALL(cy_sess_cntx.msg_rx_mock, setOnReceiveCallback(_))  //
+            .WillRepeatedly(Invoke([&](auto&& cb_fn) {                  //
+                cy_sess_cntx.msg_rx_cb_fn = std::forward<decltype(cb_fn)>(cb_fn);
+            }));
+        EXPECT_CALL(src_transport_mock, makeMessageRxSession(MessageRxParamsEq(rx_params)))  //
+            .Times(times)
+            .WillRepeatedly(Invoke([&](const auto&) {  //
+                return libcyphal::detail::makeUniquePtr<CyUniquePtrMsgRxSpec>(mr_, cy_sess_cntx.msg_rx_mock);
+            }));
+        EXPECT_CALL(cy_sess_cntx.msg_rx_mock, deinit()).Times(times);
+    }
+
+    // NOLINTBEGIN
+    ocvsmd::TrackingMemoryResource mr_;
+    ocvsmd::VirtualTimeScheduler   scheduler_{};
+    CyTransportMock                udp_transport_mock_;
+    CyTransportMock                can_transport_mock_;
+    // NOLINTEND
+
+};  // TestTransportBridge
+
+// MARK: - Tests:
+
+TEST_F(TestTransportBridge, forward_udp_to_can)
+{
+    using libcyphal::transport::TransferTxMetadataEq;
+
+    constexpr CyPortId    SubjectId = 7509;
+    constexpr std::size_t Extent    = 64;
+
+    CyPresentation udp_presentation{mr_, scheduler_, udp_transport_mock_};
+    CyPresentation can_presentation{mr_, scheduler_, can_transport_mock_};
+
+    CySessCntx cy_sess_cntx;
+    expectCyRoute(cy_sess_cntx, udp_transport_mock_, can_transport_mock_, SubjectId, Extent);
+
+    const Config::Bridge config{42, {SubjectId}, {}, Extent};
+    auto                 bridge = TransportBridge::make(  //
+        scheduler_,
+        {udp_presentation, udp_transport_mock_},
+        {can_presentation, can_transport_mock_},
+        config);
+    ASSERT_THAT(bridge, NotNull());
+
+    std::array<cetl::byte, 3> test_raw_bytes{b(0x11), b(0x22), b(0x33)};
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        // Node 17 publishes on UDP - should be forwarded to CAN (with the same priority and payload).
+        //
+        EXPECT_CALL(cy_sess_cntx.msg_tx_mock, send(TransferTxMetadataEq({{0, CyPriority::Fast}, now() + 100ms}), _))
+            .WillOnce(Invoke([&](const auto&, const auto fragments) {
+                //
+                EXPECT_THAT(fragments.size(), 1);
+                EXPECT_THAT(fragments[0].size(), test_raw_bytes.size());
+                EXPECT_THAT(fragments[0].data(), test_raw_bytes.data());
+                return cetl::nullopt;
+            }));
+
+        NiceMock<CyScatteredBufferStorageMock> storage_mock;
+        EXPECT_CALL(storage_mock, size()).WillRepeatedly(Return(test_raw_bytes.size()));
+        EXPECT_CALL(storage_mock, forEachFragment(_)).WillOnce(Invoke([&](auto& visitor) {
+            //
+            visitor.onNext(test_raw_bytes);
+        }));
+        CyMsgRxTransfer transfer{{{{147, CyPriority::Fast}, now()}, 17},
+                                 CyScatteredBuffer{CyScatteredBufferStorageMock::Wrapper{&storage_mock}}};
+        cy_sess_cntx.msg_rx_cb_fn({transfer});
+    });
+    scheduler_.scheduleAt(2s, [&](const auto&) {
+        //
+        // Own (UDP node 13) message is not forwarded.
+        //
+        CyMsgRxTransfer transfer{{{{148, CyPriority::Nominal}, now()}, 13}, {}};
+        cy_sess_cntx.msg_rx_cb_fn({transfer});
+    });
+    scheduler_.scheduleAt(3s, [&](const auto&) {
+        //
+        const auto& udp_to_can = bridge->getCounters(TransportBridge::Direction::UdpToCan);
+        EXPECT_THAT(udp_to_can.forwarded, 1);
+        EXPECT_THAT(udp_to_can.forwarded_bytes, test_raw_bytes.size());
+        EXPECT_THAT(udp_to_can.skipped_own, 1);
+        EXPECT_THAT(udp_to_can.failed, 0);
+
+        const auto& can_to_udp = bridge->getCounters(TransportBridge::Direction::CanToUdp);
+        EXPECT_THAT(can_to_udp.forwarded, 0);
+
+        bridge.reset();
+    });
+    scheduler_.spinFor(10s);
+}
+
+TEST_F(TestTransportBridge, transfer_ids_survive_bridge_recreation)
+{
+    using libcyphal::transport::TransferTxMetadataEq;
+
+    constexpr CyPortId    SubjectId = 147;
+    constexpr std::size_t Extent    = 16;
+
+    const auto transfer_id_map = TransferIdMap::make(cetl::nullopt);
+    ASSERT_THAT(transfer_id_map, NotNull());
+
+    CyPresentation udp_presentation{mr_, scheduler_, udp_transport_mock_};
+    CyPresentation can_presentation{mr_, scheduler_, can_transport_mock_};
+    udp_presentation.setTransferIdMap(transfer_id_map.get());
+
+    CySessCntx cy_sess_cntx;
+    expectCyRoute(cy_sess_cntx, can_transport_mock_, udp_transport_mock_, SubjectId, Extent, 2);
+
+    const Config::Bridge config{42, {}, {SubjectId}, Extent};
+    TransportBridge::Ptr bridge;
+    const auto           makeBridge = [&] {
+        //
+        bridge = TransportBridge::make(  //
+            scheduler_,
+            {udp_presentation, udp_transport_mock_},
+            {can_presentation, can_transport_mock_},
+            config);
+        ASSERT_THAT(bridge, NotNull());
+    };
+    const auto forwardMessage = [&](const CyTransferId expected_transfer_id) {
+        //
+        EXPECT_CALL(cy_sess_cntx.msg_tx_mock,
+                    send(TransferTxMetadataEq({{expected_transfer_id, CyPriority::Nominal}, now() + 100ms}), _))
+            .WillOnce(Return(cetl::nullopt));
+        CyMsgRxTransfer transfer{{{{7, CyPriority::Nominal}, now()}, 17}, {}};
+        cy_sess_cntx.msg_rx_cb_fn({transfer});
+    };
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        makeBridge();
+        forwardMessage(0);
+        forwardMessage(1);
+    });
+    scheduler_.scheduleAt(2s, [&](const auto&) {
+        //
+        // Destruction of the bridged publisher (f.e. on engine restart) stores its next transfer ID.
+        //
+        bridge.reset();
+    });
+    scheduler_.scheduleAt(3s, [&](const auto&) {
+        //
+        EXPECT_THAT(transfer_id_map->size(), 1);
+
+        makeBridge();
+        forwardMessage(2);
+    });
+    scheduler_.scheduleAt(4s, [&](const auto&) {
+        //
+        bridge.reset();
+    });
+    scheduler_.spinFor(10s);
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+}  // namespace
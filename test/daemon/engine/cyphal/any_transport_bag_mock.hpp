@@ -0,0 +1,50 @@
+//
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#ifndef OCVSMD_DAEMON_ENGINE_CYPHAL_ANY_TRANSPORT_BAG_MOCK_HPP_INCLUDED
+#define OCVSMD_DAEMON_ENGINE_CYPHAL_ANY_TRANSPORT_BAG_MOCK_HPP_INCLUDED
+
+#include "cyphal/any_transport_bag.hpp"
+#include "platform/media_health.hpp"
+#include "platform/socket_stats.hpp"
+#include "platform/tx_queue_memory_resource.hpp"
+
+#include <gmock/gmock.h>
+
+#include <vector>
+
+namespace ocvsmd
+{
+namespace daemon
+{
+namespace engine
+{
+namespace cyphal
+{
+
+class AnyTransportBagMock : public AnyTransportBag
+{
+public:
+    AnyTransportBagMock()           = default;
+    ~AnyTransportBagMock() override = default;
+
+    AnyTransportBagMock(const AnyTransportBagMock&)                = delete;
+    AnyTransportBagMock(AnyTransportBagMock&&) noexcept            = delete;
+    AnyTransportBagMock& operator=(const AnyTransportBagMock&)     = delete;
+    AnyTransportBagMock& operator=(AnyTransportBagMock&&) noexcept = delete;
+
+    MOCK_METHOD(Transport&, getTransport, (), (const, override));
+    MOCK_METHOD(std::vector<platform::MediaHealthReport>, getMediaHealthReports, (), (const, override));
+    MOCK_METHOD(std::vector<platform::MediaSocketsReport>, getMediaSocketsReports, (), (const, override));
+    MOCK_METHOD(platform::TxQueueMemoryResource::Stats, getTxQueueStats, (), (const, override));
+
+};  // AnyTransportBagMock
+
+}  // namespace cyphal
+}  // namespace engine
+}  // namespace daemon
+}  // namespace ocvsmd
+
+#endif  // OCVSMD_DAEMON_ENGINE_CYPHAL_ANY_TRANSPORT_BAG_MOCK_HPP_INCLUDED
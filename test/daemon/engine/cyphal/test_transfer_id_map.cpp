@@ -0,0 +1,135 @@
+//
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "cyphal/transfer_id_map.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+#include <libcyphal/transport/transfer_id_map.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+namespace
+{
+
+using namespace ocvsmd::daemon::engine::cyphal;  // NOLINT This our main concern here in the unit tests.
+
+using SessionSpec = libcyphal::transport::ITransferIdMap::SessionSpec;
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+class TestTransferIdMap : public testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        file_path_ = testing::TempDir() + "ocvsmd_test_transfer_ids.bin";
+        (void) std::remove(file_path_.c_str());
+    }
+
+    void TearDown() override
+    {
+        (void) std::remove(file_path_.c_str());
+    }
+
+    // MARK: Data members:
+
+    // NOLINTBEGIN
+    std::string file_path_;
+    // NOLINTEND
+};
+
+// MARK: - Tests:
+
+TEST_F(TestTransferIdMap, in_memory)
+{
+    const auto map = TransferIdMap::make(cetl::nullopt);
+    ASSERT_TRUE(map);
+    EXPECT_FALSE(map->isPersistent());
+    EXPECT_THAT(map->size(), 0);
+
+    EXPECT_THAT(map->getIdFor(SessionSpec{7509, 42}), 0);
+
+    map->setIdFor(SessionSpec{7509, 42}, 13);
+    map->setIdFor(SessionSpec{7509, 43}, 14);
+    map->setIdFor(SessionSpec{7509, 42}, 15);
+    EXPECT_THAT(map->size(), 2);
+    EXPECT_THAT(map->getIdFor(SessionSpec{7509, 42}), 15);
+    EXPECT_THAT(map->getIdFor(SessionSpec{7509, 43}), 14);
+    EXPECT_THAT(map->getIdFor(SessionSpec{42, 7509}), 0);
+}
+
+TEST_F(TestTransferIdMap, full_capacity)
+{
+    const auto map = TransferIdMap::make(cetl::nullopt);
+
+    for (std::uint16_t port_id = 0; port_id < TransferIdMap::capacity(); ++port_id)
+    {
+        map->setIdFor(SessionSpec{port_id, 1}, port_id + 100U);
+    }
+    EXPECT_THAT(map->size(), TransferIdMap::capacity());
+
+    // No room for a new session, but existing ones are still updated.
+    map->setIdFor(SessionSpec{0, 2}, 1);
+    map->setIdFor(SessionSpec{0, 1}, 1);
+    EXPECT_THAT(map->size(), TransferIdMap::capacity());
+    EXPECT_THAT(map->getIdFor(SessionSpec{0, 2}), 0);
+    EXPECT_THAT(map->getIdFor(SessionSpec{0, 1}), 1);
+    for (std::uint16_t port_id = 1; port_id < TransferIdMap::capacity(); ++port_id)
+    {
+        EXPECT_THAT(map->getIdFor(SessionSpec{port_id, 1}), port_id + 100U);
+    }
+}
+
+TEST_F(TestTransferIdMap, survives_restart)
+{
+    {
+        const auto map = TransferIdMap::make(file_path_);
+        ASSERT_TRUE(map->isPersistent());
+        EXPECT_THAT(map->size(), 0);
+
+        map->setIdFor(SessionSpec{7509, 42}, 123456789);
+        map->setIdFor(SessionSpec{430, 42}, 31);
+    }
+    {
+        const auto map = TransferIdMap::make(file_path_);
+        ASSERT_TRUE(map->isPersistent());
+        EXPECT_THAT(map->size(), 2);
+        EXPECT_THAT(map->getIdFor(SessionSpec{7509, 42}), 123456789);
+        EXPECT_THAT(map->getIdFor(SessionSpec{430, 42}), 31);
+    }
+}
+
+TEST_F(TestTransferIdMap, incompatible_file_is_reset)
+{
+    {
+        std::ofstream file{file_path_, std::ios_base::out | std::ios_base::binary};
+        file << "definitely not a transfer IDs table";
+    }
+
+    const auto map = TransferIdMap::make(file_path_);
+    ASSERT_TRUE(map->isPersistent());
+    EXPECT_THAT(map->size(), 0);
+    EXPECT_THAT(map->getIdFor(SessionSpec{7509, 42}), 0);
+}
+
+TEST_F(TestTransferIdMap, unmappable_file_falls_back_to_memory)
+{
+    const auto map = TransferIdMap::make(std::string{"/nonexistent-dir/transfer_ids.bin"});
+    ASSERT_TRUE(map);
+    EXPECT_FALSE(map->isPersistent());
+
+    map->setIdFor(SessionSpec{7509, 42}, 7);
+    EXPECT_THAT(map->getIdFor(SessionSpec{7509, 42}), 7);
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+}  // namespace
@@ -0,0 +1,153 @@
+//
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "cyphal/udp_transport_bag.hpp"
+
+#include "config.hpp"
+#include "ocvsmd/platform/linux/epoll_single_threaded_executor.hpp"
+#include "tracking_memory_resource.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+#include <libcyphal/transport/msg_sessions.hpp>
+#include <libcyphal/transport/types.hpp>
+#include <libcyphal/types.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <fstream>
+#include <string>
+
+namespace
+{
+
+using ocvsmd::daemon::engine::Config;
+using ocvsmd::daemon::engine::cyphal::UdpTransportBag;
+using ocvsmd::platform::Linux::EpollSingleThreadedExecutor;
+
+using testing::IsEmpty;
+using testing::NotNull;
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+class TestUdpTransportBag : public testing::Test
+{
+protected:
+    using CyPriority           = libcyphal::transport::Priority;
+    using CyTransferId         = libcyphal::transport::TransferId;
+    using CyMsgRxSession       = libcyphal::transport::IMessageRxSession;
+    using CyMsgTxSession       = libcyphal::transport::IMessageTxSession;
+    using CyPayloadFragment    = libcyphal::transport::PayloadFragment;
+    using CyTransferTxMetadata = libcyphal::transport::TransferTxMetadata;
+
+    void TearDown() override
+    {
+        EXPECT_THAT(mr_.allocations, IsEmpty());
+        EXPECT_THAT(mr_.total_allocated_bytes, mr_.total_deallocated_bytes);
+    }
+
+    static Config::Ptr makeConfig()
+    {
+        const auto config_path = testing::TempDir() + "test_udp_transport_bag.toml";
+        {
+            std::ofstream file{config_path};
+            file << "[cyphal.transport]\n";
+            file << "interfaces = ['udp://127.0.0.1']\n";
+        }
+        return Config::make(config_path);
+    }
+
+    static void pollAndSpin(EpollSingleThreadedExecutor& executor)
+    {
+        (void) executor.pollAwaitableResourcesFor(cetl::make_optional(std::chrono::milliseconds{1}));
+        (void) executor.spinOnce();
+    }
+
+    // NOLINTBEGIN
+    ocvsmd::TrackingMemoryResource mr_;
+    // NOLINTEND
+
+};  // TestUdpTransportBag
+
+// MARK: - Tests:
+
+TEST_F(TestUdpTransportBag, steady_state_traffic_is_pooled)
+{
+    constexpr libcyphal::transport::PortId SubjectId = 1000;
+    constexpr std::size_t                  Extent    = 64;
+
+    const auto config = makeConfig();
+    ASSERT_THAT(config, NotNull());
+
+    EpollSingleThreadedExecutor executor;
+    {
+        auto tx_bag = UdpTransportBag::make(mr_, executor, config);
+        auto rx_bag = UdpTransportBag::make(mr_, executor, config);
+        if (!tx_bag || !rx_bag)
+        {
+            GTEST_SKIP() << "UDP transport is not available.";
+        }
+        EXPECT_FALSE(tx_bag->getTransport().setLocalNodeId(13).has_value());
+        EXPECT_FALSE(rx_bag->getTransport().setLocalNodeId(14).has_value());
+
+        auto  maybe_rx_session = rx_bag->getTransport().makeMessageRxSession({Extent, SubjectId});
+        auto  maybe_tx_session = tx_bag->getTransport().makeMessageTxSession({SubjectId});
+        auto* rx_session       = cetl::get_if<libcyphal::UniquePtr<CyMsgRxSession>>(&maybe_rx_session);
+        auto* tx_session       = cetl::get_if<libcyphal::UniquePtr<CyMsgTxSession>>(&maybe_tx_session);
+        ASSERT_THAT(rx_session, NotNull());
+        ASSERT_THAT(tx_session, NotNull());
+
+        std::size_t received = 0;
+        (*rx_session)->setOnReceiveCallback([&received](const auto&) {
+            //
+            ++received;
+        });
+
+        std::array<cetl::byte, Extent>         payload{};
+        const std::array<CyPayloadFragment, 1> fragments{{{payload.data(), payload.size()}}};
+
+        CyTransferId transfer_id         = 0;
+        const auto   publish_and_receive = [&](const std::size_t count) {
+            for (std::size_t index = 0; index < count; ++index)
+            {
+                const auto                 expected = received + 1;
+                const CyTransferTxMetadata metadata{{transfer_id++, CyPriority::Nominal},
+                                                    executor.now() + std::chrono::seconds{1}};
+                EXPECT_FALSE((*tx_session)->send(metadata, fragments).has_value());
+                for (int attempt = 0; (attempt < 100) && (received < expected); ++attempt)
+                {
+                    pollAndSpin(executor);
+                }
+            }
+        };
+
+        // Warm-up - libudpard allocates its per-source RX session state (from the general resource) on the first
+        // transfer, and the pools may grow to their working set.
+        //
+        publish_and_receive(10);
+        if (received == 0)
+        {
+            GTEST_SKIP() << "Multicast loopback is not available.";
+        }
+        const auto warm_allocated_bytes = mr_.total_allocated_bytes;
+        const auto warm_received        = received;
+
+        // Steady state - TX frames, RX datagram buffers and RX fragments are all served by the pools.
+        //
+        publish_and_receive(100);
+        EXPECT_THAT(received, warm_received + 100);
+        EXPECT_THAT(mr_.total_allocated_bytes, warm_allocated_bytes);
+
+        rx_session->reset();
+        tx_session->reset();
+    }
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+}  // namespace
@@ -0,0 +1,88 @@
+//
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "federation/echo_filter.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+#include <libcyphal/transport/types.hpp>
+#include <libcyphal/types.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <array>
+#include <chrono>
+
+namespace
+{
+
+using namespace ocvsmd::daemon::engine::federation;  // NOLINT This our main concern here in the unit tests.
+
+using libcyphal::TimePoint;
+
+// https://github.com/llvm/llvm-project/issues/53444
+// NOLINTBEGIN(misc-unused-using-decls, misc-include-cleaner)
+using std::literals::chrono_literals::operator""s;
+using std::literals::chrono_literals::operator""ms;
+// NOLINTEND(misc-unused-using-decls, misc-include-cleaner)
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+// MARK: - Tests:
+
+TEST(TestEchoFilter, digest)
+{
+    using Fragment = libcyphal::transport::PayloadFragment;
+
+    const std::array<cetl::byte, 3> abc{cetl::byte{'a'}, cetl::byte{'b'}, cetl::byte{'c'}};
+    const std::array<cetl::byte, 3> abd{cetl::byte{'a'}, cetl::byte{'b'}, cetl::byte{'d'}};
+
+    // Reference FNV-1a 64-bit value of "abc".
+    EXPECT_EQ(PayloadDigest::of(Fragment{abc.data(), abc.size()}), 0xE71FA2190541574BULL);
+    EXPECT_NE(PayloadDigest::of(Fragment{abc.data(), abc.size()}),
+              PayloadDigest::of(Fragment{abd.data(), abd.size()}));
+}
+
+TEST(TestEchoFilter, consume_once)
+{
+    EchoFilter filter{4, 1s};
+
+    filter.remember(13, TimePoint{} + 1s);
+    EXPECT_FALSE(filter.consume(14, TimePoint{} + 1s));
+    EXPECT_TRUE(filter.consume(13, TimePoint{} + 1s + 10ms));
+    EXPECT_FALSE(filter.consume(13, TimePoint{} + 1s + 20ms));  // already consumed
+}
+
+TEST(TestEchoFilter, timeout)
+{
+    EchoFilter filter{4, 1s};
+
+    filter.remember(13, TimePoint{} + 1s);
+    EXPECT_FALSE(filter.consume(13, TimePoint{} + 2s));
+}
+
+TEST(TestEchoFilter, ring_overflow)
+{
+    EchoFilter filter{2, 1s};
+
+    filter.remember(1, TimePoint{} + 1s);
+    filter.remember(2, TimePoint{} + 1s);
+    filter.remember(3, TimePoint{} + 1s);  // overwrites the oldest one
+    EXPECT_FALSE(filter.consume(1, TimePoint{} + 1s));
+    EXPECT_TRUE(filter.consume(2, TimePoint{} + 1s));
+    EXPECT_TRUE(filter.consume(3, TimePoint{} + 1s));
+}
+
+TEST(TestEchoFilter, zero_capacity)
+{
+    EchoFilter filter{0, 1s};
+
+    filter.remember(1, TimePoint{} + 1s);
+    EXPECT_FALSE(filter.consume(1, TimePoint{} + 1s));
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+}  // namespace
@@ -0,0 +1,508 @@
+//
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "federation/federation_link.hpp"
+
+#include "config.hpp"
+#include "daemon/engine/cyphal/msg_sessions_mock.hpp"
+#include "daemon/engine/cyphal/transport_gtest_helpers.hpp"
+#include "daemon/engine/cyphal/transport_mock.hpp"
+#include "tracking_memory_resource.hpp"
+#include "virtual_time_scheduler.hpp"
+
+#include <ocvsmd/sdk/daemon.hpp>
+#include <ocvsmd/sdk/defines.hpp>
+#include <ocvsmd/sdk/execution.hpp>
+#include <ocvsmd/sdk/node_pub_sub.hpp>
+
+#include <cetl/pf17/cetlpf.hpp>
+#include <libcyphal/executor.hpp>
+#include <libcyphal/presentation/presentation.hpp>
+#include <libcyphal/transport/types.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+using ocvsmd::daemon::engine::Config;
+using ocvsmd::daemon::engine::federation::FederationLink;
+
+using testing::_;
+using testing::Invoke;
+using testing::Return;
+using testing::IsEmpty;
+using testing::ElementsAre;
+using testing::NotNull;
+using testing::StrictMock;
+
+// https://github.com/llvm/llvm-project/issues/53444
+// NOLINTBEGIN(misc-unused-using-decls, misc-include-cleaner)
+using std::literals::chrono_literals::operator""s;
+using std::literals::chrono_literals::operator""ms;
+// NOLINTEND(misc-unused-using-decls, misc-include-cleaner)
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+/// Emulates subscriber of the peer daemon.
+///
+/// Strictly follows the SDK contract - a receive operation completes only once,
+/// so the next message is delivered only if a new receive operation has been initiated.
+///
+class PeerSubscriberStub final : public ocvsmd::sdk::Subscriber
+{
+public:
+    using Result = RawReceive::Result;
+
+    std::size_t receives() const noexcept
+    {
+        return receives_;
+    }
+
+    /// @return `false` if there is no active receive operation (so the message is lost).
+    ///
+    bool deliver(Result&& result)
+    {
+        auto receiver = std::move(receiver_);
+        receiver_     = nullptr;
+        if (!receiver)
+        {
+            return false;
+        }
+        receiver(std::move(result));
+        return true;
+    }
+
+    // Subscriber
+
+    ocvsmd::sdk::SenderOf<Result>::Ptr rawReceive() override
+    {
+        ++receives_;
+        return std::make_unique<ReceiveSender>(*this);
+    }
+
+private:
+    class ReceiveSender final : public ocvsmd::sdk::SenderOf<Result>
+    {
+    public:
+        explicit ReceiveSender(PeerSubscriberStub& subscriber)
+            : subscriber_{subscriber}
+        {
+        }
+
+    private:
+        void submitImpl(std::function<void(Result&&)>&& receiver) override
+        {
+            subscriber_.receiver_ = std::move(receiver);
+        }
+
+        PeerSubscriberStub& subscriber_;
+
+    };  // ReceiveSender
+
+    std::size_t                   receives_{0};
+    std::function<void(Result&&)> receiver_;
+
+};  // PeerSubscriberStub
+
+/// Emulates publisher of the peer daemon - in use only for the "local → peer" direction.
+///
+/// By default, publish operations complete right away (successfully).
+///
+class PeerPublisherStub final : public ocvsmd::sdk::Publisher
+{
+public:
+    using CyphalPriority = ocvsmd::sdk::CyphalPriority;
+    using OptError       = ocvsmd::sdk::OptError;
+
+    std::size_t publishes() const noexcept
+    {
+        return publishes_;
+    }
+
+    cetl::optional<CyphalPriority> priority() const noexcept
+    {
+        return priority_;
+    }
+
+    /// Makes the next attempt to set the given priority fail.
+    ///
+    void failPriorityOnce(const CyphalPriority priority)
+    {
+        failing_priority_ = priority;
+    }
+
+    /// Makes following publish operations pending - until `complete` is called.
+    ///
+    void deferCompletion()
+    {
+        is_deferred_ = true;
+    }
+
+    /// @return `false` if there is no pending publish operation.
+    ///
+    bool complete(const OptError opt_error)
+    {
+        auto receiver = std::move(receiver_);
+        receiver_     = nullptr;
+        if (!receiver)
+        {
+            return false;
+        }
+        receiver(OptError{opt_error});
+        return true;
+    }
+
+    // Publisher
+
+    ocvsmd::sdk::SenderOf<OptError>::Ptr rawPublish(ocvsmd::sdk::OwnedMutablePayload&&,
+                                                    const std::chrono::microseconds) override
+    {
+        ++publishes_;
+        if (!is_deferred_)
+        {
+            return ocvsmd::sdk::just<OptError>(OptError{});
+        }
+        return std::make_unique<PublishSender>(*this);
+    }
+
+    OptError setPriority(const CyphalPriority priority) override
+    {
+        if (failing_priority_ == priority)
+        {
+            failing_priority_.reset();
+            return OptError{ocvsmd::sdk::Error{ocvsmd::sdk::Error::Code::Disconnected}};
+        }
+        priority_ = priority;
+        return OptError{};
+    }
+
+private:
+    class PublishSender final : public ocvsmd::sdk::SenderOf<OptError>
+    {
+    public:
+        explicit PublishSender(PeerPublisherStub& publisher)
+            : publisher_{publisher}
+        {
+        }
+
+    private:
+        void submitImpl(std::function<void(OptError&&)>&& receiver) override
+        {
+            publisher_.receiver_ = std::move(receiver);
+        }
+
+        PeerPublisherStub& publisher_;
+
+    };  // PublishSender
+
+    std::size_t                     publishes_{0};
+    bool                            is_deferred_{false};
+    cetl::optional<CyphalPriority>  priority_;
+    cetl::optional<CyphalPriority>  failing_priority_;
+    std::function<void(OptError&&)> receiver_;
+
+};  // PeerPublisherStub
+
+/// Emulates the peer daemon - its publishers and subscribers are made right away.
+///
+class PeerDaemonStub final : public ocvsmd::sdk::Daemon
+{
+public:
+    explicit PeerDaemonStub(std::shared_ptr<PeerSubscriberStub> subscriber,
+                            std::shared_ptr<PeerPublisherStub>  publisher = std::make_shared<PeerPublisherStub>())
+        : subscriber_{std::move(subscriber)}
+        , publisher_{std::move(publisher)}
+    {
+    }
+
+    // Daemon
+
+    ocvsmd::sdk::FileServer::Ptr getFileServer() const override
+    {
+        return nullptr;
+    }
+
+    ocvsmd::sdk::NodeCommandClient::Ptr getNodeCommandClient() const override
+    {
+        return nullptr;
+    }
+
+    ocvsmd::sdk::NodeRegistryClient::Ptr getNodeRegistryClient() const override
+    {
+        return nullptr;
+    }
+
+    ocvsmd::sdk::SenderOf<MakePublisher::Result>::Ptr makePublisher(const ocvsmd::sdk::CyphalPortId) override
+    {
+        return ocvsmd::sdk::just<MakePublisher::Result>(publisher_);
+    }
+
+    ocvsmd::sdk::SenderOf<MakeSubscriber::Result>::Ptr makeSubscriber(const ocvsmd::sdk::CyphalPortId,
+                                                                      const std::size_t) override
+    {
+        return ocvsmd::sdk::just<MakeSubscriber::Result>(subscriber_);
+    }
+
+private:
+    std::shared_ptr<PeerSubscriberStub> subscriber_;
+    std::shared_ptr<PeerPublisherStub>  publisher_;
+
+};  // PeerDaemonStub
+
+class TestFederationLink : public testing::Test
+{
+protected:
+    using CyPortId             = libcyphal::transport::PortId;
+    using CyPriority           = libcyphal::transport::Priority;
+    using CyPresentation       = libcyphal::presentation::Presentation;
+    using CyMsgRxTransfer      = libcyphal::transport::MessageRxTransfer;
+    using CyProtocolParams     = libcyphal::transport::ProtocolParams;
+    using CyMsgRxSessionMock   = StrictMock<libcyphal::transport::MessageRxSessionMock>;
+    using CyUniquePtrMsgRxSpec = CyMsgRxSessionMock::RefWrapper::Spec;
+    using CyMsgTxSessionMock   = StrictMock<libcyphal::transport::MessageTxSessionMock>;
+    using CyUniquePtrMsgTxSpec = CyMsgTxSessionMock::RefWrapper::Spec;
+
+    struct CySessCntx
+    {
+        CyMsgRxSessionMock                              msg_rx_mock;
+        CyMsgRxSessionMock::OnReceiveCallback::Function msg_rx_cb_fn;
+        CyMsgTxSessionMock                              msg_tx_mock;
+    };
+
+    void SetUp() override
+    {
+        cetl::pmr::set_default_resource(&mr_);
+
+        EXPECT_CALL(cy_transport_mock_, getProtocolParams())
+            .WillRepeatedly(
+                Return(CyProtocolParams{std::numeric_limits<libcyphal::transport::TransferId>::max(), 0, 0}));
+    }
+
+    void TearDown() override
+    {
+        EXPECT_THAT(mr_.allocations, IsEmpty());
+        EXPECT_THAT(mr_.total_allocated_bytes, mr_.total_deallocated_bytes);
+    }
+
+    void expectCyMsgSessions(CySessCntx& cy_sess_cntx, const CyPortId subject_id, const std::size_t extent)
+    {
+        using libcyphal::transport::MessageRxParamsEq;
+        using libcyphal::transport::MessageTxParamsEq;
+
+        const libcyphal::transport::MessageTxParams tx_params{subject_id};
+        EXPECT_CALL(cy_sess_cntx.msg_tx_mock, getParams())  //
+            .WillRepeatedly(Return(tx_params));
+        EXPECT_CALL(cy_transport_mock_, makeMessageTxSession(MessageTxParamsEq(tx_params)))  //
+            .WillOnce(Invoke([&](const auto&) {                                              //
+                return libcyphal::detail::makeUniquePtr<CyUniquePtrMsgTxSpec>(mr_, cy_sess_cntx.msg_tx_mock);
+            }));
+        EXPECT_CALL(cy_sess_cntx.msg_tx_mock, deinit()).Times(1);
+
+        const libcyphal::transport::MessageRxParams rx_params{extent, subject_id};
+        EXPECT_CALL(cy_sess_cntx.msg_rx_mock, getParams())  //
+            .WillRepeatedly(Return(rx_params));
+        EXPECT_CALL(cy_sess_cntx.msg_rx_mock, setOnReceiveCallback(_))  //
+            .WillRepeatedly(Invoke([&](auto&& cb_fn) {                  //
+                cy_sess_cntx.msg_rx_cb_fn = std::forward<decltype(cb_fn)>(cb_fn);
+            }));
+        EXPECT_CALL(cy_transport_mock_, makeMessageRxSession(MessageRxParamsEq(rx_params)))  //
+            .WillOnce(Invoke([&](const auto&) {                                              //
+                return libcyphal::detail::makeUniquePtr<CyUniquePtrMsgRxSpec>(mr_, cy_sess_cntx.msg_rx_mock);
+            }));
+        EXPECT_CALL(cy_sess_cntx.msg_rx_mock, deinit()).Times(1);
+    }
+
+    static PeerSubscriberStub::Result makePeerMessage(const std::size_t size, const std::uint8_t fill)
+    {
+        // NOLINTNEXTLINE(*-avoid-c-arrays)
+        ocvsmd::sdk::OwnedMutablePayload payload{size, std::make_unique<cetl::byte[]>(size)};
+        for (std::size_t index = 0; index < size; ++index)
+        {
+            payload.data[index] = static_cast<cetl::byte>(fill);
+        }
+        return PeerSubscriberStub::RawReceive::Success{std::move(payload),
+                                                       ocvsmd::sdk::CyphalPriority::Nominal,
+                                                       cetl::optional<ocvsmd::sdk::CyphalNodeId>{42}};
+    }
+
+    /// Emulates reception of a (empty) message from the local bus.
+    ///
+    void receiveLocal(CySessCntx& cy_sess_cntx, const CyPriority priority)
+    {
+        CyMsgRxTransfer transfer{{{{local_transfer_id_++, priority}, scheduler_.now()}, 17}, {}};
+        cy_sess_cntx.msg_rx_cb_fn({transfer});
+    }
+
+    /// Makes a new link which connects to the given peer daemon stub, and records times of all its (re)connects.
+    ///
+    FederationLink::Ptr makeLink(CyPresentation&                     cy_presentation,
+                                 const Config::Federation&           config,
+                                 std::shared_ptr<PeerSubscriberStub> peer_subscriber,
+                                 std::shared_ptr<PeerPublisherStub>  peer_publisher,
+                                 std::vector<libcyphal::Duration>&   connects)
+    {
+        return FederationLink::make(  //
+            mr_,
+            scheduler_,
+            cy_presentation,
+            config,
+            [this, peer_subscriber, peer_publisher, &connects](auto&, auto&, const auto&) -> ocvsmd::sdk::Daemon::Ptr {
+                //
+                connects.push_back(scheduler_.now().time_since_epoch());
+                return std::make_shared<PeerDaemonStub>(peer_subscriber, peer_publisher);
+            });
+    }
+
+    // NOLINTBEGIN
+    libcyphal::transport::TransferId                local_transfer_id_{0};
+    ocvsmd::TrackingMemoryResource                  mr_;
+    ocvsmd::VirtualTimeScheduler                    scheduler_{};
+    StrictMock<libcyphal::transport::TransportMock> cy_transport_mock_;
+    // NOLINTEND
+
+};  // TestFederationLink
+
+// MARK: - Tests:
+
+TEST_F(TestFederationLink, peer_messages_are_published_locally)
+{
+    constexpr CyPortId    SubjectId = 123;
+    constexpr std::size_t Extent    = 64;
+
+    CyPresentation cy_presentation{mr_, scheduler_, cy_transport_mock_};
+    CySessCntx     cy_sess_cntx;
+    expectCyMsgSessions(cy_sess_cntx, SubjectId, Extent);
+
+    const auto peer_subscriber = std::make_shared<PeerSubscriberStub>();
+
+    const Config::Federation config{"unix-abstract:peer", {SubjectId}, Extent, 4};
+    auto                     link = FederationLink::make(  //
+        mr_,
+        scheduler_,
+        cy_presentation,
+        config,
+        [&peer_subscriber](auto&, auto&, const std::string& connection) -> ocvsmd::sdk::Daemon::Ptr {
+            //
+            EXPECT_THAT(connection, "unix-abstract:peer");
+            return std::make_shared<PeerDaemonStub>(peer_subscriber);
+        });
+    ASSERT_THAT(link, NotNull());
+
+    // Every peer message (not just the first one) should reach the local bus.
+    //
+    constexpr std::size_t Messages = 3;
+    EXPECT_CALL(cy_sess_cntx.msg_tx_mock, send(_, _)).Times(Messages).WillRepeatedly(Return(cetl::nullopt));
+    for (std::size_t index = 0; index < Messages; ++index)
+    {
+        scheduler_.scheduleAt(1s + index * 100ms, [&, index](const auto&) {
+            //
+            EXPECT_TRUE(peer_subscriber->deliver(makePeerMessage(8, static_cast<std::uint8_t>(index))));
+        });
+    }
+    scheduler_.spinFor(2s);
+
+    EXPECT_THAT(peer_subscriber->receives(), Messages + 1);
+
+    testing::Mock::VerifyAndClearExpectations(&cy_sess_cntx.msg_tx_mock);
+    link.reset();
+}
+
+TEST_F(TestFederationLink, local_message_survives_failed_priority)
+{
+    constexpr CyPortId    SubjectId = 123;
+    constexpr std::size_t Extent    = 64;
+
+    CyPresentation cy_presentation{mr_, scheduler_, cy_transport_mock_};
+    CySessCntx     cy_sess_cntx;
+    expectCyMsgSessions(cy_sess_cntx, SubjectId, Extent);
+
+    const auto peer_subscriber = std::make_shared<PeerSubscriberStub>();
+    const auto peer_publisher  = std::make_shared<PeerPublisherStub>();
+    peer_publisher->failPriorityOnce(PeerPublisherStub::CyphalPriority::Fast);
+
+    std::vector<libcyphal::Duration> connects;
+    const Config::Federation         config{"unix-abstract:peer", {SubjectId}, Extent, 4};
+    auto link = makeLink(cy_presentation, config, peer_subscriber, peer_publisher, connects);
+    ASSERT_THAT(link, NotNull());
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        // The peer publisher fails to switch priority - so the link is reconnected,
+        // but the message itself stays queued (and not lost) until then.
+        //
+        receiveLocal(cy_sess_cntx, CyPriority::Fast);
+        EXPECT_THAT(peer_publisher->publishes(), 0);
+    });
+    scheduler_.scheduleAt(3s, [&](const auto&) {
+        //
+        EXPECT_THAT(connects, ElementsAre(0s, 2s));
+        EXPECT_THAT(peer_publisher->publishes(), 1);
+        EXPECT_THAT(peer_publisher->priority(), PeerPublisherStub::CyphalPriority::Fast);
+    });
+    scheduler_.spinFor(4s);
+
+    link.reset();
+}
+
+TEST_F(TestFederationLink, reconnect_backoff_is_kept)
+{
+    constexpr CyPortId    SubjectId = 123;
+    constexpr std::size_t Extent    = 64;
+
+    CyPresentation cy_presentation{mr_, scheduler_, cy_transport_mock_};
+    CySessCntx     cy_sess_cntx;
+    expectCyMsgSessions(cy_sess_cntx, SubjectId, Extent);
+
+    const auto peer_subscriber = std::make_shared<PeerSubscriberStub>();
+    const auto peer_publisher  = std::make_shared<PeerPublisherStub>();
+    peer_publisher->deferCompletion();
+
+    std::vector<libcyphal::Duration> connects;
+    const Config::Federation         config{"unix-abstract:peer", {SubjectId}, Extent, 4};
+    auto link = makeLink(cy_presentation, config, peer_subscriber, peer_publisher, connects);
+    ASSERT_THAT(link, NotNull());
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        receiveLocal(cy_sess_cntx, CyPriority::Nominal);
+        EXPECT_THAT(peer_publisher->publishes(), 1);
+    });
+    scheduler_.scheduleAt(1s + 100ms, [&](const auto&) {
+        //
+        // The peer subscriber fails - so reconnect is requested in 1s.
+        //
+        using ocvsmd::sdk::Error;
+        EXPECT_TRUE(peer_subscriber->deliver(PeerSubscriberStub::RawReceive::Failure{Error::Code::Disconnected}));
+    });
+    scheduler_.scheduleAt(1s + 200ms, [&](const auto&) {
+        //
+        // Late completion of the in-flight publish should not speed up the pending reconnect.
+        //
+        EXPECT_TRUE(peer_publisher->complete(cetl::nullopt));
+    });
+    scheduler_.scheduleAt(3s, [&](const auto&) {
+        //
+        EXPECT_THAT(connects, ElementsAre(0s, 2s + 100ms));
+    });
+    scheduler_.spinFor(4s);
+
+    link.reset();
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+}  // namespace
@@ -0,0 +1,250 @@
+//
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "pipeline/pipeline.hpp"
+
+#include "config.hpp"
+#include "daemon/engine/cyphal/msg_sessions_mock.hpp"
+#include "daemon/engine/cyphal/scattered_buffer_storage_mock.hpp"
+#include "daemon/engine/cyphal/transport_gtest_helpers.hpp"
+#include "daemon/engine/cyphal/transport_mock.hpp"
+#include "tracking_memory_resource.hpp"
+#include "verify_utilz.hpp"
+#include "virtual_time_scheduler.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+#include <libcyphal/presentation/presentation.hpp>
+#include <libcyphal/transport/types.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <utility>
+
+namespace
+{
+
+using ocvsmd::daemon::engine::Config;
+using ocvsmd::daemon::engine::pipeline::Pipeline;
+
+using ocvsmd::verify_utilz::b;
+
+using testing::_;
+using testing::Invoke;
+using testing::IsNull;
+using testing::Return;
+using testing::IsEmpty;
+using testing::NotNull;
+using testing::NiceMock;
+using testing::StrictMock;
+
+// https://github.com/llvm/llvm-project/issues/53444
+// NOLINTBEGIN(misc-unused-using-decls, misc-include-cleaner)
+using std::literals::chrono_literals::operator""s;
+using std::literals::chrono_literals::operator""ms;
+// NOLINTEND(misc-unused-using-decls, misc-include-cleaner)
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+class TestPipeline : public testing::Test
+{
+protected:
+    using CyNodeId                     = libcyphal::transport::NodeId;
+    using CyPortId                     = libcyphal::transport::PortId;
+    using CyPriority                   = libcyphal::transport::Priority;
+    using CyTransferId                 = libcyphal::transport::TransferId;
+    using CyPresentation               = libcyphal::presentation::Presentation;
+    using CyMsgRxTransfer              = libcyphal::transport::MessageRxTransfer;
+    using CyProtocolParams             = libcyphal::transport::ProtocolParams;
+    using CyTransportMock              = StrictMock<libcyphal::transport::TransportMock>;
+    using CyMsgRxSessionMock           = StrictMock<libcyphal::transport::MessageRxSessionMock>;
+    using CyUniquePtrMsgRxSpec         = CyMsgRxSessionMock::RefWrapper::Spec;
+    using CyMsgTxSessionMock           = StrictMock<libcyphal::transport::MessageTxSessionMock>;
+    using CyUniquePtrMsgTxSpec         = CyMsgTxSessionMock::RefWrapper::Spec;
+    using CyScatteredBuffer            = libcyphal::transport::ScatteredBuffer;
+    using CyScatteredBufferStorageMock = libcyphal::transport::ScatteredBufferStorageMock;
+
+    struct CyRxSessCntx
+    {
+        CyMsgRxSessionMock                              msg_rx_mock;
+        CyMsgRxSessionMock::OnReceiveCallback::Function msg_rx_cb_fn;
+    };
+
+    void SetUp() override
+    {
+        cetl::pmr::set_default_resource(&mr_);
+
+        EXPECT_CALL(cy_transport_mock_, getProtocolParams())
+            .WillRepeatedly(Return(CyProtocolParams{std::numeric_limits<CyTransferId>::max(), 0, 0}));
+    }
+
+    void TearDown() override
+    {
+        EXPECT_THAT(mr_.allocations, IsEmpty());
+        EXPECT_THAT(mr_.total_allocated_bytes, mr_.total_deallocated_bytes);
+    }
+
+    libcyphal::TimePoint now() const
+    {
+        return scheduler_.now();
+    }
+
+    void expectCySource(CyRxSessCntx& cy_rx_sess_cntx, const CyPortId subject_id, const std::size_t extent)
+    {
+        using libcyphal::transport::MessageRxParamsEq;
+
+        const libcyphal::transport::MessageRxParams rx_params{extent, subject_id};
+        EXPECT_CALL(cy_rx_sess_cntx.msg_rx_mock, getParams())  //
+            .WillRepeatedly(Return(rx_params));
+        EXPECT_CALL(cy_rx_sess_cntx.msg_rx_mock, setOnReceiveCallback(_))  //
+            .WillRepeatedly(Invoke([&](auto&& cb_fn) {                     //
+                cy_rx_sess_cntx.msg_rx_cb_fn = std::forward<decltype(cb_fn)>(cb_fn);
+            }));
+        EXPECT_CALL(cy_transport_mock_, makeMessageRxSession(MessageRxParamsEq(rx_params)))  //
+            .WillOnce(Invoke([&](const auto&) {                                             //
+                return libcyphal::detail::makeUniquePtr<CyUniquePtrMsgRxSpec>(mr_, cy_rx_sess_cntx.msg_rx_mock);
+            }));
+        EXPECT_CALL(cy_rx_sess_cntx.msg_rx_mock, deinit()).Times(1);
+    }
+
+    void expectCyTarget(CyMsgTxSessionMock& msg_tx_mock, const CyPortId subject_id)
+    {
+        using libcyphal::transport::MessageTxParamsEq;
+
+        const libcyphal::transport::MessageTxParams tx_params{subject_id};
+        EXPECT_CALL(msg_tx_mock, getParams())  //
+            .WillRepeatedly(Return(tx_params));
+        EXPECT_CALL(cy_transport_mock_, makeMessageTxSession(MessageTxParamsEq(tx_params)))  //
+            .WillOnce(Invoke([&](const auto&) {                                             //
+                return libcyphal::detail::makeUniquePtr<CyUniquePtrMsgTxSpec>(mr_, msg_tx_mock);
+            }));
+        EXPECT_CALL(msg_tx_mock, deinit()).Times(1);
+    }
+
+    /// Emulates reception of a message (with the given payload) on one of the pipeline sources.
+    ///
+    template <std::size_t N>
+    void receive(CyRxSessCntx&              cy_rx_sess_cntx,
+                 const CyTransferId         transfer_id,
+                 const CyNodeId             publisher_node_id,
+                 std::array<cetl::byte, N>& payload)
+    {
+        NiceMock<CyScatteredBufferStorageMock> storage_mock;
+        EXPECT_CALL(storage_mock, size()).WillRepeatedly(Return(payload.size()));
+        EXPECT_CALL(storage_mock, forEachFragment(_)).WillRepeatedly(Invoke([&](auto& visitor) {
+            //
+            visitor.onNext(payload);
+        }));
+        CyMsgRxTransfer transfer{{{{transfer_id, CyPriority::Nominal}, now()}, publisher_node_id},
+                                 CyScatteredBuffer{CyScatteredBufferStorageMock::Wrapper{&storage_mock}}};
+        cy_rx_sess_cntx.msg_rx_cb_fn({transfer});
+    }
+
+    // NOLINTBEGIN
+    ocvsmd::TrackingMemoryResource mr_;
+    ocvsmd::VirtualTimeScheduler   scheduler_{};
+    CyTransportMock                cy_transport_mock_;
+    // NOLINTEND
+
+};  // TestPipeline
+
+// MARK: - Tests:
+
+TEST_F(TestPipeline, make_invalid)
+{
+    CyPresentation cy_presentation{mr_, scheduler_, cy_transport_mock_};
+
+    // No sources.
+    EXPECT_THAT(Pipeline::make(scheduler_, cy_presentation, {"no-sources", {}, 64, 300, {}}), IsNull());
+
+    // The target is also a source.
+    EXPECT_THAT(Pipeline::make(scheduler_, cy_presentation, {"loop", {100, 300}, 64, 300, {}}), IsNull());
+
+    // Unknown stage type.
+    EXPECT_THAT(Pipeline::make(scheduler_, cy_presentation, {"bad-stage", {100}, 64, 300, {{"foo", {}, 0.0, 0, 0}}}),
+                IsNull());
+}
+
+TEST_F(TestPipeline, dedup_across_sources)
+{
+    using libcyphal::transport::TransferTxMetadataEq;
+
+    constexpr CyPortId    SourceA = 100;
+    constexpr CyPortId    SourceB = 200;
+    constexpr CyPortId    Target  = 300;
+    constexpr std::size_t Extent  = 64;
+
+    CyPresentation cy_presentation{mr_, scheduler_, cy_transport_mock_};
+
+    // Subject B is a redundant mirror of subject A (f.e. via a bridge or federation),
+    // so the same message reaches the pipeline twice - each time with its own transfer-ID.
+    //
+    CyMsgTxSessionMock cy_tx_mock;
+    CyRxSessCntx       cy_rx_a;
+    CyRxSessCntx       cy_rx_b;
+    expectCyTarget(cy_tx_mock, Target);
+    expectCySource(cy_rx_a, SourceA, Extent);
+    expectCySource(cy_rx_b, SourceB, Extent);
+
+    const Config::Pipeline config{"merge", {SourceA, SourceB}, Extent, Target, {{"dedup", {}, 0.0, 500, 0}}};
+    auto                   pipeline = Pipeline::make(scheduler_, cy_presentation, config);
+    ASSERT_THAT(pipeline, NotNull());
+
+    std::array<cetl::byte, 3> payload_x{b(0x11), b(0x22), b(0x33)};
+    std::array<cetl::byte, 3> payload_y{b(0x11), b(0x22), b(0x34)};
+
+    scheduler_.scheduleAt(1s, [&](const auto&) {
+        //
+        // The first copy passes (as is - without payload copying), the second one (via B) is dropped.
+        //
+        EXPECT_CALL(cy_tx_mock, send(TransferTxMetadataEq({{0, CyPriority::Nominal}, now() + 100ms}), _))
+            .WillOnce(Invoke([&](const auto&, const auto fragments) {
+                //
+                EXPECT_THAT(fragments.size(), 1);
+                EXPECT_THAT(fragments[0].data(), payload_x.data());
+                return cetl::nullopt;
+            }));
+        receive(cy_rx_a, 7, 17, payload_x);
+        receive(cy_rx_b, 123, 17, payload_x);
+    });
+    scheduler_.scheduleAt(1s + 10ms, [&](const auto&) {
+        //
+        // The mirror is not necessarily slower - here a copy via B comes first.
+        //
+        EXPECT_CALL(cy_tx_mock, send(TransferTxMetadataEq({{1, CyPriority::Nominal}, now() + 100ms}), _))
+            .WillOnce(Return(cetl::nullopt));
+        receive(cy_rx_b, 124, 17, payload_y);
+        receive(cy_rx_a, 8, 17, payload_y);
+    });
+    scheduler_.scheduleAt(1s + 20ms, [&](const auto&) {
+        //
+        // The same payload but from another node is not a copy.
+        //
+        EXPECT_CALL(cy_tx_mock, send(TransferTxMetadataEq({{2, CyPriority::Nominal}, now() + 100ms}), _))
+            .WillOnce(Return(cetl::nullopt));
+        receive(cy_rx_a, 0, 18, payload_x);
+    });
+    scheduler_.scheduleAt(2s, [&](const auto&) {
+        //
+        // Dedup timeout has passed - so the same payload is a new message.
+        //
+        EXPECT_CALL(cy_tx_mock, send(TransferTxMetadataEq({{3, CyPriority::Nominal}, now() + 100ms}), _))
+            .WillOnce(Return(cetl::nullopt));
+        receive(cy_rx_a, 9, 17, payload_x);
+        receive(cy_rx_b, 125, 17, payload_x);
+    });
+    scheduler_.scheduleAt(3s, [&](const auto&) {
+        //
+        pipeline.reset();
+    });
+    scheduler_.spinFor(10s);
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+}  // namespace
@@ -0,0 +1,126 @@
+//
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "pipeline/stages.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+#include <libcyphal/transport/types.hpp>
+#include <libcyphal/types.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdint>
+
+namespace
+{
+
+using namespace ocvsmd::daemon::engine::pipeline;  // NOLINT This our main concern here in the unit tests.
+
+using libcyphal::TimePoint;
+using libcyphal::transport::Priority;
+
+// https://github.com/llvm/llvm-project/issues/53444
+// NOLINTBEGIN(misc-unused-using-decls, misc-include-cleaner)
+using std::literals::chrono_literals::operator""s;
+using std::literals::chrono_literals::operator""ms;
+// NOLINTEND(misc-unused-using-decls, misc-include-cleaner)
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+class TestPipelineStages : public testing::Test
+{
+protected:
+    static Message makeMessage(const libcyphal::Duration                           at,
+                               const libcyphal::transport::TransferId              transfer_id,
+                               const cetl::optional<libcyphal::transport::NodeId> node_id    = 42,
+                               const libcyphal::transport::PortId                  subject_id = 7509,
+                               const std::uint64_t                                 digest     = 0)
+    {
+        return Message{subject_id, TimePoint{} + at, Priority::Nominal, transfer_id, node_id, digest};
+    }
+};
+
+// MARK: - Tests:
+
+TEST_F(TestPipelineStages, node_filter)
+{
+    NodeFilterStage stage{{43, 42}};
+
+    auto msg = makeMessage(0s, 0, 42);
+    EXPECT_TRUE(stage.process(msg));
+    msg = makeMessage(0s, 0, 43);
+    EXPECT_TRUE(stage.process(msg));
+    msg = makeMessage(0s, 0, 44);
+    EXPECT_FALSE(stage.process(msg));
+    msg = makeMessage(0s, 0, cetl::nullopt);
+    EXPECT_FALSE(stage.process(msg));
+}
+
+TEST_F(TestPipelineStages, rate_limit)
+{
+    RateLimitStage stage{100ms};
+
+    auto msg = makeMessage(1s, 0);
+    EXPECT_TRUE(stage.process(msg));
+    msg = makeMessage(1s + 50ms, 1);
+    EXPECT_FALSE(stage.process(msg));
+    msg = makeMessage(1s + 99ms, 2);
+    EXPECT_FALSE(stage.process(msg));
+    msg = makeMessage(1s + 100ms, 3);
+    EXPECT_TRUE(stage.process(msg));
+    msg = makeMessage(1s + 150ms, 4);
+    EXPECT_FALSE(stage.process(msg));
+}
+
+TEST_F(TestPipelineStages, dedup)
+{
+    DedupStage stage{2s};
+
+    auto msg = makeMessage(1s, 7, 42, 100, 0xAA);
+    EXPECT_TRUE(stage.process(msg));
+    msg = makeMessage(1s + 1ms, 3, 42, 200, 0xAA);  // redundant copy - via another source, with its own transfer-ID
+    EXPECT_FALSE(stage.process(msg));
+    msg = makeMessage(1s + 2ms, 7, 43, 100, 0xAA);  // the same payload, but of a different node
+    EXPECT_TRUE(stage.process(msg));
+    msg = makeMessage(1s + 3ms, 8, 42, 100, 0xBB);  // the same node, but a different payload
+    EXPECT_TRUE(stage.process(msg));
+    msg = makeMessage(1s + 4ms, 4, 42, 200, 0xBB);  // redundant copy
+    EXPECT_FALSE(stage.process(msg));
+    msg = makeMessage(4s, 9, 42, 100, 0xAA);  // timeout has passed
+    EXPECT_TRUE(stage.process(msg));
+    msg = makeMessage(4s + 1ms, 5, 42, 200, 0xAA);  // ... but copies of the new message are still dropped
+    EXPECT_FALSE(stage.process(msg));
+}
+
+TEST_F(TestPipelineStages, dedup_anonymous)
+{
+    DedupStage stage{2s};
+
+    // Anonymous messages are deduplicated by payload only, and never match messages of a real node.
+    //
+    auto msg = makeMessage(1s, 1, cetl::nullopt, 100, 0xAA);
+    EXPECT_TRUE(stage.process(msg));
+    msg = makeMessage(1s + 1ms, 1, cetl::nullopt, 200, 0xAA);
+    EXPECT_FALSE(stage.process(msg));
+    msg = makeMessage(1s + 2ms, 1, 42, 200, 0xAA);
+    EXPECT_TRUE(stage.process(msg));
+    msg = makeMessage(1s + 3ms, 1, cetl::nullopt, 200, 0xBB);
+    EXPECT_TRUE(stage.process(msg));
+}
+
+TEST_F(TestPipelineStages, priority)
+{
+    PriorityStage stage{Priority::Exceptional};
+
+    auto msg = makeMessage(0s, 0);
+    EXPECT_TRUE(stage.process(msg));
+    EXPECT_EQ(msg.priority, Priority::Exceptional);
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+}  // namespace
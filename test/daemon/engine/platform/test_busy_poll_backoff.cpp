@@ -0,0 +1,154 @@
+//
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "ocvsmd/platform/defines.hpp"
+#include "ocvsmd/platform/log_linear_histogram.hpp"
+#include "ocvsmd/platform/posix_executor_extension.hpp"
+#include "platform/busy_poll_backoff.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+#include <cetl/rtti.hpp>
+#include <libcyphal/executor.hpp>
+#include <libcyphal/types.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <thread>
+#include <unistd.h>
+
+namespace
+{
+
+using ocvsmd::daemon::engine::platform::BusyPollBackoff;
+using Phase    = BusyPollBackoff::Phase;
+using Duration = libcyphal::Duration;
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+// MARK: - Tests:
+
+TEST(TestBusyPollBackoff, phases)
+{
+    using std::chrono::microseconds;
+
+    BusyPollBackoff                backoff{microseconds{100}, microseconds{1000}};
+    const libcyphal::TimePoint     start{};
+    const cetl::optional<Duration> timeout{microseconds{5000}};
+
+    // Spin while idle for less than 100us.
+    EXPECT_THAT(backoff.apply(0, start, timeout), cetl::optional<Duration>{Duration::zero()});
+    EXPECT_THAT(backoff.phase(), Phase::Spin);
+    EXPECT_THAT(backoff.apply(0, start + microseconds{99}, timeout), cetl::optional<Duration>{Duration::zero()});
+    EXPECT_THAT(backoff.phase(), Phase::Spin);
+
+    // Then yield - still with zero timeout.
+    EXPECT_THAT(backoff.apply(0, start + microseconds{100}, timeout), cetl::optional<Duration>{Duration::zero()});
+    EXPECT_THAT(backoff.phase(), Phase::Yield);
+
+    // Then block - with the given timeout (even infinite one).
+    EXPECT_THAT(backoff.apply(0, start + microseconds{1100}, timeout), timeout);
+    EXPECT_THAT(backoff.phase(), Phase::Block);
+    EXPECT_THAT(backoff.apply(0, start + microseconds{2000}, cetl::nullopt), cetl::nullopt);
+    EXPECT_THAT(backoff.phase(), Phase::Block);
+
+    // Any productive poll restarts spinning.
+    EXPECT_THAT(backoff.apply(1, start + microseconds{3000}, timeout), cetl::optional<Duration>{Duration::zero()});
+    EXPECT_THAT(backoff.phase(), Phase::Spin);
+    EXPECT_THAT(backoff.apply(1, start + microseconds{3150}, timeout), cetl::optional<Duration>{Duration::zero()});
+    EXPECT_THAT(backoff.phase(), Phase::Yield);
+}
+
+TEST(TestBusyPollBackoff, no_spinning)
+{
+    BusyPollBackoff backoff{Duration::zero(), Duration::zero()};
+
+    EXPECT_THAT(backoff.apply(0, libcyphal::TimePoint{}, cetl::nullopt), cetl::nullopt);
+    EXPECT_THAT(backoff.phase(), Phase::Block);
+}
+
+/// Compares RX latency (from a write of a timestamp to its reading by a callback) of the default (blocking)
+/// and the busy-poll run modes of the engine loop - on a pipe written periodically by another thread.
+///
+/// Disabled by default b/c it's a benchmark (without any assertions) - run it with `--gtest_also_run_disabled_tests`.
+///
+TEST(TestBusyPollBackoff, DISABLED_benchmark_rx_latency)
+{
+    using Clock = std::chrono::steady_clock;
+    using ocvsmd::platform::IPosixExecutorExtension;
+
+    constexpr std::size_t Samples = 5000;
+    constexpr auto        Period  = std::chrono::microseconds{200};
+
+    const auto run = [](const char* const name, cetl::optional<BusyPollBackoff> backoff) {
+        //
+        std::array<int, 2> fds{-1, -1};
+        ASSERT_THAT(::pipe(fds.data()), 0);
+
+        ocvsmd::platform::SingleThreadedExecutor executor;
+        ocvsmd::platform::LogLinearHistogram     latency;
+
+        auto* const posix_executor_ext = cetl::rtti_cast<IPosixExecutorExtension*>(&executor);
+        ASSERT_THAT(posix_executor_ext, testing::NotNull());
+        auto callback = posix_executor_ext->registerAwaitableCallback(
+            [&fds, &latency](const auto&) {
+                //
+                Clock::rep sent = 0;
+                if (::read(fds[0], &sent, sizeof(sent)) == sizeof(sent))
+                {
+                    const auto now = Clock::now().time_since_epoch().count();
+                    latency.record(static_cast<std::uint64_t>(
+                        std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::duration{now - sent}).count()));
+                }
+            },
+            IPosixExecutorExtension::Trigger::Readable{fds[0]});
+
+        std::atomic<bool> is_done{false};
+        std::thread       writer{[&fds, &is_done] {
+            for (std::size_t sample = 0; sample < Samples; ++sample)
+            {
+                std::this_thread::sleep_for(Period);
+                const auto sent = Clock::now().time_since_epoch().count();
+                (void) ::write(fds[1], &sent, sizeof(sent));
+            }
+            is_done = true;
+        }};
+
+        while (!is_done || (latency.count() < Samples))
+        {
+            (void) executor.spinOnce();
+
+            cetl::optional<Duration> timeout{std::chrono::milliseconds{10}};
+            if (backoff)
+            {
+                timeout = backoff->apply(executor.readyAwaitablesCount(), executor.now(), timeout);
+            }
+            (void) executor.pollAwaitableResourcesFor(timeout);
+        }
+        writer.join();
+        callback.reset();
+        ::close(fds[0]);
+        ::close(fds[1]);
+
+        std::cout << name << ": samples=" << latency.count() << ", p50=" << latency.percentile(50.0)
+                  << "ns, p99=" << latency.percentile(99.0) << "ns, p99.9=" << latency.percentile(99.9)
+                  << "ns, max=" << latency.max() << "ns.\n";
+    };
+
+    using std::chrono::microseconds;
+    run("blocking", cetl::nullopt);
+    run("busy_poll (spin only)", BusyPollBackoff{microseconds{1000000}, Duration::zero()});
+    run("busy_poll (spin 100us, yield 1ms)", BusyPollBackoff{microseconds{100}, microseconds{1000}});
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+}  // namespace
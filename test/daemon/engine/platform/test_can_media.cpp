@@ -0,0 +1,206 @@
+//
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "platform/can/can_media.hpp"
+
+#include "virtual_time_scheduler.hpp"
+
+#include <canard.h>
+#include <cetl/pf17/cetlpf.hpp>
+#include <libcyphal/transport/can/media.hpp>
+#include <libcyphal/transport/media_payload.hpp>
+#include <libcyphal/types.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <net/if.h>
+#include <thread>
+#include <utility>
+
+namespace
+{
+
+using namespace ocvsmd::daemon::engine::platform::can;  // NOLINT This our main concern here in the unit tests.
+
+using libcyphal::transport::can::IMedia;
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+class TestCanMedia : public testing::Test
+{
+protected:
+    /// Name of the virtual CAN device used by the "live" tests below.
+    ///
+    /// Could be created (with CAN FD support) like this:
+    /// ```
+    /// sudo ip link add dev vcan0 type vcan && sudo ip link set vcan0 mtu 72 && sudo ip link set up vcan0
+    /// ```
+    static constexpr const char* VcanName = "vcan0";
+
+    void SetUp() override
+    {
+        if (::if_nametoindex(VcanName) == 0)
+        {
+            GTEST_SKIP() << "No '" << VcanName << "' device.";
+        }
+    }
+
+    CanMedia makeMedia(const cetl::string_view address)
+    {
+        auto maybe_media = CanMedia::make(mr_, scheduler_, address, mr_, false);
+        auto* media      = cetl::get_if<CanMedia>(&maybe_media);
+        EXPECT_THAT(media, testing::NotNull());
+        return std::move(*media);
+    }
+
+    // MARK: Data members:
+
+    // NOLINTBEGIN
+    cetl::pmr::memory_resource&  mr_{*cetl::pmr::new_delete_resource()};
+    ocvsmd::VirtualTimeScheduler scheduler_{};
+    // NOLINTEND
+};
+
+// MARK: - Tests:
+
+TEST(TestCanIfaceAddress, parse)
+{
+    const auto classic = CanIfaceAddress::parse("can0");
+    EXPECT_THAT(classic.name, "can0");
+    EXPECT_FALSE(classic.is_fd);
+
+    const auto fd = CanIfaceAddress::parse("can1?fd=1");
+    EXPECT_THAT(fd.name, "can1");
+    EXPECT_TRUE(fd.is_fd);
+
+    const auto other = CanIfaceAddress::parse("vcan0?foo=bar&fd=true&");
+    EXPECT_THAT(other.name, "vcan0");
+    EXPECT_TRUE(other.is_fd);
+
+    EXPECT_FALSE(CanIfaceAddress::parse("can0?fd=0").is_fd);
+
+    const auto buffers = CanIfaceAddress::parse("can2?rcvbuf=262144&fd=1&sndbuf=65536");
+    EXPECT_THAT(buffers.name, "can2");
+    EXPECT_TRUE(buffers.is_fd);
+    EXPECT_THAT(buffers.buffer_sizes.rcvbuf, 262144);
+    EXPECT_THAT(buffers.buffer_sizes.sndbuf, 65536);
+
+    EXPECT_THAT(CanIfaceAddress::parse("can0?rcvbuf=64k").buffer_sizes.rcvbuf, 0);
+}
+
+TEST_F(TestCanMedia, mtu)
+{
+    auto classic_media = makeMedia(VcanName);
+    EXPECT_THAT(static_cast<IMedia&>(classic_media).getMtu(), CANARD_MTU_CAN_CLASSIC);
+
+    auto fd_media = makeMedia("vcan0?fd=1");
+    EXPECT_THAT(static_cast<IMedia&>(fd_media).getMtu(), CANARD_MTU_CAN_FD);
+}
+
+TEST_F(TestCanMedia, fd_frame_roundtrip)
+{
+    using PushResult = IMedia::PushResult;
+    using PopResult  = IMedia::PopResult;
+
+    constexpr libcyphal::transport::can::CanId CanId = 0x1234567U;
+
+    auto  tx_media = makeMedia("vcan0?fd=1");
+    auto  rx_media = makeMedia("vcan0?fd=1");
+    auto& tx_iface = static_cast<IMedia&>(tx_media);
+    auto& rx_iface = static_cast<IMedia&>(rx_media);
+
+    auto* const data = static_cast<cetl::byte*>(mr_.allocate(CANARD_MTU_CAN_FD));
+    for (std::size_t i = 0; i < CANARD_MTU_CAN_FD; ++i)
+    {
+        data[i] = static_cast<cetl::byte>(i);  // NOLINT
+    }
+    libcyphal::transport::MediaPayload payload{CANARD_MTU_CAN_FD, data, CANARD_MTU_CAN_FD, &mr_};
+
+    const auto        push_result  = tx_iface.push(scheduler_.now() + std::chrono::seconds{1}, CanId, payload);
+    const auto* const push_success = cetl::get_if<PushResult::Success>(&push_result);
+    ASSERT_THAT(push_success, testing::NotNull());
+    EXPECT_TRUE(push_success->is_accepted);
+
+    // Staged frame is written by the deferred flush.
+    scheduler_.spinFor(std::chrono::microseconds{1});
+
+    // The frame is delivered to the other socket asynchronously - so give it some time.
+    //
+    std::array<cetl::byte, CANARD_MTU_CAN_FD> buffer{};
+    PopResult::Success                        popped{};
+    for (int attempt = 0; (attempt < 100) && !popped.has_value(); ++attempt)
+    {
+        auto        pop_result  = rx_iface.pop({buffer.data(), buffer.size()});
+        auto* const pop_success = cetl::get_if<PopResult::Success>(&pop_result);
+        ASSERT_THAT(pop_success, testing::NotNull());
+        popped = *pop_success;
+        if (!popped.has_value())
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds{1});
+        }
+    }
+    ASSERT_TRUE(popped.has_value());
+    EXPECT_THAT(popped->can_id, CanId);
+    EXPECT_THAT(popped->payload_size, CANARD_MTU_CAN_FD);
+    EXPECT_THAT(buffer[63], static_cast<cetl::byte>(63));
+}
+
+TEST_F(TestCanMedia, batched_roundtrip)
+{
+    using PushResult = IMedia::PushResult;
+    using PopResult  = IMedia::PopResult;
+
+    constexpr std::size_t FramesCount = 40;
+
+    auto  tx_media = makeMedia(VcanName);
+    auto  rx_media = makeMedia(VcanName);
+    auto& tx_iface = static_cast<IMedia&>(tx_media);
+    auto& rx_iface = static_cast<IMedia&>(rx_media);
+
+    // More frames than a single batch - the overflow is flushed by `push` itself.
+    //
+    const auto deadline = scheduler_.now() + std::chrono::seconds{1};
+    for (std::size_t i = 0; i < FramesCount; ++i)
+    {
+        auto* const data = static_cast<cetl::byte*>(mr_.allocate(1));
+        *data            = static_cast<cetl::byte>(i);
+        libcyphal::transport::MediaPayload payload{1, data, 1, &mr_};
+
+        const auto        can_id       = static_cast<libcyphal::transport::can::CanId>(i);
+        const auto        push_result  = tx_iface.push(deadline, can_id, payload);
+        const auto* const push_success = cetl::get_if<PushResult::Success>(&push_result);
+        ASSERT_THAT(push_success, testing::NotNull());
+        EXPECT_TRUE(push_success->is_accepted);
+    }
+    scheduler_.spinFor(std::chrono::microseconds{1});
+
+    // Frames are popped one by one (in order), but read from the socket in batches.
+    //
+    std::array<cetl::byte, CANARD_MTU_CAN_CLASSIC> buffer{};
+    std::size_t                                    popped_count = 0;
+    for (int attempt = 0; (attempt < 100) && (popped_count < FramesCount); ++attempt)
+    {
+        auto        pop_result  = rx_iface.pop({buffer.data(), buffer.size()});
+        auto* const pop_success = cetl::get_if<PopResult::Success>(&pop_result);
+        ASSERT_THAT(pop_success, testing::NotNull());
+        if (!pop_success->has_value())
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds{1});
+            continue;
+        }
+        EXPECT_THAT((*pop_success)->can_id, popped_count);
+        EXPECT_THAT(buffer[0], static_cast<cetl::byte>(popped_count));
+        ++popped_count;
+    }
+    EXPECT_THAT(popped_count, FramesCount);
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+}  // namespace
@@ -0,0 +1,557 @@
+//
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "ocvsmd/platform/linux/epoll_single_threaded_executor.hpp"
+#include "ocvsmd/platform/linux/io_uring_single_threaded_executor.hpp"
+#include "ocvsmd/platform/posix_executor_extension.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+#include <cetl/rtti.hpp>
+#include <libcyphal/executor.hpp>
+#include <libcyphal/types.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <sys/eventfd.h>
+#include <unistd.h>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+using ocvsmd::platform::IPosixExecutorExtension;
+using ocvsmd::platform::Linux::EpollSingleThreadedExecutor;
+using ocvsmd::platform::Linux::IoUringSingleThreadedExecutor;
+using Callback = libcyphal::IExecutor::Callback;
+using Readable = IPosixExecutorExtension::Trigger::Readable;
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+class TestEpollExecutor : public testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        ASSERT_THAT(::pipe(pipe_fds_.data()), 0);
+    }
+
+    void TearDown() override
+    {
+        closePipe(pipe_fds_);
+    }
+
+    template <typename Executor>
+    static Callback::Any registerCallback(Executor&                                        executor,
+                                          const IPosixExecutorExtension::Trigger::Variant& trigger,
+                                          std::size_t&                                     counter)
+    {
+        auto* const posix_executor_ext = cetl::rtti_cast<IPosixExecutorExtension*>(&executor);
+        EXPECT_THAT(posix_executor_ext, testing::NotNull());
+        return posix_executor_ext->registerAwaitableCallback([&counter](const auto&) { ++counter; }, trigger);
+    }
+
+    static void pollAndSpin(EpollSingleThreadedExecutor& executor)
+    {
+        EXPECT_FALSE(executor.pollAwaitableResourcesFor(cetl::make_optional(std::chrono::milliseconds{10})));
+        (void) executor.spinOnce();
+    }
+
+    static void closePipe(std::array<int, 2>& fds)
+    {
+        for (auto& fd : fds)
+        {
+            if (fd >= 0)
+            {
+                ::close(fd);
+                fd = -1;
+            }
+        }
+    }
+
+    static void writeByte(const std::array<int, 2>& fds)
+    {
+        const char byte = 'x';
+        ASSERT_THAT(::write(fds[1], &byte, 1), 1);
+    }
+
+    static void readByte(const std::array<int, 2>& fds)
+    {
+        char byte = 0;
+        ASSERT_THAT(::read(fds[0], &byte, 1), 1);
+    }
+
+    // MARK: Data members:
+
+    // NOLINTBEGIN
+    std::array<int, 2> pipe_fds_{-1, -1};
+    // NOLINTEND
+};
+
+// MARK: - Tests:
+
+TEST_F(TestEpollExecutor, moved_callback)
+{
+    EpollSingleThreadedExecutor executor;
+
+    std::size_t   counter = 0;
+    Callback::Any callback;
+    {
+        auto tmp_callback = registerCallback(executor, Readable{pipe_fds_[0]}, counter);
+        callback          = std::move(tmp_callback);
+    }
+
+    writeByte(pipe_fds_);
+    pollAndSpin(executor);
+    EXPECT_THAT(counter, 1U);
+}
+
+TEST_F(TestEpollExecutor, reregistered_fd)
+{
+    EpollSingleThreadedExecutor executor;
+
+    // Removed (parked) registration should neither report events, nor prevent re-registration of its fd.
+    //
+    std::size_t counter1  = 0;
+    auto        callback1 = registerCallback(executor, Readable{pipe_fds_[0]}, counter1);
+    callback1.reset();
+
+    std::size_t        counter_other = 0;
+    std::array<int, 2> other_fds{-1, -1};
+    ASSERT_THAT(::pipe(other_fds.data()), 0);
+    auto other_callback = registerCallback(executor, Readable{other_fds[0]}, counter_other);
+
+    writeByte(pipe_fds_);
+    pollAndSpin(executor);
+    EXPECT_THAT(counter1, 0U);
+
+    for (std::size_t round = 1; round <= 3; ++round)
+    {
+        std::size_t counter2  = 0;
+        auto        callback2 = registerCallback(executor, Readable{pipe_fds_[0]}, counter2);
+        pollAndSpin(executor);
+        EXPECT_THAT(counter2, 1U);
+    }
+    EXPECT_THAT(counter1, 0U);
+    EXPECT_THAT(counter_other, 0U);
+
+    other_callback.reset();
+    closePipe(other_fds);
+}
+
+TEST_F(TestEpollExecutor, reopened_fd)
+{
+    EpollSingleThreadedExecutor executor;
+
+    std::size_t counter1  = 0;
+    auto        callback1 = registerCallback(executor, Readable{pipe_fds_[0]}, counter1);
+    callback1.reset();
+
+    // The same fd numbers are reused by the new pipe (but it's a different file for epoll).
+    //
+    const auto old_fds = pipe_fds_;
+    closePipe(pipe_fds_);
+    ASSERT_THAT(::pipe(pipe_fds_.data()), 0);
+    EXPECT_THAT(pipe_fds_, old_fds);
+
+    std::size_t counter2  = 0;
+    auto        callback2 = registerCallback(executor, Readable{pipe_fds_[0]}, counter2);
+    writeByte(pipe_fds_);
+    pollAndSpin(executor);
+    EXPECT_THAT(counter1, 0U);
+    EXPECT_THAT(counter2, 1U);
+}
+
+TEST_F(TestEpollExecutor, same_fd_two_triggers)
+{
+#if defined(CETL_ENABLE_DEBUG_ASSERT) && CETL_ENABLE_DEBUG_ASSERT
+    GTEST_SKIP() << "Refused registration is a debug assertion failure.";
+#endif
+    EpollSingleThreadedExecutor executor;
+
+    // Only one trigger per fd is supported - the second one is refused (and so its removal is a no-op).
+    //
+    std::size_t counter1  = 0;
+    std::size_t counter2  = 0;
+    auto        callback1 = registerCallback(executor, Readable{pipe_fds_[0]}, counter1);
+    auto        callback2 = registerCallback(executor, Readable{pipe_fds_[0]}, counter2);
+    EXPECT_TRUE(callback1.has_value());
+    EXPECT_FALSE(callback2.has_value());
+    callback2.reset();
+
+    writeByte(pipe_fds_);
+    pollAndSpin(executor);
+    EXPECT_THAT(counter1, 1U);
+    EXPECT_THAT(counter2, 0U);
+
+    // Once the first trigger is removed, the fd could be registered again.
+    //
+    callback1.reset();
+    callback2 = registerCallback(executor, Readable{pipe_fds_[0]}, counter2);
+    EXPECT_TRUE(callback2.has_value());
+    pollAndSpin(executor);
+    EXPECT_THAT(counter1, 1U);
+    EXPECT_THAT(counter2, 1U);
+}
+
+TEST_F(TestEpollExecutor, stale_registration_of_reopened_fd)
+{
+    EpollSingleThreadedExecutor executor;
+
+    std::size_t counter1  = 0;
+    auto        callback1 = registerCallback(executor, Readable{pipe_fds_[0]}, counter1);
+
+    // The fd is closed (and its number is reused by the new pipe) while still registered - so there are
+    // two triggers of the same fd number: the stale one, and the live one of the new pipe.
+    //
+    const auto old_fds = pipe_fds_;
+    closePipe(pipe_fds_);
+    ASSERT_THAT(::pipe(pipe_fds_.data()), 0);
+    EXPECT_THAT(pipe_fds_, old_fds);
+
+    std::size_t counter2  = 0;
+    auto        callback2 = registerCallback(executor, Readable{pipe_fds_[0]}, counter2);
+    EXPECT_TRUE(callback2.has_value());
+
+    // Removal of the stale one must not affect the live registration of the fd.
+    //
+    callback1.reset();
+    writeByte(pipe_fds_);
+    pollAndSpin(executor);
+    EXPECT_THAT(counter1, 0U);
+    EXPECT_THAT(counter2, 1U);
+}
+
+TEST_F(TestEpollExecutor, parked_fd_hang_up)
+{
+    EpollSingleThreadedExecutor executor;
+
+    std::size_t counter  = 0;
+    auto        callback = registerCallback(executor, Readable{pipe_fds_[0]}, counter);
+    callback.reset();
+
+    std::array<int, 2> other_fds{-1, -1};
+    ASSERT_THAT(::pipe(other_fds.data()), 0);
+    std::size_t other_counter  = 0;
+    auto        other_callback = registerCallback(executor, Readable{other_fds[0]}, other_counter);
+
+    // Hang-up is always reported by epoll (even with no events of interest), so the parked fd
+    // should be deleted from the epoll set on its first report - and then the poll should block again.
+    //
+    ::close(pipe_fds_[1]);
+    pipe_fds_[1] = -1;
+    pollAndSpin(executor);
+
+    const auto start = std::chrono::steady_clock::now();
+    pollAndSpin(executor);
+    EXPECT_THAT(std::chrono::steady_clock::now() - start, testing::Ge(std::chrono::milliseconds{10}));
+    EXPECT_THAT(executor.readyAwaitablesCount(), 0U);
+    EXPECT_THAT(counter, 0U);
+    EXPECT_THAT(other_counter, 0U);
+
+    other_callback.reset();
+    closePipe(other_fds);
+}
+
+TEST_F(TestEpollExecutor, event_trigger)
+{
+    EpollSingleThreadedExecutor executor;
+
+    const int event_fd = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    ASSERT_THAT(event_fd, testing::Ge(0));
+
+    std::size_t counter  = 0;
+    auto        callback = registerCallback(executor, IPosixExecutorExtension::Trigger::Event{event_fd}, counter);
+
+    // Multiple signals are coalesced, and the event is drained by the executor (so it doesn't stay ready).
+    //
+    const std::uint64_t value = 1;
+    ASSERT_THAT(::write(event_fd, &value, sizeof(value)), sizeof(value));
+    ASSERT_THAT(::write(event_fd, &value, sizeof(value)), sizeof(value));
+    pollAndSpin(executor);
+    EXPECT_THAT(counter, 1U);
+
+    const auto start = std::chrono::steady_clock::now();
+    pollAndSpin(executor);
+    EXPECT_THAT(std::chrono::steady_clock::now() - start, testing::Ge(std::chrono::milliseconds{10}));
+    EXPECT_THAT(counter, 1U);
+
+    callback.reset();
+    ::close(event_fd);
+}
+
+TEST_F(TestEpollExecutor, direct_dispatch)
+{
+    EpollSingleThreadedExecutor executor;
+    EXPECT_TRUE(executor.setDispatch(true, std::chrono::microseconds{100}));
+
+    std::size_t counter  = 0;
+    auto        callback = registerCallback(executor, Readable{pipe_fds_[0]}, counter);
+
+    // Ready callback is executed by the poll itself - no spin is needed.
+    //
+    writeByte(pipe_fds_);
+    EXPECT_FALSE(executor.pollAwaitableResourcesFor(cetl::make_optional(std::chrono::milliseconds{10})));
+    EXPECT_THAT(counter, 1U);
+    (void) executor.spinOnce();
+    EXPECT_THAT(counter, 1U);
+    readByte(pipe_fds_);
+}
+
+TEST_F(TestEpollExecutor, direct_dispatch_removal_by_callback)
+{
+    EpollSingleThreadedExecutor executor;
+    EXPECT_TRUE(executor.setDispatch(true, std::chrono::microseconds{100}));
+
+    std::array<int, 2> other_fds{-1, -1};
+    ASSERT_THAT(::pipe(other_fds.data()), 0);
+
+    // Both callbacks are ready in the same batch, and whichever runs first removes the other one,
+    // and re-registers its fd (with a new callback) - neither the removed, nor the new one should be called.
+    //
+    std::size_t   counter1 = 0;
+    std::size_t   counter2 = 0;
+    std::size_t   counter3 = 0;
+    Callback::Any callback1;
+    Callback::Any callback2;
+    const auto    make_callback = [&](std::size_t& counter, Callback::Any& self, Callback::Any& other, const int fd) {
+        //
+        auto* const posix_executor_ext = cetl::rtti_cast<IPosixExecutorExtension*>(&executor);
+        return posix_executor_ext->registerAwaitableCallback(
+            [&, fd](const auto&) {
+                //
+                ++counter;
+                other.reset();
+                self.reset();
+                self = registerCallback(executor, Readable{fd}, counter3);
+            },
+            Readable{fd});
+    };
+    callback1 = make_callback(counter1, callback1, callback2, pipe_fds_[0]);
+    callback2 = make_callback(counter2, callback2, callback1, other_fds[0]);
+
+    writeByte(pipe_fds_);
+    writeByte(other_fds);
+    EXPECT_FALSE(executor.pollAwaitableResourcesFor(cetl::make_optional(std::chrono::milliseconds{10})));
+    EXPECT_THAT(counter1 + counter2, 1U);
+    EXPECT_THAT(counter3, 0U);
+
+    // The new callback is called by the next poll (the byte is still there).
+    //
+    EXPECT_FALSE(executor.pollAwaitableResourcesFor(cetl::make_optional(std::chrono::milliseconds{10})));
+    EXPECT_THAT(counter1 + counter2, 1U);
+    EXPECT_THAT(counter3, 1U);
+
+    callback1.reset();
+    callback2.reset();
+    closePipe(other_fds);
+}
+
+TEST_F(TestEpollExecutor, adaptive_events_batch)
+{
+    constexpr std::size_t Sockets = 100;
+
+    EpollSingleThreadedExecutor executor;
+    EXPECT_TRUE(executor.setDispatch(true, std::chrono::seconds{1}));
+    EXPECT_THAT(executor.eventsBatchCapacity(), 16U);
+
+    auto* const posix_executor_ext = cetl::rtti_cast<IPosixExecutorExtension*>(&executor);
+
+    std::vector<std::array<int, 2>> pipes(Sockets);
+    std::vector<Callback::Any>      callbacks;
+    std::size_t                     counter = 0;
+    for (auto& fds : pipes)
+    {
+        ASSERT_THAT(::pipe(fds.data()), 0);
+        callbacks.push_back(posix_executor_ext->registerAwaitableCallback(
+            [&fds, &counter](const auto&) {
+                //
+                ++counter;
+                readByte(fds);
+            },
+            Readable{fds[0]}));
+        writeByte(fds);
+    }
+
+    // All ready events are drained by a single poll (within the budget), growing the batch on the way.
+    //
+    EXPECT_FALSE(executor.pollAwaitableResourcesFor(cetl::make_optional(std::chrono::milliseconds{10})));
+    EXPECT_THAT(counter, Sockets);
+    EXPECT_THAT(executor.eventsBatchCapacity(), 64U);
+
+    // Zero budget limits the poll to a single batch (even if it comes full).
+    //
+    EXPECT_TRUE(executor.setDispatch(true, std::chrono::microseconds{0}));
+    for (auto& fds : pipes)
+    {
+        writeByte(fds);
+        writeByte(fds);
+    }
+    EXPECT_FALSE(executor.pollAwaitableResourcesFor(cetl::make_optional(std::chrono::milliseconds{10})));
+    EXPECT_THAT(counter, Sockets + 64U);
+
+    callbacks.clear();
+    for (auto& fds : pipes)
+    {
+        closePipe(fds);
+    }
+}
+
+TEST_F(TestEpollExecutor, scheduled_dispatch_single_batch)
+{
+    constexpr std::size_t Sockets = 100;
+
+    EpollSingleThreadedExecutor executor;
+    EXPECT_TRUE(executor.setDispatch(false, std::chrono::seconds{1}));
+    EXPECT_THAT(executor.eventsBatchCapacity(), 16U);
+
+    auto* const posix_executor_ext = cetl::rtti_cast<IPosixExecutorExtension*>(&executor);
+
+    std::vector<std::array<int, 2>> pipes(Sockets);
+    std::vector<Callback::Any>      callbacks;
+    std::size_t                     counter = 0;
+    for (auto& fds : pipes)
+    {
+        ASSERT_THAT(::pipe(fds.data()), 0);
+        callbacks.push_back(posix_executor_ext->registerAwaitableCallback(
+            [&fds, &counter](const auto&) {
+                //
+                ++counter;
+                readByte(fds);
+            },
+            Readable{fds[0]}));
+        writeByte(fds);
+    }
+
+    // Scheduled callbacks haven't drained their fds yet - so the poll is limited to a single batch
+    // (instead of re-polling the same ready fds for the whole budget), but the batch still grows.
+    //
+    EXPECT_FALSE(executor.pollAwaitableResourcesFor(cetl::make_optional(std::chrono::milliseconds{10})));
+    EXPECT_THAT(executor.readyAwaitablesCount(), 16U);
+    EXPECT_THAT(executor.eventsBatchCapacity(), 32U);
+
+    (void) executor.spinOnce();
+    EXPECT_THAT(counter, 16U);
+
+    callbacks.clear();
+    for (auto& fds : pipes)
+    {
+        closePipe(fds);
+    }
+}
+
+/// Measures RX-to-IPC latency of a relay-like hot path - each "RX socket" (a pipe here) becomes readable,
+/// and its callback drains it, and forwards the byte to the "IPC socket" (another pipe). The engine loop is
+/// emulated by the poll-then-spin iterations.
+///
+/// Disabled by default b/c it's a benchmark (without any assertions) - run it with `--gtest_also_run_disabled_tests`.
+///
+TEST_F(TestEpollExecutor, DISABLED_benchmark_rx_to_ipc_latency)
+{
+    constexpr std::size_t Sockets = 16;
+    constexpr std::size_t Rounds  = 20000;
+
+    using Clock = std::chrono::steady_clock;
+
+    std::vector<std::array<int, 2>> rx_pipes(Sockets);
+    for (auto& fds : rx_pipes)
+    {
+        ASSERT_THAT(::pipe(fds.data()), 0);
+    }
+
+    const auto run = [this, &rx_pipes](const bool is_direct, const char* const name) {
+        //
+        EpollSingleThreadedExecutor executor;
+        (void) executor.setDispatch(is_direct, std::chrono::microseconds{100});
+        auto* const posix_executor_ext = cetl::rtti_cast<IPosixExecutorExtension*>(&executor);
+
+        Clock::time_point          rx_time{};
+        Clock::duration            total_latency{};
+        std::size_t                forwarded = 0;
+        std::vector<Callback::Any> callbacks;
+        for (const auto& fds : rx_pipes)
+        {
+            callbacks.push_back(posix_executor_ext->registerAwaitableCallback(
+                [this, &fds, &rx_time, &total_latency, &forwarded](const auto&) {
+                    //
+                    char byte = 0;
+                    (void) ::read(fds[0], &byte, 1);
+                    (void) ::write(pipe_fds_[1], &byte, 1);
+                    total_latency += Clock::now() - rx_time;
+                    ++forwarded;
+                },
+                Readable{fds[0]}));
+        }
+
+        for (std::size_t round = 0; round < Rounds; ++round)
+        {
+            const auto& fds  = rx_pipes[round % rx_pipes.size()];
+            char        byte = 'x';
+            rx_time          = Clock::now();
+            (void) ::write(fds[1], &byte, 1);
+            const auto target = forwarded + 1;
+            while (forwarded < target)
+            {
+                (void) executor.pollAwaitableResourcesFor(cetl::make_optional(std::chrono::milliseconds{10}));
+                (void) executor.spinOnce();
+            }
+            (void) ::read(pipe_fds_[0], &byte, 1);
+        }
+
+        std::cout << name << ": " << Rounds << " rounds, "
+                  << std::chrono::duration_cast<std::chrono::nanoseconds>(total_latency).count() / Rounds
+                  << " ns RX-to-IPC latency.\n";
+    };
+
+    run(false, "scheduled");
+    run(true, "direct");
+
+    for (auto& fds : rx_pipes)
+    {
+        closePipe(fds);
+    }
+}
+
+/// Measures rate of awaitable callbacks registration and removal - like in case of short-lived subscriptions
+/// (or RPC clients), each of which (re-)registers a callback for its socket (a pipe here).
+///
+/// Disabled by default b/c it's a benchmark (without any assertions) - run it with `--gtest_also_run_disabled_tests`.
+///
+TEST_F(TestEpollExecutor, DISABLED_benchmark_subscription_churn)
+{
+    constexpr std::size_t Rounds = 100000;
+
+    const auto run = [this](auto& executor, const char* const name) {
+        //
+        std::size_t counter = 0;
+        const auto  start   = std::chrono::steady_clock::now();
+        for (std::size_t round = 0; round < Rounds; ++round)
+        {
+            auto callback = registerCallback(executor, Readable{pipe_fds_[0]}, counter);
+            auto moved    = std::move(callback);
+        }
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+
+        std::cout << name << ": " << Rounds << " create/destroy rounds, "
+                  << std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count() / Rounds
+                  << " ns/round.\n";
+    };
+
+    EpollSingleThreadedExecutor epoll_executor;
+    run(epoll_executor, "epoll");
+
+    IoUringSingleThreadedExecutor io_uring_executor;
+    run(io_uring_executor, io_uring_executor.isIoUringBackend() ? "io_uring" : "io_uring (epoll fallback)");
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+}  // namespace
@@ -0,0 +1,144 @@
+//
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "ocvsmd/platform/executor_profiler.hpp"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+using ocvsmd::platform::ExecutorProfiler;
+using Category = ExecutorProfiler::Category;
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+/// The profiler is a mixin of executors - so here it's made just on its own.
+///
+class MyProfiler final : public ExecutorProfiler
+{};
+
+// MARK: - Tests:
+
+TEST(TestExecutorProfiler, categories)
+{
+    MyProfiler profiler;
+    EXPECT_TRUE(profiler.isProfilingEnabled());
+
+    profiler.recordCallback(Category::UdpRx, std::chrono::microseconds{10});
+    profiler.recordCallback(Category::UdpRx, std::chrono::microseconds{20});
+    profiler.recordCallback(Category::Service, std::chrono::microseconds{30});
+
+    EXPECT_THAT(profiler.callbackStats(Category::UdpRx).histogram.count(), 2);
+    EXPECT_THAT(profiler.callbackStats(Category::UdpRx).histogram.sum(), 30000);
+    EXPECT_THAT(profiler.callbackStats(Category::Service).histogram.count(), 1);
+    EXPECT_THAT(profiler.callbackStats(Category::Service).histogram.max(), 30000);
+    EXPECT_THAT(profiler.callbackStats(Category::CanTx).histogram.count(), 0);
+
+    for (std::size_t index = 0; index < ExecutorProfiler::categoriesCount(); ++index)
+    {
+        EXPECT_THAT(ExecutorProfiler::categoryName(static_cast<Category>(index)), testing::StrNe("?"));
+    }
+
+    profiler.resetProfilingStats();
+    EXPECT_THAT(profiler.callbackStats(Category::UdpRx).histogram.count(), 0);
+}
+
+TEST(TestExecutorProfiler, spins_and_lateness)
+{
+    MyProfiler profiler;
+
+    profiler.recordSpin(std::chrono::microseconds{5}, ExecutorProfiler::Duration::zero());
+    profiler.recordSpin(std::chrono::microseconds{7}, std::chrono::microseconds{100});
+
+    EXPECT_THAT(profiler.spinStats().histogram.count(), 2);
+    EXPECT_THAT(profiler.latenessHistogram().count(), 1);
+    EXPECT_THAT(profiler.latenessHistogram().max(), 100000);
+}
+
+TEST(TestExecutorProfiler, stall_watchdog)
+{
+    MyProfiler profiler;
+
+    std::vector<std::string> stalls;
+    profiler.setStallHandler([&stalls](const char* const what, const ExecutorProfiler::Duration) {
+        //
+        stalls.emplace_back(what);
+    });
+
+    // No budget - no stalls.
+    profiler.recordCallback(Category::CanRx, std::chrono::seconds{1});
+    EXPECT_THAT(stalls, testing::IsEmpty());
+
+    profiler.setCallbackBudget(std::chrono::milliseconds{1});
+    profiler.recordCallback(Category::CanRx, std::chrono::microseconds{999});
+    profiler.recordCallback(Category::CanRx, std::chrono::milliseconds{2});
+    profiler.recordSpin(std::chrono::milliseconds{3}, ExecutorProfiler::Duration::zero());
+    EXPECT_THAT(stalls, testing::ElementsAre("can_rx", "spin"));
+    EXPECT_THAT(profiler.callbackStats(Category::CanRx).over_budget, 1);
+    EXPECT_THAT(profiler.spinStats().over_budget, 1);
+}
+
+TEST(TestExecutorProfiler, scope)
+{
+    MyProfiler profiler;
+    {
+        const ExecutorProfiler::Scope scope{&profiler, Category::IpcRead};
+    }
+    EXPECT_THAT(profiler.callbackStats(Category::IpcRead).histogram.count(), 1);
+
+    // Disabled profiler - no-op probes.
+    profiler.setProfilingEnabled(false);
+    {
+        const ExecutorProfiler::Scope scope{&profiler, Category::IpcRead};
+    }
+    profiler.recordSpin(std::chrono::microseconds{1}, std::chrono::microseconds{1});
+    EXPECT_THAT(profiler.callbackStats(Category::IpcRead).histogram.count(), 1);
+    EXPECT_THAT(profiler.spinStats().histogram.count(), 0);
+
+    // No profiler at all (f.e. executor doesn't support it) - no-op probes.
+    {
+        const ExecutorProfiler::Scope scope{nullptr, Category::IpcRead};
+    }
+}
+
+/// Measures overhead of a single probe - enabled and disabled.
+///
+/// Disabled by default b/c it's a benchmark (without any assertions) - run it with `--gtest_also_run_disabled_tests`.
+///
+TEST(TestExecutorProfiler, DISABLED_benchmark_probe_overhead)
+{
+    constexpr std::size_t Rounds = 1000000;
+
+    MyProfiler profiler;
+
+    const auto run = [&profiler](const char* const name) {
+        //
+        const auto start = std::chrono::steady_clock::now();
+        for (std::size_t round = 0; round < Rounds; ++round)
+        {
+            const ExecutorProfiler::Scope scope{&profiler, Category::UdpRx};
+        }
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+
+        std::cout << name << ": " << std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count() / Rounds
+                  << " ns/probe.\n";
+    };
+
+    run("enabled");
+    profiler.setProfilingEnabled(false);
+    run("disabled");
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+}  // namespace
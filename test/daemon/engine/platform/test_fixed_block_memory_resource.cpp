@@ -0,0 +1,130 @@
+//
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "platform/fixed_block_memory_resource.hpp"
+
+#include "tracking_memory_resource.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+
+namespace
+{
+
+using namespace ocvsmd::daemon::engine::platform;  // NOLINT This our main concern here in the unit tests.
+
+using testing::IsEmpty;
+using testing::NotNull;
+using testing::SizeIs;
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+class TestFixedBlockMemoryResource : public testing::Test
+{
+protected:
+    void TearDown() override
+    {
+        EXPECT_THAT(mr_.allocations, IsEmpty());
+        EXPECT_THAT(mr_.total_allocated_bytes, mr_.total_deallocated_bytes);
+    }
+
+    // MARK: Data members:
+
+    // NOLINTBEGIN
+    ocvsmd::TrackingMemoryResource mr_;
+    // NOLINTEND
+};
+
+// MARK: - Tests:
+
+TEST_F(TestFixedBlockMemoryResource, blocks_are_reused)
+{
+    FixedBlockMemoryResource pool{mr_, 2000, 4};
+    EXPECT_THAT(pool.blockSize(), 2000);
+    EXPECT_THAT(pool.totalBlocks(), 0);
+
+    void* const block1 = pool.allocate(100);
+    void* const block2 = pool.allocate(2000);
+    ASSERT_THAT(block1, NotNull());
+    ASSERT_THAT(block2, NotNull());
+    EXPECT_TRUE(pool.owns(block1));
+    EXPECT_TRUE(pool.owns(block2));
+    EXPECT_THAT(pool.usedBlocks(), 2);
+    EXPECT_THAT(pool.totalBlocks(), 4);
+    EXPECT_THAT(mr_.allocations, SizeIs(1));  // the whole chunk
+
+    // Deallocation by a smaller size (than originally requested) is fine.
+    pool.deallocate(block2, 13);
+    EXPECT_THAT(pool.usedBlocks(), 1);
+    EXPECT_THAT(pool.allocate(42), block2);
+    EXPECT_THAT(mr_.allocations, SizeIs(1));
+
+    pool.deallocate(block1, 100);
+    pool.deallocate(block2, 42);
+    EXPECT_THAT(pool.usedBlocks(), 0);
+}
+
+TEST_F(TestFixedBlockMemoryResource, grows_by_chunks)
+{
+    FixedBlockMemoryResource pool{mr_, 64, 2};
+
+    void* const block1 = pool.allocate(64);
+    void* const block2 = pool.allocate(64);
+    EXPECT_THAT(mr_.allocations, SizeIs(1));
+
+    void* const block3 = pool.allocate(64);
+    EXPECT_TRUE(pool.owns(block3));
+    EXPECT_THAT(pool.totalBlocks(), 4);
+    EXPECT_THAT(mr_.allocations, SizeIs(2));
+
+    pool.deallocate(block1, 64);
+    pool.deallocate(block2, 64);
+    pool.deallocate(block3, 64);
+    EXPECT_THAT(pool.usedBlocks(), 0);
+
+    // Chunks are kept until the pool destruction.
+    EXPECT_THAT(mr_.allocations, SizeIs(2));
+}
+
+TEST_F(TestFixedBlockMemoryResource, oversized_goes_upstream)
+{
+    FixedBlockMemoryResource pool{mr_, 64, 2};
+
+    void* const big = pool.allocate(65);
+    ASSERT_THAT(big, NotNull());
+    EXPECT_FALSE(pool.owns(big));
+    EXPECT_THAT(pool.usedBlocks(), 0);
+    EXPECT_THAT(pool.totalBlocks(), 0);
+    EXPECT_THAT(mr_.allocations, SizeIs(1));
+    EXPECT_THAT(mr_.allocations[0].size, 65);
+
+    pool.deallocate(big, 65);
+    EXPECT_THAT(mr_.allocations, IsEmpty());
+}
+
+TEST_F(TestFixedBlockMemoryResource, prefault_preserves_content)
+{
+    FixedBlockMemoryResource pool{mr_, 2000, 8};
+    EXPECT_TRUE(pool.reserve(8));
+
+    auto* const block = static_cast<unsigned char*>(pool.allocate(2000));
+    ASSERT_THAT(block, NotNull());
+    std::fill_n(block, 2000, 0xA5);
+
+    pool.prefault();
+    EXPECT_TRUE(std::all_of(block, block + 2000, [](const unsigned char byte) { return byte == 0xA5; }));
+    EXPECT_THAT(pool.usedBlocks(), 1);
+    EXPECT_THAT(pool.totalBlocks(), 8);
+
+    pool.deallocate(block, 2000);
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+}  // namespace
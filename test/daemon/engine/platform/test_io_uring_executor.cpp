@@ -0,0 +1,281 @@
+//
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "ocvsmd/platform/linux/epoll_single_threaded_executor.hpp"
+#include "ocvsmd/platform/linux/io_uring_single_threaded_executor.hpp"
+#include "ocvsmd/platform/posix_executor_extension.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+#include <cetl/rtti.hpp>
+#include <libcyphal/executor.hpp>
+#include <libcyphal/types.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <unistd.h>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+using ocvsmd::platform::IPosixExecutorExtension;
+using ocvsmd::platform::Linux::EpollSingleThreadedExecutor;
+using ocvsmd::platform::Linux::IoUringSingleThreadedExecutor;
+using Callback = libcyphal::IExecutor::Callback;
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+class TestIoUringExecutor : public testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        ASSERT_THAT(::pipe(pipe_fds_.data()), 0);
+    }
+
+    void TearDown() override
+    {
+        ::close(pipe_fds_[0]);
+        ::close(pipe_fds_[1]);
+    }
+
+    template <typename Executor>
+    static Callback::Any registerCallback(Executor&                                        executor,
+                                          const IPosixExecutorExtension::Trigger::Variant& trigger,
+                                          std::size_t&                                     counter)
+    {
+        auto* const posix_executor_ext = cetl::rtti_cast<IPosixExecutorExtension*>(&executor);
+        EXPECT_THAT(posix_executor_ext, testing::NotNull());
+        return posix_executor_ext->registerAwaitableCallback([&counter](const auto&) { ++counter; }, trigger);
+    }
+
+    template <typename Executor>
+    static void pollAndSpin(Executor& executor)
+    {
+        EXPECT_FALSE(executor.pollAwaitableResourcesFor(cetl::make_optional(std::chrono::milliseconds{10})));
+        (void) executor.spinOnce();
+    }
+
+    int readFd() const
+    {
+        return pipe_fds_[0];
+    }
+
+    int writeFd() const
+    {
+        return pipe_fds_[1];
+    }
+
+    void writeByte() const
+    {
+        const char byte = 'x';
+        ASSERT_THAT(::write(writeFd(), &byte, 1), 1);
+    }
+
+    void readByte() const
+    {
+        char byte = 0;
+        ASSERT_THAT(::read(readFd(), &byte, 1), 1);
+    }
+
+    // MARK: Data members:
+
+    // NOLINTBEGIN
+    std::array<int, 2> pipe_fds_{-1, -1};
+    // NOLINTEND
+};
+
+// MARK: - Tests:
+
+TEST_F(TestIoUringExecutor, readable_trigger)
+{
+    IoUringSingleThreadedExecutor executor;
+    if (!executor.isIoUringBackend())
+    {
+        std::cout << "io_uring is not available - testing epoll fallback.\n";
+    }
+
+    std::size_t counter  = 0;
+    auto        callback = registerCallback(executor, IPosixExecutorExtension::Trigger::Readable{readFd()}, counter);
+    EXPECT_TRUE(callback.has_value());
+
+    pollAndSpin(executor);
+    EXPECT_THAT(counter, 0U);
+
+    // The request should be re-armed across multiple readiness events.
+    //
+    for (std::size_t round = 1; round <= 3; ++round)
+    {
+        writeByte();
+        pollAndSpin(executor);
+        EXPECT_THAT(counter, round);
+        readByte();
+    }
+}
+
+TEST_F(TestIoUringExecutor, writable_trigger)
+{
+    IoUringSingleThreadedExecutor executor;
+
+    std::size_t counter  = 0;
+    auto        callback = registerCallback(executor, IPosixExecutorExtension::Trigger::Writable{writeFd()}, counter);
+
+    pollAndSpin(executor);
+    EXPECT_THAT(counter, 1U);
+}
+
+TEST_F(TestIoUringExecutor, readable_trigger_with_data_left)
+{
+    IoUringSingleThreadedExecutor executor;
+
+    // The callback consumes just one byte per call - the rest is left in the fd.
+    //
+    std::size_t counter            = 0;
+    auto* const posix_executor_ext = cetl::rtti_cast<IPosixExecutorExtension*>(&executor);
+    ASSERT_THAT(posix_executor_ext, testing::NotNull());
+    auto callback = posix_executor_ext->registerAwaitableCallback(
+        [this, &counter](const auto&) {
+            //
+            ++counter;
+            readByte();
+        },
+        IPosixExecutorExtension::Trigger::Readable{readFd()});
+    EXPECT_TRUE(callback.has_value());
+
+    writeByte();
+    writeByte();
+    writeByte();
+
+    // Level-triggered (like `epoll`) - the callback is called again while there is still some data,
+    // even without any new writes into the fd.
+    //
+    for (std::size_t round = 1; round <= 3; ++round)
+    {
+        pollAndSpin(executor);
+        EXPECT_THAT(counter, round);
+    }
+
+    // All data has been consumed - so no more calls.
+    //
+    pollAndSpin(executor);
+    EXPECT_THAT(counter, 3U);
+}
+
+TEST_F(TestIoUringExecutor, writable_trigger_repeated_polls)
+{
+    IoUringSingleThreadedExecutor executor;
+
+    std::size_t counter  = 0;
+    auto        callback = registerCallback(executor, IPosixExecutorExtension::Trigger::Writable{writeFd()}, counter);
+
+    // The pipe stays writable - so every poll makes the callback ready again.
+    //
+    for (std::size_t round = 1; round <= 3; ++round)
+    {
+        pollAndSpin(executor);
+        EXPECT_THAT(counter, round);
+    }
+}
+
+TEST_F(TestIoUringExecutor, removed_callback)
+{
+    IoUringSingleThreadedExecutor executor;
+
+    std::size_t counter1  = 0;
+    auto        callback1 = registerCallback(executor, IPosixExecutorExtension::Trigger::Readable{readFd()}, counter1);
+    pollAndSpin(executor);
+
+    // Late completion of the removed request should not reach the new callback (which reuses the slot).
+    //
+    writeByte();
+    callback1.reset();
+    std::size_t counter2  = 0;
+    auto        callback2 = registerCallback(executor, IPosixExecutorExtension::Trigger::Readable{readFd()}, counter2);
+    pollAndSpin(executor);
+    pollAndSpin(executor);
+    EXPECT_THAT(counter1, 0U);
+    EXPECT_THAT(counter2, testing::Ge(1U));
+}
+
+TEST_F(TestIoUringExecutor, moved_callback)
+{
+    IoUringSingleThreadedExecutor executor;
+
+    std::size_t   counter = 0;
+    Callback::Any callback;
+    {
+        auto tmp_callback = registerCallback(executor, IPosixExecutorExtension::Trigger::Readable{readFd()}, counter);
+        callback          = std::move(tmp_callback);
+    }
+
+    writeByte();
+    pollAndSpin(executor);
+    EXPECT_THAT(counter, 1U);
+}
+
+/// Compares `epoll` and `io_uring` executors on a relay-like hot path - many sockets (pipes here),
+/// each of which becomes readable, gets drained by its callback, and so on.
+///
+/// Disabled by default b/c it's a benchmark (without any assertions) - run it with `--gtest_also_run_disabled_tests`.
+///
+TEST_F(TestIoUringExecutor, DISABLED_benchmark_relay_hot_path)
+{
+    constexpr std::size_t Sockets = 16;
+    constexpr std::size_t Rounds  = 20000;
+
+    std::vector<std::array<int, 2>> pipes(Sockets);
+    for (auto& fds : pipes)
+    {
+        ASSERT_THAT(::pipe(fds.data()), 0);
+    }
+
+    const auto run = [&pipes](auto& executor, const char* const name) {
+        //
+        std::size_t                total = 0;
+        std::vector<Callback::Any> callbacks;
+        for (const auto& fds : pipes)
+        {
+            callbacks.push_back(registerCallback(executor, IPosixExecutorExtension::Trigger::Readable{fds[0]}, total));
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+        for (std::size_t round = 0; round < Rounds; ++round)
+        {
+            const auto& fds  = pipes[round % pipes.size()];
+            char        byte = 'x';
+            (void) ::write(fds[1], &byte, 1);
+            (void) executor.pollAwaitableResourcesFor(cetl::make_optional(std::chrono::milliseconds{10}));
+            (void) executor.spinOnce();
+            (void) ::read(fds[0], &byte, 1);
+        }
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+
+        std::cout << name << ": " << Rounds << " rounds, "
+                  << std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count() / Rounds
+                  << " ns/round (callbacks=" << total << ").\n";
+    };
+
+    EpollSingleThreadedExecutor epoll_executor;
+    run(epoll_executor, "epoll");
+
+    IoUringSingleThreadedExecutor io_uring_executor;
+    run(io_uring_executor, io_uring_executor.isIoUringBackend() ? "io_uring" : "io_uring (epoll fallback)");
+
+    for (auto& fds : pipes)
+    {
+        ::close(fds[0]);
+        ::close(fds[1]);
+    }
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+}  // namespace
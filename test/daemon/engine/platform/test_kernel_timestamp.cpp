@@ -0,0 +1,75 @@
+//
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "platform/kernel_timestamp.hpp"
+
+#include <libcyphal/types.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdint>
+
+namespace
+{
+
+using namespace ocvsmd::daemon::engine::platform;  // NOLINT This our main concern here in the unit tests.
+
+using libcyphal::TimePoint;
+
+// https://github.com/llvm/llvm-project/issues/53444
+// NOLINTBEGIN(misc-unused-using-decls, misc-include-cleaner)
+using std::literals::chrono_literals::operator""s;
+using std::literals::chrono_literals::operator""ms;
+// NOLINTEND(misc-unused-using-decls, misc-include-cleaner)
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+// MARK: - Tests:
+
+TEST(TestKernelTimestamp, not_available)
+{
+    const TimePoint     now{TimePoint{} + 10s};
+    const std::uint64_t now_realtime_ns = 1'700'000'000'000'000'000ULL;
+
+    EXPECT_THAT(fromKernelTimestamp(now, now_realtime_ns, 0), now);
+    EXPECT_THAT(fromKernelTimestamp(now, 0, now_realtime_ns - 1'000'000ULL), now);
+}
+
+TEST(TestKernelTimestamp, from_future)
+{
+    const TimePoint     now{TimePoint{} + 10s};
+    const std::uint64_t now_realtime_ns = 1'700'000'000'000'000'000ULL;
+
+    EXPECT_THAT(fromKernelTimestamp(now, now_realtime_ns, now_realtime_ns + 60'000'000'000ULL), now);
+}
+
+TEST(TestKernelTimestamp, by_age)
+{
+    const TimePoint     now{TimePoint{} + 10s};
+    const std::uint64_t now_realtime_ns = 1'700'000'000'000'000'000ULL;
+
+    EXPECT_THAT(fromKernelTimestamp(now, now_realtime_ns, now_realtime_ns - 250'000'000ULL), now - 250ms);
+}
+
+TEST(TestKernelTimestamp, same_base_for_whole_batch)
+{
+    // Items of a batch are converted against the same (once per batch sampled) base -
+    // so their relative order and spacing are preserved regardless of when they are processed.
+    //
+    const TimePoint now{TimePoint{} + 10s};
+    const auto      now_realtime_ns = realtimeNowNs();
+    ASSERT_THAT(now_realtime_ns, testing::Gt(0));
+
+    const auto first  = fromKernelTimestamp(now, now_realtime_ns, now_realtime_ns - 3'000'000ULL);
+    const auto second = fromKernelTimestamp(now, now_realtime_ns, now_realtime_ns - 2'000'000ULL);
+    EXPECT_THAT(first, now - 3ms);
+    EXPECT_THAT(second - first, std::chrono::milliseconds{1});
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+}  // namespace
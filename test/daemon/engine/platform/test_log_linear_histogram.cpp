@@ -0,0 +1,77 @@
+//
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "ocvsmd/platform/log_linear_histogram.hpp"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+namespace
+{
+
+using namespace ocvsmd::platform;  // NOLINT This our main concern here in the unit tests.
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+// MARK: - Tests:
+
+TEST(TestLogLinearHistogram, buckets)
+{
+    // Small values are exact.
+    EXPECT_THAT(LogLinearHistogram::bucketIndex(0), 0);
+    EXPECT_THAT(LogLinearHistogram::bucketIndex(3), 3);
+    EXPECT_THAT(LogLinearHistogram::bucketIndex(7), 7);
+
+    // Then each octave is split into 4 linear buckets.
+    EXPECT_THAT(LogLinearHistogram::bucketIndex(8), 8);
+    EXPECT_THAT(LogLinearHistogram::bucketIndex(9), 8);
+    EXPECT_THAT(LogLinearHistogram::bucketIndex(10), 9);
+    EXPECT_THAT(LogLinearHistogram::bucketIndex(16), 12);
+    EXPECT_THAT(LogLinearHistogram::bucketLowerBound(35), 896);
+    EXPECT_THAT(LogLinearHistogram::bucketUpperBound(35), 1023);
+
+    const auto max_value = std::numeric_limits<std::uint64_t>::max();
+    EXPECT_THAT(LogLinearHistogram::bucketIndex(max_value), LogLinearHistogram::bucketsCount() - 1);
+    EXPECT_THAT(LogLinearHistogram::bucketUpperBound(LogLinearHistogram::bucketsCount() - 1), max_value);
+
+    // Bounds of every bucket should fall into the bucket itself.
+    for (std::size_t index = 0; index < LogLinearHistogram::bucketsCount(); ++index)
+    {
+        EXPECT_THAT(LogLinearHistogram::bucketIndex(LogLinearHistogram::bucketLowerBound(index)), index);
+        EXPECT_THAT(LogLinearHistogram::bucketIndex(LogLinearHistogram::bucketUpperBound(index)), index);
+    }
+}
+
+TEST(TestLogLinearHistogram, percentiles)
+{
+    LogLinearHistogram histogram;
+    EXPECT_THAT(histogram.percentile(50.0), 0);
+
+    for (std::uint64_t value = 1; value <= 1000; ++value)
+    {
+        histogram.record(value * 1000);
+    }
+    EXPECT_THAT(histogram.count(), 1000);
+    EXPECT_THAT(histogram.sum(), 500500000);
+    EXPECT_THAT(histogram.max(), 1000000);
+
+    // Relative error is within 25%.
+    EXPECT_THAT(histogram.percentile(50.0), testing::AllOf(testing::Ge(500000), testing::Le(625000)));
+    EXPECT_THAT(histogram.percentile(99.0), testing::AllOf(testing::Ge(990000), testing::Le(1000000)));
+    EXPECT_THAT(histogram.percentile(100.0), 1000000);
+
+    histogram.reset();
+    EXPECT_THAT(histogram.count(), 0);
+    EXPECT_THAT(histogram.max(), 0);
+    EXPECT_THAT(histogram.bucketCount(LogLinearHistogram::bucketIndex(1000)), 0);
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+}  // namespace
@@ -0,0 +1,117 @@
+//
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "platform/media_health.hpp"
+
+#include <libcyphal/types.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cerrno>
+#include <chrono>
+
+namespace
+{
+
+using namespace ocvsmd::daemon::engine::platform;  // NOLINT This our main concern here in the unit tests.
+
+using libcyphal::TimePoint;
+
+// https://github.com/llvm/llvm-project/issues/53444
+// NOLINTBEGIN(misc-unused-using-decls, misc-include-cleaner)
+using std::literals::chrono_literals::operator""s;
+using std::literals::chrono_literals::operator""ms;
+// NOLINTEND(misc-unused-using-decls, misc-include-cleaner)
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+// MARK: - Tests:
+
+TEST(TestMediaHealth, activity_is_counted)
+{
+    MediaHealth health;
+    EXPECT_TRUE(health.isUp());
+
+    health.noteRx(TimePoint{} + 1s, 3);
+    health.noteTx();
+    health.noteTx(2);
+
+    const auto snapshot = health.snapshot();
+    EXPECT_TRUE(snapshot.is_up);
+    EXPECT_THAT(snapshot.rx_frames, 3);
+    EXPECT_THAT(snapshot.tx_frames, 3);
+    EXPECT_THAT(snapshot.last_rx_time, TimePoint{} + 1s);
+    EXPECT_THAT(snapshot.rx_errors, 0);
+    EXPECT_THAT(snapshot.tx_errors, 0);
+}
+
+TEST(TestMediaHealth, transient_errors_keep_it_up)
+{
+    MediaHealth health;
+
+    EXPECT_FALSE(health.noteError(TimePoint{}, EAGAIN, true));
+    EXPECT_FALSE(health.noteError(TimePoint{}, ENOBUFS, false));
+    EXPECT_TRUE(health.isUp());
+
+    const auto snapshot = health.snapshot();
+    EXPECT_THAT(snapshot.tx_errors, 1);
+    EXPECT_THAT(snapshot.rx_errors, 1);
+    EXPECT_THAT(snapshot.last_error, ENOBUFS);
+}
+
+TEST(TestMediaHealth, link_error_brings_it_down_until_activity)
+{
+    MediaHealth health;
+    const auto  now = TimePoint{} + 10s;
+
+    EXPECT_TRUE(health.noteError(now, ENETDOWN, true));
+    EXPECT_FALSE(health.isUp());
+    EXPECT_FALSE(health.noteError(now, ENODEV, false));  // already down
+
+    // TX is skipped while down; any activity brings it back up.
+    health.noteTxSkipped();
+    health.noteRx(now + 1s);
+    EXPECT_TRUE(health.isUp());
+
+    const auto snapshot = health.snapshot();
+    EXPECT_THAT(snapshot.tx_skipped, 1);
+    EXPECT_THAT(snapshot.last_error, ENODEV);
+}
+
+TEST(TestMediaHealth, probes_back_off)
+{
+    MediaHealth health;
+    const auto  now = TimePoint{} + 10s;
+
+    EXPECT_TRUE(health.noteError(now, ENODEV, true));
+    EXPECT_THAT(health.nextProbeTime(), now + 100ms);
+    EXPECT_FALSE(health.isProbeDue(now + 99ms));
+    EXPECT_TRUE(health.isProbeDue(now + 100ms));
+
+    // Failed probes double the backoff - up to the limit.
+    health.noteProbe(now + 100ms, false);
+    EXPECT_THAT(health.nextProbeTime(), now + 300ms);
+    health.noteProbe(now + 300ms, false);
+    EXPECT_THAT(health.nextProbeTime(), now + 700ms);
+    for (int i = 0; i < 10; ++i)
+    {
+        health.noteProbe(now, false);
+    }
+    EXPECT_THAT(health.nextProbeTime(), now + 5s);
+    EXPECT_FALSE(health.isUp());
+
+    // Successful probe brings it up, and resets the backoff.
+    health.noteProbe(now + 5s, true);
+    EXPECT_TRUE(health.isUp());
+    EXPECT_THAT(health.snapshot().reopens, 1);
+
+    EXPECT_TRUE(health.noteError(now + 6s, ENETDOWN, false));
+    EXPECT_THAT(health.nextProbeTime(), now + 6s + 100ms);
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+}  // namespace
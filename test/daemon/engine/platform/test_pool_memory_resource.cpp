@@ -0,0 +1,147 @@
+//
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "platform/pool_memory_resource.hpp"
+
+#include "tracking_memory_resource.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+using namespace ocvsmd::daemon::engine::platform;  // NOLINT This our main concern here in the unit tests.
+
+using testing::IsEmpty;
+using testing::NotNull;
+using testing::SizeIs;
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+class TestPoolMemoryResource : public testing::Test
+{
+protected:
+    void TearDown() override
+    {
+        EXPECT_THAT(mr_.allocations, IsEmpty());
+        EXPECT_THAT(mr_.total_allocated_bytes, mr_.total_deallocated_bytes);
+    }
+
+    // MARK: Data members:
+
+    // NOLINTBEGIN
+    ocvsmd::TrackingMemoryResource mr_;
+    // NOLINTEND
+};
+
+// MARK: - Tests:
+
+TEST_F(TestPoolMemoryResource, steady_state_does_not_reach_upstream)
+{
+    PoolMemoryResource pool{mr_, {512, 64, 2048, 64, 0}, 4};
+    ASSERT_TRUE(pool.reserve(4));
+    EXPECT_THAT(pool.totalBlocks(), 3 * 4);
+    EXPECT_THAT(mr_.allocations, SizeIs(3));  // a chunk per class
+
+    const auto allocated_bytes = mr_.total_allocated_bytes;
+    for (int cycle = 0; cycle < 100; ++cycle)
+    {
+        std::array<void*, 6> blocks{pool.allocate(1),
+                                    pool.allocate(64),
+                                    pool.allocate(65),
+                                    pool.allocate(512),
+                                    pool.allocate(1500),
+                                    pool.allocate(2048)};
+        for (auto* const block : blocks)
+        {
+            ASSERT_THAT(block, NotNull());
+        }
+        EXPECT_THAT(pool.usedBlocks(), 6);
+
+        // Deallocation by a smaller size (than originally requested) is fine.
+        pool.deallocate(blocks[0], 1);
+        pool.deallocate(blocks[1], 1);
+        pool.deallocate(blocks[2], 65);
+        pool.deallocate(blocks[3], 100);
+        pool.deallocate(blocks[4], 1500);
+        pool.deallocate(blocks[5], 13);
+        EXPECT_THAT(pool.usedBlocks(), 0);
+    }
+    EXPECT_THAT(mr_.total_allocated_bytes, allocated_bytes);
+    EXPECT_THAT(mr_.allocations, SizeIs(3));
+}
+
+TEST_F(TestPoolMemoryResource, oversized_goes_upstream)
+{
+    PoolMemoryResource pool{mr_, {64}, 2};
+
+    void* const big = pool.allocate(65);
+    ASSERT_THAT(big, NotNull());
+    EXPECT_THAT(pool.usedBlocks(), 0);
+    EXPECT_THAT(pool.totalBlocks(), 0);
+    EXPECT_THAT(mr_.allocations, SizeIs(1));
+    EXPECT_THAT(mr_.allocations[0].size, 65);
+
+    pool.deallocate(big, 65);
+    EXPECT_THAT(mr_.allocations, IsEmpty());
+}
+
+TEST_F(TestPoolMemoryResource, deallocate_routes_by_owner_across_chunks)
+{
+    PoolMemoryResource pool{mr_, {64, 256, 1024}, 2};
+
+    // Interleave allocations of all classes (and oversized ones) - so that chunks of different classes
+    // (and upstream allocations) are mixed in the address space.
+    //
+    std::vector<std::pair<void*, std::size_t>> blocks;
+    for (std::size_t i = 0; i < 10; ++i)
+    {
+        for (const std::size_t size : {std::size_t{1}, std::size_t{100}, std::size_t{1000}, std::size_t{4000}})
+        {
+            void* const ptr = pool.allocate(size);
+            ASSERT_THAT(ptr, NotNull());
+            blocks.emplace_back(ptr, size);
+        }
+    }
+    EXPECT_THAT(pool.usedBlocks(), 3 * 10);
+    EXPECT_THAT(pool.totalBlocks(), 3 * 10);
+    EXPECT_THAT(mr_.allocations, SizeIs((3 * 5) + 10));  // 5 chunks per class + oversized ones
+
+    // Deallocate in a different (but deterministic) order, by sizes smaller than original.
+    //
+    std::reverse(blocks.begin(), blocks.end());
+    std::stable_partition(blocks.begin(), blocks.end(), [](const auto& block) { return block.second != 1000; });
+    for (const auto& block : blocks)
+    {
+        pool.deallocate(block.first, (block.second == 4000) ? block.second : 1);
+    }
+    EXPECT_THAT(pool.usedBlocks(), 0);
+    EXPECT_THAT(mr_.allocations, SizeIs(3 * 5));  // only chunks are left
+}
+
+TEST_F(TestPoolMemoryResource, no_classes)
+{
+    PoolMemoryResource pool{mr_, {}, 2};
+    EXPECT_TRUE(pool.reserve(10));
+    EXPECT_THAT(pool.totalBlocks(), 0);
+
+    void* const ptr = pool.allocate(1);
+    ASSERT_THAT(ptr, NotNull());
+    EXPECT_THAT(mr_.allocations, SizeIs(1));
+    pool.deallocate(ptr, 1);
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+}  // namespace
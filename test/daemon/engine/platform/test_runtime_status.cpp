@@ -0,0 +1,29 @@
+//
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "platform/runtime_status.hpp"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <sched.h>
+
+namespace
+{
+
+using ocvsmd::daemon::engine::platform::RuntimeStatus;
+
+TEST(TestRuntimeStatus, query)
+{
+    const auto status = RuntimeStatus::query();
+
+    EXPECT_THAT(status.sched_policy, ::sched_getscheduler(0));
+    EXPECT_THAT(status.minor_faults, testing::Gt(0U));
+#ifndef PLATFORM_OS_TYPE_BSD
+    EXPECT_THAT(status.cpu_affinity, testing::Not(testing::IsEmpty()));
+#endif
+}
+
+}  // namespace
@@ -0,0 +1,82 @@
+//
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "platform/socket_stats.hpp"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <limits>
+#include <memory>
+
+namespace
+{
+
+using namespace ocvsmd::daemon::engine::platform;  // NOLINT This our main concern here in the unit tests.
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+// MARK: - Tests:
+
+TEST(TestSocketStats, buffer_sizes_params)
+{
+    SocketBufferSizes sizes;
+    EXPECT_TRUE(sizes.parseParam("rcvbuf=1048576"));
+    EXPECT_TRUE(sizes.parseParam("sndbuf=4096"));
+    EXPECT_TRUE(sizes.parseParam("busy_poll=50"));
+    EXPECT_THAT(sizes.rcvbuf, 1048576);
+    EXPECT_THAT(sizes.sndbuf, 4096);
+    EXPECT_THAT(sizes.busy_poll, 50);
+
+    EXPECT_FALSE(sizes.parseParam("fd=1"));
+    EXPECT_FALSE(sizes.parseParam("rcvbuf"));
+    EXPECT_FALSE(sizes.parseParam("rcvbuf="));
+    EXPECT_FALSE(sizes.parseParam("sndbuf=1M"));
+    EXPECT_THAT(sizes.rcvbuf, 1048576);
+    EXPECT_THAT(sizes.sndbuf, 4096);
+}
+
+TEST(TestSocketStats, kernel_drops_wrap_around)
+{
+    SocketStats stats{"rx", true, 0, 0, 0};
+
+    EXPECT_THAT(stats.noteKernelDrops(0), 0);
+    EXPECT_THAT(stats.noteKernelDrops(5), 5);
+    EXPECT_THAT(stats.noteKernelDrops(5), 0);
+
+    const auto max_counter   = std::numeric_limits<std::uint32_t>::max();
+    stats.last_drops_counter = max_counter - 1;
+    EXPECT_THAT(stats.noteKernelDrops(2), 4);
+    EXPECT_THAT(stats.kernel_drops, 9);
+}
+
+TEST(TestSocketStats, registry)
+{
+    SocketStatsRegistry registry;
+    EXPECT_THAT(registry.size(), 0);
+
+    auto rx_entry = std::make_unique<SocketStatsRegistry::Entry>(registry, "239.0.0.1:9382", true);
+    {
+        SocketStatsRegistry::Entry tx_entry{registry, "tx", false};
+        tx_entry.stats().buffer_size = 4096;
+        rx_entry->stats().noteKernelDrops(3);
+
+        const auto snapshot = registry.snapshot();
+        ASSERT_THAT(snapshot.size(), 2);
+        EXPECT_THAT(snapshot[0].endpoint, "239.0.0.1:9382");
+        EXPECT_THAT(snapshot[0].kernel_drops, 3);
+        EXPECT_FALSE(snapshot[1].is_rx);
+        EXPECT_THAT(snapshot[1].buffer_size, 4096);
+    }
+    EXPECT_THAT(registry.size(), 1);
+
+    rx_entry.reset();
+    EXPECT_THAT(registry.snapshot().size(), 0);
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+}  // namespace
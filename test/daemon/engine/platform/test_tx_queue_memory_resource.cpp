@@ -0,0 +1,135 @@
+//
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "platform/tx_queue_memory_resource.hpp"
+
+#include "tracking_memory_resource.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <array>
+
+namespace
+{
+
+using namespace ocvsmd::daemon::engine::platform;  // NOLINT This our main concern here in the unit tests.
+
+using testing::IsEmpty;
+using testing::IsNull;
+using testing::NotNull;
+using testing::SizeIs;
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+class TestTxQueueMemoryResource : public testing::Test
+{
+protected:
+    void TearDown() override
+    {
+        EXPECT_THAT(mr_.allocations, IsEmpty());
+        EXPECT_THAT(mr_.total_allocated_bytes, mr_.total_deallocated_bytes);
+    }
+
+    // MARK: Data members:
+
+    // NOLINTBEGIN
+    ocvsmd::TrackingMemoryResource mr_;
+    // NOLINTEND
+};
+
+// MARK: - Tests:
+
+TEST_F(TestTxQueueMemoryResource, fixed_mode_only_tracks)
+{
+    TxQueueMemoryResource tx_mr{mr_};
+    tx_mr.configure(2, false, 0);
+
+    std::array<void*, 3> frames{};
+    for (auto& frame : frames)
+    {
+        frame = tx_mr.allocate(10);
+        ASSERT_THAT(frame, NotNull());
+    }
+    EXPECT_THAT(mr_.allocations, SizeIs(3));
+
+    auto stats = tx_mr.getStats();
+    EXPECT_FALSE(stats.is_adaptive);
+    EXPECT_THAT(stats.capacity, 2);
+    EXPECT_THAT(stats.depth, 3);
+    EXPECT_THAT(stats.bytes, 30);
+    EXPECT_THAT(stats.grows, 0);
+
+    tx_mr.deallocate(frames[0], 10);
+    tx_mr.deallocate(frames[1], 10);
+    tx_mr.noteOverflow();
+
+    stats = tx_mr.getStats();
+    EXPECT_THAT(stats.depth, 1);
+    EXPECT_THAT(stats.depth_hwm, 3);
+    EXPECT_THAT(stats.bytes, 10);
+    EXPECT_THAT(stats.bytes_hwm, 30);
+    EXPECT_THAT(stats.overflows, 1);
+
+    tx_mr.deallocate(frames[2], 10);
+}
+
+TEST_F(TestTxQueueMemoryResource, adaptive_mode_grows_and_resets)
+{
+    TxQueueMemoryResource tx_mr{mr_};
+    tx_mr.configure(2, true, 1000);
+
+    std::array<void*, 5> frames{};
+    for (auto& frame : frames)
+    {
+        frame = tx_mr.allocate(10);
+        ASSERT_THAT(frame, NotNull());
+    }
+
+    // 2 -> 4 -> 8
+    auto stats = tx_mr.getStats();
+    EXPECT_TRUE(stats.is_adaptive);
+    EXPECT_THAT(stats.capacity, 8);
+    EXPECT_THAT(stats.depth, 5);
+    EXPECT_THAT(stats.grows, 2);
+
+    // Drained queues are back to the base capacity.
+    for (auto* const frame : frames)
+    {
+        tx_mr.deallocate(frame, 10);
+    }
+    stats = tx_mr.getStats();
+    EXPECT_THAT(stats.capacity, 2);
+    EXPECT_THAT(stats.depth, 0);
+    EXPECT_THAT(stats.depth_hwm, 5);
+}
+
+TEST_F(TestTxQueueMemoryResource, adaptive_mode_respects_memory_cap)
+{
+    TxQueueMemoryResource tx_mr{mr_};
+    tx_mr.configure(1, true, 25);
+
+    void* const frame1 = tx_mr.allocate(10);
+    void* const frame2 = tx_mr.allocate(10);
+    ASSERT_THAT(frame1, NotNull());
+    ASSERT_THAT(frame2, NotNull());
+
+    EXPECT_THAT(tx_mr.allocate(10), IsNull());
+    EXPECT_THAT(mr_.allocations, SizeIs(2));
+
+    auto stats = tx_mr.getStats();
+    EXPECT_THAT(stats.depth, 2);
+    EXPECT_THAT(stats.bytes, 20);
+    EXPECT_THAT(stats.grows, 1);
+
+    tx_mr.deallocate(frame1, 10);
+    tx_mr.deallocate(frame2, 10);
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+}  // namespace
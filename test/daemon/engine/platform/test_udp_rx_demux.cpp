@@ -0,0 +1,276 @@
+//
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "platform/udp/udp_rx_demux.hpp"
+
+#include "ocvsmd/platform/linux/epoll_single_threaded_executor.hpp"
+#include "platform/fixed_block_memory_resource.hpp"
+#include "platform/media_health.hpp"
+#include "platform/socket_stats.hpp"
+#include "platform/udp/udp_sockets.hpp"
+#include "tracking_memory_resource.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+#include <libcyphal/errors.hpp>
+#include <libcyphal/transport/udp/tx_rx_sockets.hpp>
+#include <libcyphal/types.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <arpa/inet.h>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <vector>
+
+namespace
+{
+
+using namespace ocvsmd::daemon::engine::platform;  // NOLINT This our main concern here in the unit tests.
+
+using ocvsmd::platform::Linux::EpollSingleThreadedExecutor;
+using udp::UdpRxDemux;
+using udp::UdpRxSocket;
+using libcyphal::transport::udp::IRxSocket;
+
+using testing::Gt;
+using testing::Le;
+using testing::NotNull;
+using testing::ElementsAre;
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+class TestUdpRxDemux : public testing::Test
+{
+protected:
+    using RxSocketPtr = libcyphal::UniquePtr<IRxSocket>;
+
+    static constexpr std::uint16_t UdpPort       = 19382;
+    static constexpr std::uint32_t GroupA        = 0xEF000A01;
+    static constexpr std::uint32_t GroupB        = 0xEF000A02;
+    static constexpr std::size_t   BatchSize     = 16;
+    static constexpr std::size_t   QueueCapacity = 32;
+
+    void SetUp() override
+    {
+        tx_fd_ = ::socket(AF_INET, SOCK_DGRAM, 0);
+        ASSERT_THAT(tx_fd_, Gt(-1));
+
+        in_addr iface{};
+        iface.s_addr = htonl(INADDR_LOOPBACK);
+        ASSERT_THAT(::setsockopt(tx_fd_, IPPROTO_IP, IP_MULTICAST_IF, &iface, sizeof(iface)), 0);
+    }
+
+    void TearDown() override
+    {
+        if (tx_fd_ >= 0)
+        {
+            ::close(tx_fd_);
+        }
+        EXPECT_THAT(rx_mr_.usedBlocks(), 0);
+    }
+
+    UdpRxDemux::Ptr makeDemux(EpollSingleThreadedExecutor& executor)
+    {
+        return UdpRxDemux::make(executor, "127.0.0.1", UdpPort, rx_mr_, false, {}, health_, sockets_);
+    }
+
+    RxSocketPtr makeSocket(UdpRxDemux& demux, const std::uint32_t group)
+    {
+        auto  result    = demux.makeSocket(mr_, {group, UdpPort});
+        auto* rx_socket = cetl::get_if<RxSocketPtr>(&result);
+        return (rx_socket != nullptr) ? std::move(*rx_socket) : nullptr;
+    }
+
+    /// Sends (via loopback) a small datagram to the given group - its first byte is the given tag.
+    ///
+    void send(const std::uint32_t group, const std::uint8_t tag) const
+    {
+        const std::array<std::uint8_t, 8> payload{tag};
+
+        sockaddr_in addr{};
+        addr.sin_family      = AF_INET;
+        addr.sin_addr.s_addr = htonl(group);
+        addr.sin_port        = htons(UdpPort);
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        const auto* const dst_addr = reinterpret_cast<const sockaddr*>(&addr);
+        const auto        result   = ::sendto(tx_fd_, payload.data(), payload.size(), 0, dst_addr, sizeof(addr));
+        EXPECT_THAT(result, payload.size());
+    }
+
+    /// Spins the executor until the demux has read the given total number of datagrams (or it's timed out).
+    ///
+    void spinUntilRx(EpollSingleThreadedExecutor& executor, const std::uint64_t rx_frames) const
+    {
+        for (int attempt = 0; (attempt < 100) && (health_.snapshot().rx_frames < rx_frames); ++attempt)
+        {
+            pollAndSpin(executor);
+        }
+        // One more round - for the "notify" callbacks of demux sockets (and for anything unexpected).
+        pollAndSpin(executor);
+    }
+
+    static void pollAndSpin(EpollSingleThreadedExecutor& executor)
+    {
+        (void) executor.pollAwaitableResourcesFor(cetl::make_optional(std::chrono::milliseconds{1}));
+        (void) executor.spinOnce();
+    }
+
+    /// Registers libcyphal-like callback which drains the socket - collecting tags of received datagrams.
+    ///
+    static libcyphal::IExecutor::Callback::Any drainTo(IRxSocket& rx_socket, std::vector<std::uint8_t>& tags)
+    {
+        return rx_socket.registerCallback([&rx_socket, &tags](const auto&) {
+            //
+            auto        result  = rx_socket.receive();
+            auto* const success = cetl::get_if<IRxSocket::ReceiveResult::Success>(&result);
+            ASSERT_THAT(success, NotNull());
+            if (success->has_value())
+            {
+                const auto* const payload = (*success)->payload_ptr.get();
+                tags.push_back(static_cast<std::uint8_t>(payload[0]));
+            }
+        });
+    }
+
+    // NOLINTBEGIN
+    ocvsmd::TrackingMemoryResource mr_;
+    FixedBlockMemoryResource       rx_mr_{mr_, UdpRxSocket::BufferSize, 32};
+    MediaHealth                    health_;
+    SocketStatsRegistry            sockets_;
+    int                            tx_fd_{-1};
+    // NOLINTEND
+
+};  // TestUdpRxDemux
+
+// MARK: - Tests:
+
+TEST_F(TestUdpRxDemux, make_socket_joins_and_release_leaves)
+{
+    EpollSingleThreadedExecutor executor;
+    const auto                  demux = makeDemux(executor);
+    ASSERT_THAT(demux, NotNull());
+
+    auto rx_socket_a = makeSocket(*demux, GroupA);
+    if (!rx_socket_a)
+    {
+        GTEST_SKIP() << "Multicast on loopback is not available.";
+    }
+
+    // Only one socket per group.
+    auto result = demux->makeSocket(mr_, {GroupA, UdpPort});
+    EXPECT_THAT(cetl::get_if<libcyphal::ArgumentError>(&result), NotNull());
+
+    send(GroupA, 1);
+    spinUntilRx(executor, 1);
+    EXPECT_THAT(health_.snapshot().rx_frames, 1);
+
+    // Release of the socket leaves its group - so the shared socket doesn't even read its datagrams anymore.
+    // Datagrams are delivered in order - so once the one of B is read, the one of A would have been as well.
+    //
+    rx_socket_a.reset();
+    auto rx_socket_b = makeSocket(*demux, GroupB);
+    ASSERT_THAT(rx_socket_b, NotNull());
+
+    send(GroupA, 2);
+    send(GroupB, 3);
+    spinUntilRx(executor, 2);
+    EXPECT_THAT(health_.snapshot().rx_frames, 2);
+}
+
+TEST_F(TestUdpRxDemux, dispatch_by_group)
+{
+    EpollSingleThreadedExecutor executor;
+    const auto                  demux = makeDemux(executor);
+    ASSERT_THAT(demux, NotNull());
+
+    auto rx_socket_a = makeSocket(*demux, GroupA);
+    if (!rx_socket_a)
+    {
+        GTEST_SKIP() << "Multicast on loopback is not available.";
+    }
+    auto rx_socket_b = makeSocket(*demux, GroupB);
+    ASSERT_THAT(rx_socket_b, NotNull());
+
+    std::vector<std::uint8_t> tags_a;
+    std::vector<std::uint8_t> tags_b;
+    auto                      callback_a = drainTo(*rx_socket_a, tags_a);
+    auto                      callback_b = drainTo(*rx_socket_b, tags_b);
+
+    send(GroupA, 1);
+    send(GroupB, 2);
+    send(GroupA, 3);
+    spinUntilRx(executor, 3);
+    EXPECT_THAT(tags_a, ElementsAre(1, 3));
+    EXPECT_THAT(tags_b, ElementsAre(2));
+
+    // Received datagrams are freed by their new owners - at most the batch buffers of the demux are left.
+    EXPECT_THAT(rx_mr_.usedBlocks(), Le(BatchSize));
+
+    callback_a.reset();
+    callback_b.reset();
+}
+
+TEST_F(TestUdpRxDemux, unmatched_datagrams_are_dropped)
+{
+    EpollSingleThreadedExecutor executor;
+    const auto                  demux = makeDemux(executor);
+    ASSERT_THAT(demux, NotNull());
+
+    auto rx_socket_a = makeSocket(*demux, GroupA);
+    if (!rx_socket_a)
+    {
+        GTEST_SKIP() << "Multicast on loopback is not available.";
+    }
+
+    // The datagram is already in the shared socket when its group is left (and its demux socket is gone).
+    //
+    send(GroupA, 1);
+    rx_socket_a.reset();
+    spinUntilRx(executor, 1);
+    EXPECT_THAT(health_.snapshot().rx_frames, 1);
+
+    // The datagram is dropped - its buffer stays in the batch of the demux (for the next read).
+    EXPECT_THAT(rx_mr_.usedBlocks(), BatchSize);
+}
+
+TEST_F(TestUdpRxDemux, queue_overflow_is_dropped_and_freed_on_release)
+{
+    EpollSingleThreadedExecutor executor;
+    const auto                  demux = makeDemux(executor);
+    ASSERT_THAT(demux, NotNull());
+
+    auto rx_socket_a = makeSocket(*demux, GroupA);
+    if (!rx_socket_a)
+    {
+        GTEST_SKIP() << "Multicast on loopback is not available.";
+    }
+
+    // Nobody drains the socket - so its queue is full after `QueueCapacity` datagrams, and the rest is dropped.
+    //
+    constexpr std::size_t Total = QueueCapacity + 8;
+    for (std::size_t index = 0; index < Total; ++index)
+    {
+        send(GroupA, static_cast<std::uint8_t>(index));
+    }
+    spinUntilRx(executor, Total);
+    EXPECT_THAT(health_.snapshot().rx_frames, Total);
+
+    // Buffers of all queued (and never received) datagrams are freed by the socket destructor.
+    //
+    const auto used_blocks = rx_mr_.usedBlocks();
+    EXPECT_THAT(used_blocks, Gt(QueueCapacity));
+    rx_socket_a.reset();
+    EXPECT_THAT(used_blocks - rx_mr_.usedBlocks(), QueueCapacity);
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+}  // namespace
@@ -0,0 +1,220 @@
+//
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "platform/udp/udp_sockets.hpp"
+
+#include "ocvsmd/platform/linux/epoll_single_threaded_executor.hpp"
+#include "platform/media_health.hpp"
+#include "platform/socket_stats.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+#include <libcyphal/executor.hpp>
+#include <libcyphal/transport/udp/tx_rx_sockets.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <arpa/inet.h>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace
+{
+
+using namespace ocvsmd::daemon::engine::platform;  // NOLINT This our main concern here in the unit tests.
+
+using ocvsmd::platform::Linux::EpollSingleThreadedExecutor;
+using udp::UdpTxSocket;
+using libcyphal::transport::udp::ITxSocket;
+
+using testing::Gt;
+using testing::NotNull;
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+class TestUdpTxSocket : public testing::Test
+{
+protected:
+    using Payload = std::array<cetl::byte, 100>;
+
+    /// The UDP socket under test is emulated by a connected (loopback) TCP socket.
+    ///
+    /// Unlike UDP, its send buffer could be deterministically filled up (by not reading on the peer side),
+    /// so the "socket is not ready" path is reachable. The batch sending (`sendmmsg`) ignores destination
+    /// addresses of a connected stream socket, and counts a partially written datagram as sent.
+    ///
+    void SetUp() override
+    {
+        constexpr int SmallBuffer = 4096;
+
+        const int listen_fd = ::socket(AF_INET, SOCK_STREAM, 0);
+        ASSERT_THAT(listen_fd, Gt(-1));
+        (void) ::setsockopt(listen_fd, SOL_SOCKET, SO_RCVBUF, &SmallBuffer, sizeof(SmallBuffer));
+
+        sockaddr_in addr{};
+        addr.sin_family      = AF_INET;
+        addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        socklen_t addr_len   = sizeof(addr);
+        // NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast)
+        ASSERT_THAT(::bind(listen_fd, reinterpret_cast<sockaddr*>(&addr), addr_len), 0);
+        ASSERT_THAT(::getsockname(listen_fd, reinterpret_cast<sockaddr*>(&addr), &addr_len), 0);
+        ASSERT_THAT(::listen(listen_fd, 1), 0);
+
+        tx_fd_ = ::socket(AF_INET, SOCK_STREAM, 0);
+        ASSERT_THAT(tx_fd_, Gt(-1));
+        (void) ::setsockopt(tx_fd_, SOL_SOCKET, SO_SNDBUF, &SmallBuffer, sizeof(SmallBuffer));
+        ASSERT_THAT(::connect(tx_fd_, reinterpret_cast<sockaddr*>(&addr), addr_len), 0);
+        // NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
+
+        peer_fd_ = ::accept(listen_fd, nullptr, nullptr);
+        ASSERT_THAT(peer_fd_, Gt(-1));
+        ::close(listen_fd);
+    }
+
+    void TearDown() override
+    {
+        if (peer_fd_ >= 0)
+        {
+            ::close(peer_fd_);
+        }
+        // Note that `tx_fd_` is owned (and so closed) by the socket under test.
+    }
+
+    /// Fills the socket send buffer up - until the socket is not ready for sending.
+    ///
+    void fillUp() const
+    {
+        std::array<cetl::byte, 1024> filler{};
+        while (::send(tx_fd_, filler.data(), filler.size(), MSG_DONTWAIT) > 0)
+        {
+        }
+    }
+
+    /// Reads everything which has arrived so far - so the socket becomes ready for sending again.
+    ///
+    void drainPeer() const
+    {
+        std::array<cetl::byte, 4096> buffer{};
+        while (::recv(peer_fd_, buffer.data(), buffer.size(), MSG_DONTWAIT) > 0)
+        {
+        }
+    }
+
+    static void pollAndSpin(EpollSingleThreadedExecutor& executor)
+    {
+        EXPECT_FALSE(executor.pollAwaitableResourcesFor(cetl::make_optional(std::chrono::milliseconds{10})));
+        (void) executor.spinOnce();
+    }
+
+    static bool sendFrame(ITxSocket& tx_socket, const libcyphal::TimePoint deadline, const Payload& payload)
+    {
+        const std::array<libcyphal::transport::PayloadFragment, 1> fragments{{{payload.data(), payload.size()}}};
+
+        const auto  result  = tx_socket.send(deadline, {0xEF000001, 9382}, 0, fragments);
+        const auto* success = cetl::get_if<ITxSocket::SendResult::Success>(&result);
+        EXPECT_THAT(success, NotNull());
+        return (success != nullptr) && success->is_accepted;
+    }
+
+    // NOLINTBEGIN
+    int                 tx_fd_{-1};
+    int                 peer_fd_{-1};
+    MediaHealth         health_;
+    SocketStatsRegistry sockets_;
+    // NOLINTEND
+
+};  // TestUdpTxSocket
+
+// MARK: - Tests:
+
+TEST_F(TestUdpTxSocket, socket_full_and_staging_full)
+{
+    constexpr std::size_t StagingCapacity = 16;
+
+    EpollSingleThreadedExecutor executor;
+    UdpTxSocket                 udp_tx_socket{executor, UDPTxHandle{tx_fd_, 0}, 0, health_, sockets_};
+    auto&                       tx_socket = static_cast<ITxSocket&>(udp_tx_socket);
+
+    fillUp();
+
+    // Frames are staged while there is room for them, and refused after that - so libcyphal keeps them queued.
+    //
+    const Payload payload{};
+    const auto    deadline = executor.now() + std::chrono::seconds{10};
+    for (std::size_t index = 0; index < StagingCapacity; ++index)
+    {
+        EXPECT_TRUE(sendFrame(tx_socket, deadline, payload));
+    }
+    EXPECT_FALSE(sendFrame(tx_socket, deadline, payload));
+
+    pollAndSpin(executor);
+    EXPECT_THAT(health_.snapshot().tx_frames, 0);
+    EXPECT_THAT(health_.snapshot().tx_errors, 0);
+
+    // libcyphal has frames queued - so it waits for the socket writability.
+    //
+    std::size_t tx_calls    = 0;
+    auto        tx_callback = tx_socket.registerCallback([&tx_calls](const auto&) {
+        //
+        ++tx_calls;
+    });
+    ASSERT_TRUE(tx_callback.has_value());
+    pollAndSpin(executor);
+    EXPECT_THAT(tx_calls, 0);
+
+    // Once the socket is writable again, staged frames are sent, and libcyphal is called.
+    //
+    for (int attempt = 0; (attempt < 100) && ((tx_calls == 0) || (health_.snapshot().tx_frames < StagingCapacity));
+         ++attempt)
+    {
+        drainPeer();
+        pollAndSpin(executor);
+    }
+    EXPECT_THAT(tx_calls, Gt(0));
+    EXPECT_THAT(health_.snapshot().tx_frames, StagingCapacity);
+
+    // The libcyphal registration stays alive (there is no other writable registration of the same fd to clash with),
+    // so libcyphal keeps being called while it has something to send.
+    //
+    const auto prev_tx_calls = tx_calls;
+    drainPeer();
+    pollAndSpin(executor);
+    EXPECT_THAT(tx_calls, Gt(prev_tx_calls));
+
+    tx_callback.reset();
+}
+
+TEST_F(TestUdpTxSocket, staged_frames_expire)
+{
+    EpollSingleThreadedExecutor executor;
+    UdpTxSocket                 udp_tx_socket{executor, UDPTxHandle{tx_fd_, 0}, 0, health_, sockets_};
+    auto&                       tx_socket = static_cast<ITxSocket&>(udp_tx_socket);
+
+    fillUp();
+
+    const Payload payload{};
+    EXPECT_TRUE(sendFrame(tx_socket, executor.now() + std::chrono::milliseconds{20}, payload));
+    EXPECT_TRUE(sendFrame(tx_socket, executor.now() + std::chrono::seconds{10}, payload));
+    pollAndSpin(executor);
+
+    // Staged frames are retried by the timer (there is nothing queued by libcyphal) - but only until their deadlines.
+    //
+    ::usleep(30'000);
+    for (int attempt = 0; (attempt < 100) && (health_.snapshot().tx_frames == 0); ++attempt)
+    {
+        drainPeer();
+        pollAndSpin(executor);
+    }
+    EXPECT_THAT(health_.snapshot().tx_frames, 1);
+    EXPECT_THAT(health_.snapshot().tx_errors, 0);
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+}  // namespace
@@ -0,0 +1,67 @@
+//
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "ocvsmd/plugin/plugin.hpp"
+
+#include <cstdint>
+#include <cstring>
+
+// Could be overridden (by the build) to emulate a plugin built against an incompatible ABI.
+#ifndef STUB_PLUGIN_ABI_VERSION
+#    define STUB_PLUGIN_ABI_VERSION ocvsmd::plugin::AbiVersion
+#endif
+
+namespace
+{
+
+/// Defines a minimal plugin which just keeps its context (to verify that the context outlives the plugin).
+///
+class StubPlugin final : public ocvsmd::plugin::IPlugin
+{
+public:
+    explicit StubPlugin(const ocvsmd::plugin::Context& context)
+        : context_{context}
+    {
+    }
+
+    const char* name() const noexcept override
+    {
+        return context_.params;
+    }
+
+private:
+    const ocvsmd::plugin::Context& context_;
+
+};  // StubPlugin
+
+}  // namespace
+
+extern "C"
+{
+    // NOLINTBEGIN(*-owning-memory)
+
+    std::uint32_t ocvsmdPluginAbiVersion()
+    {
+        return STUB_PLUGIN_ABI_VERSION;
+    }
+
+    /// Creation fails if the plugin params are "fail".
+    ///
+    ocvsmd::plugin::IPlugin* ocvsmdPluginCreate(const ocvsmd::plugin::Context& context)
+    {
+        if (std::strcmp(context.params, "fail") == 0)
+        {
+            return nullptr;
+        }
+        return new StubPlugin{context};
+    }
+
+    void ocvsmdPluginDestroy(ocvsmd::plugin::IPlugin* const plugin)
+    {
+        delete plugin;
+    }
+
+    // NOLINTEND(*-owning-memory)
+}
@@ -0,0 +1,123 @@
+//
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "plugin/plugin_host.hpp"
+
+#include "config.hpp"
+#include "daemon/engine/cyphal/transport_mock.hpp"
+#include "tracking_memory_resource.hpp"
+#include "virtual_time_scheduler.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+#include <libcyphal/presentation/presentation.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <string>
+
+namespace
+{
+
+using ocvsmd::daemon::engine::Config;
+using ocvsmd::daemon::engine::plugin::PluginHost;
+
+using testing::StrEq;
+using testing::IsNull;
+using testing::IsEmpty;
+using testing::NiceMock;
+using testing::NotNull;
+
+class TestPluginHost : public testing::Test
+{
+protected:
+    using CyPresentation = libcyphal::presentation::Presentation;
+
+    void SetUp() override
+    {
+        cetl::pmr::set_default_resource(&mr_);
+    }
+
+    void TearDown() override
+    {
+        EXPECT_THAT(mr_.allocations, IsEmpty());
+        EXPECT_THAT(mr_.total_allocated_bytes, mr_.total_deallocated_bytes);
+    }
+
+    /// Makes a config with a single plugin entry.
+    ///
+    static Config::Ptr makeConfig(const std::string& path, const std::string& params)
+    {
+        const auto config_path = testing::TempDir() + "test_plugin_host.toml";
+        {
+            std::ofstream file{config_path};
+            file << "[[plugins]]\n";
+            file << "path = '" << path << "'\n";
+            file << "params = '" << params << "'\n";
+        }
+        return Config::make(config_path);
+    }
+
+    // NOLINTBEGIN
+    ocvsmd::TrackingMemoryResource                mr_;
+    ocvsmd::VirtualTimeScheduler                  scheduler_{};
+    NiceMock<libcyphal::transport::TransportMock> cy_transport_mock_;
+    // NOLINTEND
+
+};  // TestPluginHost
+
+// MARK: - Tests:
+
+TEST_F(TestPluginHost, load)
+{
+    CyPresentation cy_presentation{mr_, scheduler_, cy_transport_mock_};
+
+    // Long enough to be allocated on the heap (rather than inside of the string object).
+    const std::string params{"some params which are long enough to be on the heap"};
+
+    auto       config      = makeConfig(STUB_PLUGIN_PATH, params);
+    const auto plugin_host = PluginHost::make(mr_, scheduler_, cy_presentation, config);
+    ASSERT_THAT(plugin_host, NotNull());
+    EXPECT_THAT(plugin_host->count(), 1U);
+
+    // Params are freed together with the config entries, but the plugin still uses them
+    // (`StubPlugin::name` returns its params string straight from its context).
+    //
+    config.reset();
+    EXPECT_THAT(plugin_host->pluginName(0), StrEq(params));
+    EXPECT_THAT(plugin_host->pluginName(1), IsNull());
+}
+
+TEST_F(TestPluginHost, load_abi_mismatch)
+{
+    CyPresentation cy_presentation{mr_, scheduler_, cy_transport_mock_};
+
+    const auto plugin_host =
+        PluginHost::make(mr_, scheduler_, cy_presentation, makeConfig(STUB_PLUGIN_BAD_ABI_PATH, ""));
+    ASSERT_THAT(plugin_host, NotNull());
+    EXPECT_THAT(plugin_host->count(), 0U);
+}
+
+TEST_F(TestPluginHost, load_create_failure)
+{
+    CyPresentation cy_presentation{mr_, scheduler_, cy_transport_mock_};
+
+    const auto plugin_host = PluginHost::make(mr_, scheduler_, cy_presentation, makeConfig(STUB_PLUGIN_PATH, "fail"));
+    ASSERT_THAT(plugin_host, NotNull());
+    EXPECT_THAT(plugin_host->count(), 0U);
+}
+
+TEST_F(TestPluginHost, load_missing_file)
+{
+    CyPresentation cy_presentation{mr_, scheduler_, cy_transport_mock_};
+
+    const auto plugin_host =
+        PluginHost::make(mr_, scheduler_, cy_presentation, makeConfig("/non-existing/libplugin.so", ""));
+    ASSERT_THAT(plugin_host, NotNull());
+    EXPECT_THAT(plugin_host->count(), 0U);
+}
+
+}  // namespace
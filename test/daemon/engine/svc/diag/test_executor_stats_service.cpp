@@ -0,0 +1,251 @@
+//
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "svc/diag/executor_stats_service.hpp"
+
+#include "common/io/io_gtest_helpers.hpp"
+#include "common/ipc/gateway_mock.hpp"
+#include "common/ipc/server_router_mock.hpp"
+#include "daemon/engine/cyphal/transport_mock.hpp"
+#include "ipc/channel.hpp"
+#include "ocvsmd/platform/executor_profiler.hpp"
+#include "ocvsmd/sdk/defines.hpp"
+#include "svc/diag/executor_stats_spec.hpp"
+#include "svc/svc_helpers.hpp"
+#include "tracking_memory_resource.hpp"
+#include "virtual_time_scheduler.hpp"
+
+#include <cetl/cetl.hpp>
+#include <cetl/rtti.hpp>
+#include <libcyphal/platform/single_threaded_executor.hpp>
+#include <libcyphal/presentation/presentation.hpp>
+#include <libcyphal/transport/types.hpp>
+#include <libcyphal/types.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+using namespace ocvsmd::common;               // NOLINT This our main concern here in the unit tests.
+using namespace ocvsmd::daemon::engine::svc;  // NOLINT This our main concern here in the unit tests.
+using ocvsmd::platform::ExecutorProfiler;
+using ocvsmd::sdk::OptError;
+
+using testing::_;
+using testing::AllOf;
+using testing::Field;
+using testing::IsNull;
+using testing::Return;
+using testing::IsEmpty;
+using testing::NotNull;
+using testing::StrictMock;
+using testing::ElementsAreArray;
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+/// Emulates an executor with profiling support - the same way as the (linux only) epoll and io_uring executors do.
+///
+class ProfilingExecutor final : public libcyphal::platform::SingleThreadedExecutor, public ExecutorProfiler
+{
+public:
+    // MARK: - IExecutor
+
+    libcyphal::TimePoint now() const noexcept override
+    {
+        return {};
+    }
+
+    // MARK: - RTTI
+
+    CETL_NODISCARD void* _cast_(const cetl::type_id& id) & noexcept override
+    {
+        if (id == ExecutorProfiler::_get_type_id_())
+        {
+            return static_cast<ExecutorProfiler*>(this);
+        }
+        return Base::_cast_(id);
+    }
+    CETL_NODISCARD const void* _cast_(const cetl::type_id& id) const& noexcept override
+    {
+        if (id == ExecutorProfiler::_get_type_id_())
+        {
+            return static_cast<const ExecutorProfiler*>(this);
+        }
+        return Base::_cast_(id);
+    }
+
+private:
+    using Base = SingleThreadedExecutor;
+
+};  // ProfilingExecutor
+
+class TestExecutorStatsService : public testing::Test
+{
+protected:
+    using Spec        = svc::diag::ExecutorStatsSpec;
+    using GatewayMock = ipc::detail::GatewayMock;
+
+    using CyPresentation   = libcyphal::presentation::Presentation;
+    using CyProtocolParams = libcyphal::transport::ProtocolParams;
+
+    void SetUp() override
+    {
+        cetl::pmr::set_default_resource(&mr_);
+
+        EXPECT_CALL(cy_transport_mock_, getProtocolParams())
+            .WillRepeatedly(
+                Return(CyProtocolParams{std::numeric_limits<libcyphal::transport::TransferId>::max(), 0, 0}));
+    }
+
+    void TearDown() override
+    {
+        EXPECT_THAT(mr_.allocations, IsEmpty());
+        EXPECT_THAT(mr_.total_allocated_bytes, mr_.total_deallocated_bytes);
+    }
+
+    static std::vector<std::uint8_t> toBytes(const char* const name)
+    {
+        return {name, name + std::strlen(name)};
+    }
+
+    template <typename ChFactory>
+    void request(ChFactory& ch_factory, StrictMock<GatewayMock>& gateway_mock)
+    {
+        const Spec::Request request{&mr_};
+        const auto          result = tryPerformOnSerialized(request, [&](const auto payload) {
+            //
+            ch_factory(std::make_shared<GatewayMock::Wrapper>(gateway_mock), payload);
+            return OptError{};
+        });
+        EXPECT_THAT(result, OptError{});
+    }
+
+    // NOLINTBEGIN
+    ocvsmd::TrackingMemoryResource                  mr_;
+    ocvsmd::VirtualTimeScheduler                    scheduler_{};
+    StrictMock<libcyphal::transport::TransportMock> cy_transport_mock_;
+    StrictMock<ipc::ServerRouterMock>               ipc_router_mock_{mr_};
+    const std::string                               svc_name_{Spec::svc_full_name()};
+    const ipc::detail::ServiceDesc svc_desc_{ipc::AnyChannel::getServiceDesc<Spec::Request>(svc_name_)};
+    // NOLINTEND
+
+};  // TestExecutorStatsService
+
+// MARK: - Tests:
+
+TEST_F(TestExecutorStatsService, registerWithContext)
+{
+    CyPresentation   cy_presentation{mr_, scheduler_, cy_transport_mock_};
+    const ScvContext svc_context{mr_, scheduler_, ipc_router_mock_, cy_presentation};
+
+    EXPECT_THAT(ipc_router_mock_.getChannelFactory(svc_desc_), IsNull());
+
+    EXPECT_CALL(ipc_router_mock_, registerChannelFactoryByName(svc_name_)).WillOnce(Return());
+    diag::ExecutorStatsService::registerWithContext(svc_context);
+
+    EXPECT_THAT(ipc_router_mock_.getChannelFactory(svc_desc_), NotNull());
+}
+
+TEST_F(TestExecutorStatsService, request_without_profiler)
+{
+    CyPresentation   cy_presentation{mr_, scheduler_, cy_transport_mock_};
+    const ScvContext svc_context{mr_, scheduler_, ipc_router_mock_, cy_presentation};
+
+    EXPECT_CALL(ipc_router_mock_, registerChannelFactoryByName(_)).WillOnce(Return());
+    diag::ExecutorStatsService::registerWithContext(svc_context);
+
+    auto* const ch_factory = ipc_router_mock_.getChannelFactory(svc_desc_);
+    ASSERT_THAT(ch_factory, NotNull());
+
+    StrictMock<GatewayMock> gateway_mock;
+
+    // The virtual time scheduler doesn't profile its callbacks - so the channel is just completed.
+    {
+        const testing::InSequence seq;
+        EXPECT_CALL(gateway_mock, complete(OptError{}, false)).WillOnce(Return(OptError{}));
+        EXPECT_CALL(gateway_mock, deinit()).Times(1);
+    }
+    request(*ch_factory, gateway_mock);
+}
+
+TEST_F(TestExecutorStatsService, request_with_profiler)
+{
+    using Category = ExecutorProfiler::Category;
+
+    ProfilingExecutor executor;
+    executor.setCallbackBudget(std::chrono::microseconds{5});
+    executor.recordCallback(Category::UdpRx, std::chrono::microseconds{10});
+    executor.recordSpin(std::chrono::microseconds{7}, std::chrono::microseconds{100});
+
+    CyPresentation   cy_presentation{mr_, scheduler_, cy_transport_mock_};
+    const ScvContext svc_context{mr_, executor, ipc_router_mock_, cy_presentation};
+
+    EXPECT_CALL(ipc_router_mock_, registerChannelFactoryByName(_)).WillOnce(Return());
+    diag::ExecutorStatsService::registerWithContext(svc_context);
+
+    auto* const ch_factory = ipc_router_mock_.getChannelFactory(svc_desc_);
+    ASSERT_THAT(ch_factory, NotNull());
+
+    StrictMock<GatewayMock> gateway_mock;
+
+    // A report per each callback category, then the loop spins, and then their lateness.
+    {
+        const testing::InSequence seq;
+        for (std::size_t index = 0; index < ExecutorProfiler::categoriesCount(); ++index)
+        {
+            const auto          category = static_cast<Category>(index);
+            const std::uint64_t count    = (category == Category::UdpRx) ? 1 : 0;
+            const auto          name     = toBytes(ExecutorProfiler::categoryName(category));
+            EXPECT_CALL(gateway_mock,
+                        send(_,
+                             io::PayloadWith<Spec::Response>(  //
+                                 mr_,
+                                 AllOf(Field(&Spec::Response::kind, Spec::Response::KIND_CALLBACK),
+                                       Field(&Spec::Response::name, ElementsAreArray(name)),
+                                       Field(&Spec::Response::count, count),
+                                       Field(&Spec::Response::total_ns, count * 10'000U),
+                                       Field(&Spec::Response::over_budget, count),
+                                       Field(&Spec::Response::budget_ns, 5'000U)))))
+                .WillOnce(Return(OptError{}));
+        }
+        EXPECT_CALL(gateway_mock,
+                    send(_,
+                         io::PayloadWith<Spec::Response>(  //
+                             mr_,
+                             AllOf(Field(&Spec::Response::kind, Spec::Response::KIND_SPIN),
+                                   Field(&Spec::Response::name, ElementsAreArray(toBytes("spin"))),
+                                   Field(&Spec::Response::count, 1U),
+                                   Field(&Spec::Response::total_ns, 7'000U)))))
+            .WillOnce(Return(OptError{}));
+        EXPECT_CALL(gateway_mock,
+                    send(_,
+                         io::PayloadWith<Spec::Response>(  //
+                             mr_,
+                             AllOf(Field(&Spec::Response::kind, Spec::Response::KIND_LATENESS),
+                                   Field(&Spec::Response::name, ElementsAreArray(toBytes("lateness"))),
+                                   Field(&Spec::Response::count, 1U),
+                                   Field(&Spec::Response::max_ns, 100'000U),
+                                   Field(&Spec::Response::budget_ns, 0U)))))
+            .WillOnce(Return(OptError{}));
+        EXPECT_CALL(gateway_mock, complete(OptError{}, false)).WillOnce(Return(OptError{}));
+        EXPECT_CALL(gateway_mock, deinit()).Times(1);
+    }
+    request(*ch_factory, gateway_mock);
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+}  // namespace
@@ -0,0 +1,258 @@
+//
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "svc/diag/media_health_service.hpp"
+
+#include "common/io/io_gtest_helpers.hpp"
+#include "common/ipc/gateway_mock.hpp"
+#include "common/ipc/server_router_mock.hpp"
+#include "daemon/engine/cyphal/any_transport_bag_mock.hpp"
+#include "daemon/engine/cyphal/transport_mock.hpp"
+#include "ipc/channel.hpp"
+#include "ocvsmd/sdk/defines.hpp"
+#include "platform/media_health.hpp"
+#include "svc/diag/media_health_spec.hpp"
+#include "svc/svc_helpers.hpp"
+#include "tracking_memory_resource.hpp"
+#include "virtual_time_scheduler.hpp"
+
+#include <libcyphal/presentation/presentation.hpp>
+#include <libcyphal/transport/types.hpp>
+#include <libcyphal/types.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+using namespace ocvsmd::common;               // NOLINT This our main concern here in the unit tests.
+using namespace ocvsmd::daemon::engine::svc;  // NOLINT This our main concern here in the unit tests.
+using ocvsmd::daemon::engine::cyphal::AnyTransportBagMock;
+using ocvsmd::daemon::engine::platform::MediaHealthReport;
+using ocvsmd::sdk::OptError;
+
+using testing::_;
+using testing::IsNull;
+using testing::Return;
+using testing::IsEmpty;
+using testing::NotNull;
+using testing::StrictMock;
+
+// https://github.com/llvm/llvm-project/issues/53444
+// NOLINTBEGIN(misc-unused-using-decls, misc-include-cleaner)
+using std::literals::chrono_literals::operator""s;
+// NOLINTEND(misc-unused-using-decls, misc-include-cleaner)
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+class TestMediaHealthService : public testing::Test
+{
+protected:
+    using Spec        = svc::diag::MediaHealthSpec;
+    using GatewayMock = ipc::detail::GatewayMock;
+
+    using CyPresentation   = libcyphal::presentation::Presentation;
+    using CyProtocolParams = libcyphal::transport::ProtocolParams;
+
+    void SetUp() override
+    {
+        cetl::pmr::set_default_resource(&mr_);
+
+        EXPECT_CALL(cy_transport_mock_, getProtocolParams())
+            .WillRepeatedly(
+                Return(CyProtocolParams{std::numeric_limits<libcyphal::transport::TransferId>::max(), 0, 0}));
+    }
+
+    void TearDown() override
+    {
+        EXPECT_THAT(mr_.allocations, IsEmpty());
+        EXPECT_THAT(mr_.total_allocated_bytes, mr_.total_deallocated_bytes);
+    }
+
+    static MediaHealthReport makeReport(const std::string& iface_address, const std::uint64_t rx_frames)
+    {
+        MediaHealthReport report{iface_address, {}};
+        report.health.is_up      = true;
+        report.health.rx_frames  = rx_frames;
+        report.health.tx_frames  = 7;
+        report.health.tx_errors  = 1;
+        report.health.last_error = 105;
+        if (rx_frames > 0)
+        {
+            report.health.last_rx_time = libcyphal::TimePoint{} + 1s;
+        }
+        return report;
+    }
+
+    Spec::Response makeResponse(const std::uint8_t       transport,
+                                const std::uint8_t       media_index,
+                                const MediaHealthReport& report,
+                                const std::uint64_t      last_rx_age_us)
+    {
+        Spec::Response response{&mr_};
+        response.transport   = transport;
+        response.media_index = media_index;
+        std::copy(report.iface_address.cbegin(),
+                  report.iface_address.cend(),
+                  std::back_inserter(response.iface_address));
+        response.is_up          = report.health.is_up;
+        response.rx_frames      = report.health.rx_frames;
+        response.tx_frames      = report.health.tx_frames;
+        response.tx_errors      = report.health.tx_errors;
+        response.last_errno     = report.health.last_error;
+        response.last_rx_age_us = last_rx_age_us;
+        return response;
+    }
+
+    template <typename ChFactory>
+    void request(ChFactory& ch_factory, StrictMock<GatewayMock>& gateway_mock)
+    {
+        const Spec::Request request{&mr_};
+        const auto          result = tryPerformOnSerialized(request, [&](const auto payload) {
+            //
+            ch_factory(std::make_shared<GatewayMock::Wrapper>(gateway_mock), payload);
+            return OptError{};
+        });
+        EXPECT_THAT(result, OptError{});
+    }
+
+    // NOLINTBEGIN
+    ocvsmd::TrackingMemoryResource                  mr_;
+    ocvsmd::VirtualTimeScheduler                    scheduler_{};
+    StrictMock<libcyphal::transport::TransportMock> cy_transport_mock_;
+    StrictMock<ipc::ServerRouterMock>               ipc_router_mock_{mr_};
+    StrictMock<AnyTransportBagMock>                 transport_bag_mock_;
+    StrictMock<AnyTransportBagMock>                 bridge_transport_bag_mock_;
+    const std::string                               svc_name_{Spec::svc_full_name()};
+    const ipc::detail::ServiceDesc svc_desc_{ipc::AnyChannel::getServiceDesc<Spec::Request>(svc_name_)};
+    // NOLINTEND
+
+};  // TestMediaHealthService
+
+// MARK: - Tests:
+
+TEST_F(TestMediaHealthService, registerWithContext)
+{
+    CyPresentation   cy_presentation{mr_, scheduler_, cy_transport_mock_};
+    const ScvContext svc_context{mr_, scheduler_, ipc_router_mock_, cy_presentation};
+
+    EXPECT_THAT(ipc_router_mock_.getChannelFactory(svc_desc_), IsNull());
+
+    EXPECT_CALL(ipc_router_mock_, registerChannelFactoryByName(svc_name_)).WillOnce(Return());
+    diag::MediaHealthService::registerWithContext(svc_context, transport_bag_mock_, nullptr);
+
+    EXPECT_THAT(ipc_router_mock_.getChannelFactory(svc_desc_), NotNull());
+}
+
+TEST_F(TestMediaHealthService, request_primary_only)
+{
+    CyPresentation   cy_presentation{mr_, scheduler_, cy_transport_mock_};
+    const ScvContext svc_context{mr_, scheduler_, ipc_router_mock_, cy_presentation};
+
+    EXPECT_CALL(ipc_router_mock_, registerChannelFactoryByName(_)).WillOnce(Return());
+    diag::MediaHealthService::registerWithContext(svc_context, transport_bag_mock_, nullptr);
+
+    auto* const ch_factory = ipc_router_mock_.getChannelFactory(svc_desc_);
+    ASSERT_THAT(ch_factory, NotNull());
+
+    StrictMock<GatewayMock> gateway_mock;
+
+    scheduler_.scheduleAt(3s, [&](const auto&) {
+        //
+        const std::vector<MediaHealthReport> reports{makeReport("127.0.0.1", 3), makeReport("192.168.1.2", 0)};
+        EXPECT_CALL(transport_bag_mock_, getMediaHealthReports()).WillOnce(Return(reports));
+
+        // The first media has received its last frame 2s ago (at 1s), the second one - never.
+        const auto res_0 = makeResponse(Spec::Response::TRANSPORT_PRIMARY, 0, reports[0], 2'000'000);
+        const auto res_1 = makeResponse(Spec::Response::TRANSPORT_PRIMARY, 1, reports[1], Spec::Response::NEVER);
+        {
+            const testing::InSequence seq;
+            EXPECT_CALL(gateway_mock, send(_, io::PayloadWith<Spec::Response>(mr_, res_0)))
+                .WillOnce(Return(OptError{}));
+            EXPECT_CALL(gateway_mock, send(_, io::PayloadWith<Spec::Response>(mr_, res_1)))
+                .WillOnce(Return(OptError{}));
+            EXPECT_CALL(gateway_mock, complete(OptError{}, false)).WillOnce(Return(OptError{}));
+            EXPECT_CALL(gateway_mock, deinit()).Times(1);
+        }
+        request(*ch_factory, gateway_mock);
+    });
+    scheduler_.spinFor(10s);
+}
+
+TEST_F(TestMediaHealthService, request_with_bridge)
+{
+    CyPresentation   cy_presentation{mr_, scheduler_, cy_transport_mock_};
+    const ScvContext svc_context{mr_, scheduler_, ipc_router_mock_, cy_presentation};
+
+    EXPECT_CALL(ipc_router_mock_, registerChannelFactoryByName(_)).WillOnce(Return());
+    diag::MediaHealthService::registerWithContext(svc_context, transport_bag_mock_, &bridge_transport_bag_mock_);
+
+    auto* const ch_factory = ipc_router_mock_.getChannelFactory(svc_desc_);
+    ASSERT_THAT(ch_factory, NotNull());
+
+    StrictMock<GatewayMock> gateway_mock;
+
+    const std::vector<MediaHealthReport> reports{makeReport("127.0.0.1", 0)};
+    const std::vector<MediaHealthReport> bridge_reports{makeReport("vcan0", 0)};
+    EXPECT_CALL(transport_bag_mock_, getMediaHealthReports()).WillOnce(Return(reports));
+    EXPECT_CALL(bridge_transport_bag_mock_, getMediaHealthReports()).WillOnce(Return(bridge_reports));
+
+    // Media of the bridge transport are reported after the primary ones - with their own media indices.
+    const auto res_0 = makeResponse(Spec::Response::TRANSPORT_PRIMARY, 0, reports[0], Spec::Response::NEVER);
+    const auto res_1 = makeResponse(Spec::Response::TRANSPORT_BRIDGE, 0, bridge_reports[0], Spec::Response::NEVER);
+    {
+        const testing::InSequence seq;
+        EXPECT_CALL(gateway_mock, send(_, io::PayloadWith<Spec::Response>(mr_, res_0))).WillOnce(Return(OptError{}));
+        EXPECT_CALL(gateway_mock, send(_, io::PayloadWith<Spec::Response>(mr_, res_1))).WillOnce(Return(OptError{}));
+        EXPECT_CALL(gateway_mock, complete(OptError{}, false)).WillOnce(Return(OptError{}));
+        EXPECT_CALL(gateway_mock, deinit()).Times(1);
+    }
+    request(*ch_factory, gateway_mock);
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+}  // namespace
+
+namespace ocvsmd
+{
+namespace common
+{
+namespace svc
+{
+namespace diag
+{
+namespace MediaHealth
+{
+static void PrintTo(const Response_0_1& res, std::ostream* os)  // NOLINT
+{
+    *os << "MediaHealth::Response_0_1{transport=" << +res.transport << ", media_index=" << +res.media_index
+        << ", rx_frames=" << res.rx_frames << ", last_rx_age_us=" << res.last_rx_age_us << "}";
+}
+static bool operator==(const Response_0_1& lhs, const Response_0_1& rhs)  // NOLINT
+{
+    return (lhs.transport == rhs.transport) && (lhs.media_index == rhs.media_index) &&
+           (lhs.iface_address == rhs.iface_address) && (lhs.is_up == rhs.is_up) &&
+           (lhs.rx_frames == rhs.rx_frames) && (lhs.tx_frames == rhs.tx_frames) &&
+           (lhs.rx_errors == rhs.rx_errors) && (lhs.tx_errors == rhs.tx_errors) &&
+           (lhs.tx_skipped == rhs.tx_skipped) && (lhs.reopens == rhs.reopens) &&
+           (lhs.last_errno == rhs.last_errno) && (lhs.last_rx_age_us == rhs.last_rx_age_us) &&
+           (lhs.rx_kernel_drops == rhs.rx_kernel_drops);
+}
+}  // namespace MediaHealth
+}  // namespace diag
+}  // namespace svc
+}  // namespace common
+}  // namespace ocvsmd
@@ -0,0 +1,150 @@
+//
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "svc/diag/runtime_service.hpp"
+
+#include "common/io/io_gtest_helpers.hpp"
+#include "common/ipc/gateway_mock.hpp"
+#include "common/ipc/server_router_mock.hpp"
+#include "daemon/engine/cyphal/transport_mock.hpp"
+#include "ipc/channel.hpp"
+#include "ocvsmd/sdk/defines.hpp"
+#include "platform/runtime_status.hpp"
+#include "svc/diag/runtime_spec.hpp"
+#include "svc/svc_helpers.hpp"
+#include "tracking_memory_resource.hpp"
+#include "virtual_time_scheduler.hpp"
+
+#include <libcyphal/presentation/presentation.hpp>
+#include <libcyphal/transport/types.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <sched.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <string>
+
+namespace
+{
+
+using namespace ocvsmd::common;               // NOLINT This our main concern here in the unit tests.
+using namespace ocvsmd::daemon::engine::svc;  // NOLINT This our main concern here in the unit tests.
+using ocvsmd::daemon::engine::platform::RuntimeStatus;
+using ocvsmd::sdk::OptError;
+
+using testing::_;
+using testing::Gt;
+using testing::AllOf;
+using testing::Field;
+using testing::IsNull;
+using testing::Return;
+using testing::SizeIs;
+using testing::IsEmpty;
+using testing::NotNull;
+using testing::StrictMock;
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+class TestRuntimeService : public testing::Test
+{
+protected:
+    using Spec        = svc::diag::RuntimeSpec;
+    using GatewayMock = ipc::detail::GatewayMock;
+
+    using CyPresentation   = libcyphal::presentation::Presentation;
+    using CyProtocolParams = libcyphal::transport::ProtocolParams;
+
+    void SetUp() override
+    {
+        cetl::pmr::set_default_resource(&mr_);
+
+        EXPECT_CALL(cy_transport_mock_, getProtocolParams())
+            .WillRepeatedly(
+                Return(CyProtocolParams{std::numeric_limits<libcyphal::transport::TransferId>::max(), 0, 0}));
+    }
+
+    void TearDown() override
+    {
+        EXPECT_THAT(mr_.allocations, IsEmpty());
+        EXPECT_THAT(mr_.total_allocated_bytes, mr_.total_deallocated_bytes);
+    }
+
+    // NOLINTBEGIN
+    ocvsmd::TrackingMemoryResource                  mr_;
+    ocvsmd::VirtualTimeScheduler                    scheduler_{};
+    StrictMock<libcyphal::transport::TransportMock> cy_transport_mock_;
+    StrictMock<ipc::ServerRouterMock>               ipc_router_mock_{mr_};
+    const std::string                               svc_name_{Spec::svc_full_name()};
+    const ipc::detail::ServiceDesc svc_desc_{ipc::AnyChannel::getServiceDesc<Spec::Request>(svc_name_)};
+    // NOLINTEND
+
+};  // TestRuntimeService
+
+// MARK: - Tests:
+
+TEST_F(TestRuntimeService, registerWithContext)
+{
+    CyPresentation   cy_presentation{mr_, scheduler_, cy_transport_mock_};
+    const ScvContext svc_context{mr_, scheduler_, ipc_router_mock_, cy_presentation};
+
+    EXPECT_THAT(ipc_router_mock_.getChannelFactory(svc_desc_), IsNull());
+
+    EXPECT_CALL(ipc_router_mock_, registerChannelFactoryByName(svc_name_)).WillOnce(Return());
+    diag::RuntimeService::registerWithContext(svc_context);
+
+    EXPECT_THAT(ipc_router_mock_.getChannelFactory(svc_desc_), NotNull());
+}
+
+TEST_F(TestRuntimeService, request)
+{
+    CyPresentation   cy_presentation{mr_, scheduler_, cy_transport_mock_};
+    const ScvContext svc_context{mr_, scheduler_, ipc_router_mock_, cy_presentation};
+
+    EXPECT_CALL(ipc_router_mock_, registerChannelFactoryByName(_)).WillOnce(Return());
+    diag::RuntimeService::registerWithContext(svc_context);
+
+    auto* const ch_factory = ipc_router_mock_.getChannelFactory(svc_desc_);
+    ASSERT_THAT(ch_factory, NotNull());
+
+    StrictMock<GatewayMock> gateway_mock;
+
+    // The test runs under the default (time-sharing) policy; the faults counters are live - so they are just
+    // expected to be non-zero.
+    const auto        status   = RuntimeStatus::query();
+    const std::size_t max_cpus = Spec::Response::_traits_::ArrayCapacity::cpu_affinity;
+    ASSERT_THAT(status.sched_policy, SCHED_OTHER);
+    {
+        const testing::InSequence seq;
+        EXPECT_CALL(gateway_mock,
+                    send(_,
+                         io::PayloadWith<Spec::Response>(  //
+                             mr_,
+                             AllOf(Field(&Spec::Response::sched_policy, Spec::Response::POLICY_OTHER),
+                                   Field(&Spec::Response::sched_priority, status.sched_priority),
+                                   Field(&Spec::Response::cpu_affinity,
+                                         SizeIs(std::min(status.cpu_affinity.size(), max_cpus))),
+                                   Field(&Spec::Response::minor_faults, Gt(0U))))))
+            .WillOnce(Return(OptError{}));
+        EXPECT_CALL(gateway_mock, complete(OptError{}, false)).WillOnce(Return(OptError{}));
+        EXPECT_CALL(gateway_mock, deinit()).Times(1);
+    }
+
+    const Spec::Request request{&mr_};
+    const auto          result = tryPerformOnSerialized(request, [&](const auto payload) {
+        //
+        (*ch_factory)(std::make_shared<GatewayMock::Wrapper>(gateway_mock), payload);
+        return OptError{};
+    });
+    EXPECT_THAT(result, OptError{});
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+}  // namespace
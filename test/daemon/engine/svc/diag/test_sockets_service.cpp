@@ -0,0 +1,232 @@
+//
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "svc/diag/sockets_service.hpp"
+
+#include "common/io/io_gtest_helpers.hpp"
+#include "common/ipc/gateway_mock.hpp"
+#include "common/ipc/server_router_mock.hpp"
+#include "daemon/engine/cyphal/any_transport_bag_mock.hpp"
+#include "daemon/engine/cyphal/transport_mock.hpp"
+#include "ipc/channel.hpp"
+#include "ocvsmd/sdk/defines.hpp"
+#include "platform/socket_stats.hpp"
+#include "svc/diag/sockets_spec.hpp"
+#include "svc/svc_helpers.hpp"
+#include "tracking_memory_resource.hpp"
+#include "virtual_time_scheduler.hpp"
+
+#include <libcyphal/presentation/presentation.hpp>
+#include <libcyphal/transport/types.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+using namespace ocvsmd::common;               // NOLINT This our main concern here in the unit tests.
+using namespace ocvsmd::daemon::engine::svc;  // NOLINT This our main concern here in the unit tests.
+using ocvsmd::daemon::engine::cyphal::AnyTransportBagMock;
+using ocvsmd::daemon::engine::platform::MediaSocketsReport;
+using ocvsmd::daemon::engine::platform::SocketStats;
+using ocvsmd::sdk::OptError;
+
+using testing::_;
+using testing::IsNull;
+using testing::Return;
+using testing::IsEmpty;
+using testing::NotNull;
+using testing::StrictMock;
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+class TestSocketsService : public testing::Test
+{
+protected:
+    using Spec        = svc::diag::SocketsSpec;
+    using GatewayMock = ipc::detail::GatewayMock;
+
+    using CyPresentation   = libcyphal::presentation::Presentation;
+    using CyProtocolParams = libcyphal::transport::ProtocolParams;
+
+    void SetUp() override
+    {
+        cetl::pmr::set_default_resource(&mr_);
+
+        EXPECT_CALL(cy_transport_mock_, getProtocolParams())
+            .WillRepeatedly(
+                Return(CyProtocolParams{std::numeric_limits<libcyphal::transport::TransferId>::max(), 0, 0}));
+    }
+
+    void TearDown() override
+    {
+        EXPECT_THAT(mr_.allocations, IsEmpty());
+        EXPECT_THAT(mr_.total_allocated_bytes, mr_.total_deallocated_bytes);
+    }
+
+    Spec::Response makeResponse(const std::uint8_t        transport,
+                                const std::uint8_t        media_index,
+                                const MediaSocketsReport& report,
+                                const SocketStats&        socket)
+    {
+        Spec::Response response{&mr_};
+        response.transport   = transport;
+        response.media_index = media_index;
+        std::copy(report.iface_address.cbegin(),
+                  report.iface_address.cend(),
+                  std::back_inserter(response.iface_address));
+        std::copy(socket.endpoint.cbegin(), socket.endpoint.cend(), std::back_inserter(response.endpoint));
+        response.is_rx        = socket.is_rx;
+        response.buffer_size  = static_cast<std::uint32_t>(socket.buffer_size);
+        response.kernel_drops = socket.kernel_drops;
+        return response;
+    }
+
+    template <typename ChFactory>
+    void request(ChFactory& ch_factory, StrictMock<GatewayMock>& gateway_mock)
+    {
+        const Spec::Request request{&mr_};
+        const auto          result = tryPerformOnSerialized(request, [&](const auto payload) {
+            //
+            ch_factory(std::make_shared<GatewayMock::Wrapper>(gateway_mock), payload);
+            return OptError{};
+        });
+        EXPECT_THAT(result, OptError{});
+    }
+
+    // NOLINTBEGIN
+    ocvsmd::TrackingMemoryResource                  mr_;
+    ocvsmd::VirtualTimeScheduler                    scheduler_{};
+    StrictMock<libcyphal::transport::TransportMock> cy_transport_mock_;
+    StrictMock<ipc::ServerRouterMock>               ipc_router_mock_{mr_};
+    StrictMock<AnyTransportBagMock>                 transport_bag_mock_;
+    StrictMock<AnyTransportBagMock>                 bridge_transport_bag_mock_;
+    const std::string                               svc_name_{Spec::svc_full_name()};
+    const ipc::detail::ServiceDesc svc_desc_{ipc::AnyChannel::getServiceDesc<Spec::Request>(svc_name_)};
+    // NOLINTEND
+
+};  // TestSocketsService
+
+// MARK: - Tests:
+
+TEST_F(TestSocketsService, registerWithContext)
+{
+    CyPresentation   cy_presentation{mr_, scheduler_, cy_transport_mock_};
+    const ScvContext svc_context{mr_, scheduler_, ipc_router_mock_, cy_presentation};
+
+    EXPECT_THAT(ipc_router_mock_.getChannelFactory(svc_desc_), IsNull());
+
+    EXPECT_CALL(ipc_router_mock_, registerChannelFactoryByName(svc_name_)).WillOnce(Return());
+    diag::SocketsService::registerWithContext(svc_context, transport_bag_mock_, nullptr);
+
+    EXPECT_THAT(ipc_router_mock_.getChannelFactory(svc_desc_), NotNull());
+}
+
+TEST_F(TestSocketsService, request_primary_only)
+{
+    CyPresentation   cy_presentation{mr_, scheduler_, cy_transport_mock_};
+    const ScvContext svc_context{mr_, scheduler_, ipc_router_mock_, cy_presentation};
+
+    EXPECT_CALL(ipc_router_mock_, registerChannelFactoryByName(_)).WillOnce(Return());
+    diag::SocketsService::registerWithContext(svc_context, transport_bag_mock_, nullptr);
+
+    auto* const ch_factory = ipc_router_mock_.getChannelFactory(svc_desc_);
+    ASSERT_THAT(ch_factory, NotNull());
+
+    StrictMock<GatewayMock> gateway_mock;
+
+    // The second media has no live sockets (f.e. it's down) - so nothing is reported for it.
+    const std::vector<MediaSocketsReport> reports{
+        {"127.0.0.1", {{"tx", false, 212992, 0, 0}, {"239.0.0.1:9382", true, 425984, 17, 17}}},
+        {"192.168.1.2", {}},
+    };
+    EXPECT_CALL(transport_bag_mock_, getMediaSocketsReports()).WillOnce(Return(reports));
+
+    const auto res_tx = makeResponse(Spec::Response::TRANSPORT_PRIMARY, 0, reports[0], reports[0].sockets[0]);
+    const auto res_rx = makeResponse(Spec::Response::TRANSPORT_PRIMARY, 0, reports[0], reports[0].sockets[1]);
+    {
+        const testing::InSequence seq;
+        EXPECT_CALL(gateway_mock, send(_, io::PayloadWith<Spec::Response>(mr_, res_tx))).WillOnce(Return(OptError{}));
+        EXPECT_CALL(gateway_mock, send(_, io::PayloadWith<Spec::Response>(mr_, res_rx))).WillOnce(Return(OptError{}));
+        EXPECT_CALL(gateway_mock, complete(OptError{}, false)).WillOnce(Return(OptError{}));
+        EXPECT_CALL(gateway_mock, deinit()).Times(1);
+    }
+    request(*ch_factory, gateway_mock);
+}
+
+TEST_F(TestSocketsService, request_with_bridge)
+{
+    CyPresentation   cy_presentation{mr_, scheduler_, cy_transport_mock_};
+    const ScvContext svc_context{mr_, scheduler_, ipc_router_mock_, cy_presentation};
+
+    EXPECT_CALL(ipc_router_mock_, registerChannelFactoryByName(_)).WillOnce(Return());
+    diag::SocketsService::registerWithContext(svc_context, transport_bag_mock_, &bridge_transport_bag_mock_);
+
+    auto* const ch_factory = ipc_router_mock_.getChannelFactory(svc_desc_);
+    ASSERT_THAT(ch_factory, NotNull());
+
+    StrictMock<GatewayMock> gateway_mock;
+
+    const std::vector<MediaSocketsReport> reports{{"127.0.0.1", {{"tx", false, 212992, 0, 0}}}};
+    const std::vector<MediaSocketsReport> bridge_reports{{"vcan0", {{"rx", true, 0, 3, 3}}}};
+    EXPECT_CALL(transport_bag_mock_, getMediaSocketsReports()).WillOnce(Return(reports));
+    EXPECT_CALL(bridge_transport_bag_mock_, getMediaSocketsReports()).WillOnce(Return(bridge_reports));
+
+    // Sockets of the bridge transport are reported after the primary ones.
+    const auto response = makeResponse(Spec::Response::TRANSPORT_PRIMARY, 0, reports[0], reports[0].sockets[0]);
+    const auto bridge_response =
+        makeResponse(Spec::Response::TRANSPORT_BRIDGE, 0, bridge_reports[0], bridge_reports[0].sockets[0]);
+    {
+        const testing::InSequence seq;
+        EXPECT_CALL(gateway_mock, send(_, io::PayloadWith<Spec::Response>(mr_, response)))
+            .WillOnce(Return(OptError{}));
+        EXPECT_CALL(gateway_mock, send(_, io::PayloadWith<Spec::Response>(mr_, bridge_response)))
+            .WillOnce(Return(OptError{}));
+        EXPECT_CALL(gateway_mock, complete(OptError{}, false)).WillOnce(Return(OptError{}));
+        EXPECT_CALL(gateway_mock, deinit()).Times(1);
+    }
+    request(*ch_factory, gateway_mock);
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+}  // namespace
+
+namespace ocvsmd
+{
+namespace common
+{
+namespace svc
+{
+namespace diag
+{
+namespace Sockets
+{
+static void PrintTo(const Response_0_1& res, std::ostream* os)  // NOLINT
+{
+    *os << "Sockets::Response_0_1{transport=" << +res.transport << ", media_index=" << +res.media_index
+        << ", is_rx=" << res.is_rx << ", kernel_drops=" << res.kernel_drops << "}";
+}
+static bool operator==(const Response_0_1& lhs, const Response_0_1& rhs)  // NOLINT
+{
+    return (lhs.transport == rhs.transport) && (lhs.media_index == rhs.media_index) &&
+           (lhs.iface_address == rhs.iface_address) && (lhs.endpoint == rhs.endpoint) && (lhs.is_rx == rhs.is_rx) &&
+           (lhs.buffer_size == rhs.buffer_size) && (lhs.kernel_drops == rhs.kernel_drops);
+}
+}  // namespace Sockets
+}  // namespace diag
+}  // namespace svc
+}  // namespace common
+}  // namespace ocvsmd
@@ -0,0 +1,220 @@
+//
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "svc/diag/tx_queues_service.hpp"
+
+#include "common/io/io_gtest_helpers.hpp"
+#include "common/ipc/gateway_mock.hpp"
+#include "common/ipc/server_router_mock.hpp"
+#include "daemon/engine/cyphal/any_transport_bag_mock.hpp"
+#include "daemon/engine/cyphal/transport_mock.hpp"
+#include "ipc/channel.hpp"
+#include "ocvsmd/sdk/defines.hpp"
+#include "platform/tx_queue_memory_resource.hpp"
+#include "svc/diag/tx_queues_spec.hpp"
+#include "svc/svc_helpers.hpp"
+#include "tracking_memory_resource.hpp"
+#include "virtual_time_scheduler.hpp"
+
+#include <libcyphal/presentation/presentation.hpp>
+#include <libcyphal/transport/types.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <ostream>
+#include <string>
+
+namespace
+{
+
+using namespace ocvsmd::common;               // NOLINT This our main concern here in the unit tests.
+using namespace ocvsmd::daemon::engine::svc;  // NOLINT This our main concern here in the unit tests.
+using ocvsmd::daemon::engine::cyphal::AnyTransportBagMock;
+using ocvsmd::daemon::engine::platform::TxQueueMemoryResource;
+using ocvsmd::sdk::OptError;
+
+using testing::_;
+using testing::IsNull;
+using testing::Return;
+using testing::IsEmpty;
+using testing::NotNull;
+using testing::StrictMock;
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+class TestTxQueuesService : public testing::Test
+{
+protected:
+    using Spec        = svc::diag::TxQueuesSpec;
+    using GatewayMock = ipc::detail::GatewayMock;
+
+    using CyPresentation   = libcyphal::presentation::Presentation;
+    using CyProtocolParams = libcyphal::transport::ProtocolParams;
+
+    void SetUp() override
+    {
+        cetl::pmr::set_default_resource(&mr_);
+
+        EXPECT_CALL(cy_transport_mock_, getProtocolParams())
+            .WillRepeatedly(
+                Return(CyProtocolParams{std::numeric_limits<libcyphal::transport::TransferId>::max(), 0, 0}));
+    }
+
+    void TearDown() override
+    {
+        EXPECT_THAT(mr_.allocations, IsEmpty());
+        EXPECT_THAT(mr_.total_allocated_bytes, mr_.total_deallocated_bytes);
+    }
+
+    Spec::Response makeResponse(const std::uint8_t transport, const TxQueueMemoryResource::Stats& stats)
+    {
+        Spec::Response response{&mr_};
+        response.transport   = transport;
+        response.is_adaptive = stats.is_adaptive;
+        response.capacity    = static_cast<std::uint32_t>(stats.capacity);
+        response.depth       = static_cast<std::uint32_t>(stats.depth);
+        response.depth_hwm   = static_cast<std::uint32_t>(stats.depth_hwm);
+        response.bytes       = stats.bytes;
+        response.bytes_hwm   = stats.bytes_hwm;
+        response.overflows   = stats.overflows;
+        response.grows       = stats.grows;
+        return response;
+    }
+
+    template <typename ChFactory>
+    void request(ChFactory& ch_factory, StrictMock<GatewayMock>& gateway_mock)
+    {
+        const Spec::Request request{&mr_};
+        const auto          result = tryPerformOnSerialized(request, [&](const auto payload) {
+            //
+            ch_factory(std::make_shared<GatewayMock::Wrapper>(gateway_mock), payload);
+            return OptError{};
+        });
+        EXPECT_THAT(result, OptError{});
+    }
+
+    // NOLINTBEGIN
+    ocvsmd::TrackingMemoryResource                  mr_;
+    ocvsmd::VirtualTimeScheduler                    scheduler_{};
+    StrictMock<libcyphal::transport::TransportMock> cy_transport_mock_;
+    StrictMock<ipc::ServerRouterMock>               ipc_router_mock_{mr_};
+    StrictMock<AnyTransportBagMock>                 transport_bag_mock_;
+    StrictMock<AnyTransportBagMock>                 bridge_transport_bag_mock_;
+    const std::string                               svc_name_{Spec::svc_full_name()};
+    const ipc::detail::ServiceDesc svc_desc_{ipc::AnyChannel::getServiceDesc<Spec::Request>(svc_name_)};
+    // NOLINTEND
+
+};  // TestTxQueuesService
+
+// MARK: - Tests:
+
+TEST_F(TestTxQueuesService, registerWithContext)
+{
+    CyPresentation   cy_presentation{mr_, scheduler_, cy_transport_mock_};
+    const ScvContext svc_context{mr_, scheduler_, ipc_router_mock_, cy_presentation};
+
+    EXPECT_THAT(ipc_router_mock_.getChannelFactory(svc_desc_), IsNull());
+
+    EXPECT_CALL(ipc_router_mock_, registerChannelFactoryByName(svc_name_)).WillOnce(Return());
+    diag::TxQueuesService::registerWithContext(svc_context, transport_bag_mock_, nullptr);
+
+    EXPECT_THAT(ipc_router_mock_.getChannelFactory(svc_desc_), NotNull());
+}
+
+TEST_F(TestTxQueuesService, request_primary_only)
+{
+    CyPresentation   cy_presentation{mr_, scheduler_, cy_transport_mock_};
+    const ScvContext svc_context{mr_, scheduler_, ipc_router_mock_, cy_presentation};
+
+    EXPECT_CALL(ipc_router_mock_, registerChannelFactoryByName(_)).WillOnce(Return());
+    diag::TxQueuesService::registerWithContext(svc_context, transport_bag_mock_, nullptr);
+
+    auto* const ch_factory = ipc_router_mock_.getChannelFactory(svc_desc_);
+    ASSERT_THAT(ch_factory, NotNull());
+
+    StrictMock<GatewayMock> gateway_mock;
+
+    const TxQueueMemoryResource::Stats stats{true, 512, 3, 100, 216, 7200, 2, 1};
+    EXPECT_CALL(transport_bag_mock_, getTxQueueStats()).WillOnce(Return(stats));
+
+    const auto response = makeResponse(Spec::Response::TRANSPORT_PRIMARY, stats);
+    {
+        const testing::InSequence seq;
+        EXPECT_CALL(gateway_mock, send(_, io::PayloadWith<Spec::Response>(mr_, response)))
+            .WillOnce(Return(OptError{}));
+        EXPECT_CALL(gateway_mock, complete(OptError{}, false)).WillOnce(Return(OptError{}));
+        EXPECT_CALL(gateway_mock, deinit()).Times(1);
+    }
+    request(*ch_factory, gateway_mock);
+}
+
+TEST_F(TestTxQueuesService, request_with_bridge)
+{
+    CyPresentation   cy_presentation{mr_, scheduler_, cy_transport_mock_};
+    const ScvContext svc_context{mr_, scheduler_, ipc_router_mock_, cy_presentation};
+
+    EXPECT_CALL(ipc_router_mock_, registerChannelFactoryByName(_)).WillOnce(Return());
+    diag::TxQueuesService::registerWithContext(svc_context, transport_bag_mock_, &bridge_transport_bag_mock_);
+
+    auto* const ch_factory = ipc_router_mock_.getChannelFactory(svc_desc_);
+    ASSERT_THAT(ch_factory, NotNull());
+
+    StrictMock<GatewayMock> gateway_mock;
+
+    const TxQueueMemoryResource::Stats stats{false, 256, 0, 10, 0, 720, 0, 0};
+    const TxQueueMemoryResource::Stats bridge_stats{true, 128, 5, 64, 40, 512, 9, 3};
+    EXPECT_CALL(transport_bag_mock_, getTxQueueStats()).WillOnce(Return(stats));
+    EXPECT_CALL(bridge_transport_bag_mock_, getTxQueueStats()).WillOnce(Return(bridge_stats));
+
+    // Stats of the bridge transport are reported after the primary ones.
+    const auto response        = makeResponse(Spec::Response::TRANSPORT_PRIMARY, stats);
+    const auto bridge_response = makeResponse(Spec::Response::TRANSPORT_BRIDGE, bridge_stats);
+    {
+        const testing::InSequence seq;
+        EXPECT_CALL(gateway_mock, send(_, io::PayloadWith<Spec::Response>(mr_, response)))
+            .WillOnce(Return(OptError{}));
+        EXPECT_CALL(gateway_mock, send(_, io::PayloadWith<Spec::Response>(mr_, bridge_response)))
+            .WillOnce(Return(OptError{}));
+        EXPECT_CALL(gateway_mock, complete(OptError{}, false)).WillOnce(Return(OptError{}));
+        EXPECT_CALL(gateway_mock, deinit()).Times(1);
+    }
+    request(*ch_factory, gateway_mock);
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+}  // namespace
+
+namespace ocvsmd
+{
+namespace common
+{
+namespace svc
+{
+namespace diag
+{
+namespace TxQueues
+{
+static void PrintTo(const Response_0_1& res, std::ostream* os)  // NOLINT
+{
+    *os << "TxQueues::Response_0_1{transport=" << +res.transport << ", depth=" << res.depth
+        << ", overflows=" << res.overflows << "}";
+}
+static bool operator==(const Response_0_1& lhs, const Response_0_1& rhs)  // NOLINT
+{
+    return (lhs.transport == rhs.transport) && (lhs.is_adaptive == rhs.is_adaptive) &&
+           (lhs.capacity == rhs.capacity) && (lhs.depth == rhs.depth) && (lhs.depth_hwm == rhs.depth_hwm) &&
+           (lhs.bytes == rhs.bytes) && (lhs.bytes_hwm == rhs.bytes_hwm) && (lhs.overflows == rhs.overflows) &&
+           (lhs.grows == rhs.grows);
+}
+}  // namespace TxQueues
+}  // namespace diag
+}  // namespace svc
+}  // namespace common
+}  // namespace ocvsmd
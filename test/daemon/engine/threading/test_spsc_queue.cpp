@@ -0,0 +1,204 @@
+//
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "threading/spsc_queue.hpp"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+using ocvsmd::daemon::engine::threading::SpscQueue;
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+TEST(TestSpscQueue, capacity_is_power_of_two)
+{
+    EXPECT_THAT(SpscQueue<int>{1}.capacity(), 1U);
+    EXPECT_THAT(SpscQueue<int>{3}.capacity(), 4U);
+    EXPECT_THAT(SpscQueue<int>{1024}.capacity(), 1024U);
+    EXPECT_THAT(SpscQueue<int>{1025}.capacity(), 2048U);
+}
+
+TEST(TestSpscQueue, push_pop_in_order)
+{
+    SpscQueue<int> queue{4};
+
+    int item = 0;
+    EXPECT_FALSE(queue.tryPop(item));
+
+    // Wrap around the slots a few times.
+    //
+    for (int round = 0; round < 3; ++round)
+    {
+        for (int i = 0; i < 4; ++i)
+        {
+            EXPECT_TRUE(queue.tryPush(round * 10 + i));
+        }
+        EXPECT_FALSE(queue.tryPush(42));
+
+        for (int i = 0; i < 4; ++i)
+        {
+            EXPECT_TRUE(queue.tryPop(item));
+            EXPECT_THAT(item, round * 10 + i);
+        }
+        EXPECT_FALSE(queue.tryPop(item));
+    }
+}
+
+TEST(TestSpscQueue, move_only_items)
+{
+    SpscQueue<std::unique_ptr<int>> queue{2};
+
+    EXPECT_TRUE(queue.tryPush(std::make_unique<int>(1)));
+    EXPECT_TRUE(queue.tryPush(std::make_unique<int>(2)));
+
+    // Rejected item should stay intact.
+    //
+    auto rejected = std::make_unique<int>(3);
+    EXPECT_FALSE(queue.tryPush(std::move(rejected)));
+    ASSERT_THAT(rejected, testing::NotNull());
+    EXPECT_THAT(*rejected, 3);
+
+    std::unique_ptr<int> item;
+    EXPECT_TRUE(queue.tryPop(item));
+    ASSERT_THAT(item, testing::NotNull());
+    EXPECT_THAT(*item, 1);
+}
+
+TEST(TestSpscQueue, two_threads)
+{
+    constexpr std::uint64_t Count = 100000;
+
+    SpscQueue<std::uint64_t> queue{64};
+
+    std::thread producer{[&queue] {
+        for (std::uint64_t value = 0; value < Count; ++value)
+        {
+            while (!queue.tryPush(std::uint64_t{value}))
+            {
+                std::this_thread::yield();
+            }
+        }
+    }};
+
+    std::uint64_t expected = 0;
+    std::uint64_t item     = 0;
+    while (expected < Count)
+    {
+        if (!queue.tryPop(item))
+        {
+            std::this_thread::yield();
+            continue;
+        }
+        ASSERT_THAT(item, expected);
+        ++expected;
+    }
+    producer.join();
+}
+
+/// Models relay throughput scaling - a frame passes through a fixed amount of work (like RX parsing,
+/// routing, serialization and TX), which is split into 1 to 4 stages - one thread per stage,
+/// connected by SPSC queues (the same way the engine and IPC threads are).
+///
+/// Disabled by default b/c it's a benchmark (without any assertions) - run it with `--gtest_also_run_disabled_tests`.
+///
+TEST(TestSpscQueue, DISABLED_benchmark_relay_scaling)
+{
+    constexpr std::size_t   Frames      = 200000;
+    constexpr std::size_t   FrameSize   = 64;
+    constexpr std::size_t   WorkPerByte = 16;
+    constexpr std::size_t   MaxThreads  = 4;
+    constexpr std::size_t   Capacity    = 1024;
+    constexpr std::uint64_t Multiplier  = 0x100000001B3ULL;
+
+    using Frame = std::array<std::uint8_t, FrameSize>;
+
+    // Does its share of the (FNV-like hashing) work per frame - so that all stages together do the same amount.
+    //
+    const auto do_work = [](Frame& frame, const std::size_t stages) {
+        //
+        std::uint64_t hash = frame[0];
+        for (std::size_t i = 0; i < (FrameSize * WorkPerByte) / stages; ++i)
+        {
+            hash = (hash ^ frame[i % FrameSize]) * Multiplier;
+        }
+        frame[0] = static_cast<std::uint8_t>(hash);
+    };
+
+    for (std::size_t threads = 1; threads <= MaxThreads; ++threads)
+    {
+        std::vector<std::unique_ptr<SpscQueue<Frame>>> queues;
+        for (std::size_t i = 0; i + 1 < threads; ++i)
+        {
+            queues.push_back(std::make_unique<SpscQueue<Frame>>(Capacity));
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+
+        std::vector<std::thread> stages;
+        for (std::size_t stage = 0; stage < threads; ++stage)
+        {
+            stages.emplace_back([&, stage] {
+                //
+                SpscQueue<Frame>* const in  = (stage > 0) ? queues[stage - 1].get() : nullptr;
+                SpscQueue<Frame>* const out = (stage + 1 < threads) ? queues[stage].get() : nullptr;
+
+                Frame frame{};
+                for (std::size_t n = 0; n < Frames; ++n)
+                {
+                    if (in != nullptr)
+                    {
+                        while (!in->tryPop(frame))
+                        {
+                            std::this_thread::yield();
+                        }
+                    }
+                    else
+                    {
+                        frame[0] = static_cast<std::uint8_t>(n);
+                    }
+
+                    do_work(frame, threads);
+
+                    if (out != nullptr)
+                    {
+                        while (!out->tryPush(std::move(frame)))
+                        {
+                            std::this_thread::yield();
+                        }
+                    }
+                }
+            });
+        }
+        for (auto& stage : stages)
+        {
+            stage.join();
+        }
+
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+        const auto elapsed_us =
+            std::max<std::int64_t>(1, std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count());
+
+        std::cout << threads << " thread(s): " << Frames << " frames, " << (Frames * 1000000ULL) / elapsed_us
+                  << " frames/s (hw_concurrency=" << std::thread::hardware_concurrency() << ").\n";
+    }
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+}  // namespace
@@ -0,0 +1,225 @@
+//
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "threading/threaded_server_pipe.hpp"
+
+#include "io/socket_address.hpp"
+#include "io/socket_buffer.hpp"
+#include "ipc/pipe/client_pipe.hpp"
+#include "ipc/pipe/server_pipe.hpp"
+#include "ipc/pipe/socket_client.hpp"
+#include "ocvsmd/platform/defines.hpp"
+#include "ocvsmd/sdk/defines.hpp"
+
+#include <cetl/pf17/cetlpf.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <unistd.h>
+
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+using ocvsmd::common::io::Payload;
+using ocvsmd::common::io::SocketAddress;
+using ocvsmd::common::io::SocketBuffer;
+using ocvsmd::common::ipc::pipe::ClientPipe;
+using ocvsmd::common::ipc::pipe::ServerPipe;
+using ocvsmd::common::ipc::pipe::SocketClient;
+using ocvsmd::daemon::engine::threading::ThreadedServerPipe;
+using ocvsmd::sdk::Error;
+using ocvsmd::sdk::OptError;
+
+using testing::Ne;
+using testing::ElementsAre;
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+/// Makes (unique per test process) address of an abstract unix socket.
+///
+SocketAddress makeAddress(const std::string& name)
+{
+    const auto  conn_str     = "unix-abstract:ocvsmd-test-" + name + "-" + std::to_string(::getpid());
+    auto        maybe_result = SocketAddress::parse(conn_str, 0);
+    const auto* success      = cetl::get_if<SocketAddress>(&maybe_result);
+    EXPECT_THAT(success, testing::NotNull());
+    return (success != nullptr) ? *success : SocketAddress{};
+}
+
+std::string toString(const Payload payload)
+{
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    return {reinterpret_cast<const char*>(payload.data()), payload.size()};
+}
+
+Payload toPayload(const std::string& str)
+{
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    return {reinterpret_cast<const cetl::byte*>(str.data()), str.size()};
+}
+
+TEST(TestThreadedServerPipe, start_failure)
+{
+    ocvsmd::platform::SingleThreadedExecutor executor;
+
+    // The address is already taken by another pipe - so the inner socket server of the IPC thread
+    // fails to start, and the failure is reported synchronously (and the IPC thread is gone).
+    //
+    const auto                     address = makeAddress("start-failure");
+    ThreadedServerPipe             first_pipe{executor, address};
+    ThreadedServerPipe             second_pipe{executor, address};
+    const ServerPipe::EventHandler handler = [](const auto&) { return OptError{}; };
+    EXPECT_THAT(static_cast<ServerPipe&>(first_pipe).start(handler), OptError{});
+    EXPECT_THAT(static_cast<ServerPipe&>(second_pipe).start(handler), Ne(OptError{}));
+}
+
+TEST(TestThreadedServerPipe, inbound_and_outbound_relay)
+{
+    ocvsmd::platform::SingleThreadedExecutor executor;
+
+    const auto         address = makeAddress("relay");
+    ThreadedServerPipe threaded_pipe{executor, address};
+    auto&              server_pipe = static_cast<ServerPipe&>(threaded_pipe);
+
+    // Server events are delivered on the engine (this) thread.
+    //
+    std::vector<std::string>             server_messages;
+    cetl::optional<ServerPipe::ClientId> client_id;
+    bool                                 is_disconnected = false;
+    const auto                           engine_thread   = std::this_thread::get_id();
+
+    const auto server_error = server_pipe.start([&](const ServerPipe::Event::Var& event) {
+        //
+        EXPECT_THAT(std::this_thread::get_id(), engine_thread);
+        if (const auto* const connected = cetl::get_if<ServerPipe::Event::Connected>(&event))
+        {
+            client_id = connected->client_id;
+        }
+        else if (const auto* const message = cetl::get_if<ServerPipe::Event::Message>(&event))
+        {
+            EXPECT_TRUE(client_id == message->client_id);
+            server_messages.push_back(toString(message->payload));
+        }
+        else if (cetl::get_if<ServerPipe::Event::Disconnected>(&event) != nullptr)
+        {
+            is_disconnected = true;
+        }
+        return OptError{};
+    });
+    EXPECT_THAT(server_error, OptError{});
+
+    std::vector<std::string> client_messages;
+    bool                     is_connected = false;
+    {
+        SocketClient client{executor, address};
+        auto&        client_pipe  = static_cast<ClientPipe&>(client);
+        const auto   client_error = client_pipe.start([&](const ClientPipe::Event::Var& event) {
+            //
+            if (cetl::get_if<ClientPipe::Event::Connected>(&event) != nullptr)
+            {
+                is_connected = true;
+            }
+            else if (const auto* const message = cetl::get_if<ClientPipe::Event::Message>(&event))
+            {
+                client_messages.push_back(toString(message->payload));
+            }
+            return OptError{};
+        });
+        EXPECT_THAT(client_error, OptError{});
+        ocvsmd::platform::waitPollingUntil(executor, [&] { return is_connected && client_id.has_value(); });
+
+        // Inbound - from the client to the engine (via the IPC thread).
+        //
+        const std::string request{"request"};
+        SocketBuffer      request_buffer{toPayload(request)};
+        EXPECT_THAT(client_pipe.send(request_buffer), OptError{});
+        ocvsmd::platform::waitPollingUntil(executor, [&] { return !server_messages.empty(); });
+        EXPECT_THAT(server_messages, ElementsAre(request));
+
+        // Outbound - from the engine to the client (via the IPC thread).
+        //
+        const std::string response{"response"};
+        SocketBuffer      response_buffer{toPayload(response)};
+        EXPECT_THAT(server_pipe.send(*client_id, response_buffer), OptError{});
+        ocvsmd::platform::waitPollingUntil(executor, [&] { return !client_messages.empty(); });
+        EXPECT_THAT(client_messages, ElementsAre(response));
+    }
+    ocvsmd::platform::waitPollingUntil(executor, [&] { return is_disconnected; });
+}
+
+TEST(TestThreadedServerPipe, send_to_full_queue_is_busy)
+{
+    ocvsmd::platform::SingleThreadedExecutor executor;
+
+    // The pipe is not started - so there is no IPC thread to drain the outbound queue.
+    //
+    ThreadedServerPipe threaded_pipe{executor, makeAddress("busy")};
+    auto&              server_pipe = static_cast<ServerPipe&>(threaded_pipe);
+
+    const std::string frame{"frame"};
+    for (std::size_t index = 0; index < ThreadedServerPipe::QueueCapacity; ++index)
+    {
+        SocketBuffer sock_buff{toPayload(frame)};
+        EXPECT_THAT(server_pipe.send(1, sock_buff), OptError{});
+    }
+    SocketBuffer sock_buff{toPayload(frame)};
+    EXPECT_THAT(server_pipe.send(1, sock_buff), OptError{Error{Error::Code::Busy}});
+}
+
+TEST(TestThreadedServerPipe, shutdown_with_full_inbound_queue)
+{
+    ocvsmd::platform::SingleThreadedExecutor executor;
+
+    const auto address      = makeAddress("shutdown");
+    bool       is_connected = false;
+    {
+        ThreadedServerPipe threaded_pipe{executor, address};
+        auto&              server_pipe = static_cast<ServerPipe&>(threaded_pipe);
+
+        bool       has_client   = false;
+        const auto server_error = server_pipe.start([&has_client](const ServerPipe::Event::Var& event) {
+            //
+            has_client = has_client || (cetl::get_if<ServerPipe::Event::Connected>(&event) != nullptr);
+            return OptError{};
+        });
+        EXPECT_THAT(server_error, OptError{});
+
+        SocketClient client{executor, address};
+        auto&        client_pipe  = static_cast<ClientPipe&>(client);
+        const auto   client_error = client_pipe.start([&is_connected](const ClientPipe::Event::Var& event) {
+            //
+            is_connected = is_connected || (cetl::get_if<ClientPipe::Event::Connected>(&event) != nullptr);
+            return OptError{};
+        });
+        EXPECT_THAT(client_error, OptError{});
+        ocvsmd::platform::waitPollingUntil(executor, [&] { return is_connected && has_client; });
+
+        // The engine (this thread) doesn't spin anymore - so the IPC thread fills the inbound queue up,
+        // and then waits (backpressure) for the engine to make some room in it.
+        //
+        const std::string message{"message"};
+        for (std::size_t index = 0; index < ThreadedServerPipe::QueueCapacity + 16; ++index)
+        {
+            SocketBuffer sock_buff{toPayload(message)};
+            EXPECT_THAT(client_pipe.send(sock_buff), OptError{});
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds{100});
+
+        // Destruction of the pipe (at the end of this scope) must not hang - even though the IPC thread
+        // is stuck in the backpressure.
+    }
+    EXPECT_TRUE(is_connected);
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+}  // namespace
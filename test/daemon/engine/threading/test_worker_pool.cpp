@@ -0,0 +1,138 @@
+//
+// Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "threading/worker_pool.hpp"
+
+#include "ocvsmd/platform/defines.hpp"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <thread>
+#include <utility>
+
+namespace
+{
+
+using ocvsmd::daemon::engine::threading::WorkerPool;
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+TEST(TestWorkerPool, work_on_worker_and_completion_on_executor)
+{
+    ocvsmd::platform::SingleThreadedExecutor executor;
+
+    const auto worker_pool = WorkerPool::make(executor, 2);
+    ASSERT_THAT(worker_pool, testing::NotNull());
+    EXPECT_THAT(worker_pool->threadsCount(), 2U);
+
+    std::thread::id work_thread_id;
+    std::thread::id completion_thread_id;
+    bool            is_completed = false;
+    worker_pool->post([&work_thread_id] { work_thread_id = std::this_thread::get_id(); },
+                      [&] {
+                          completion_thread_id = std::this_thread::get_id();
+                          is_completed         = true;
+                      });
+
+    ocvsmd::platform::waitPollingUntil(executor, [&is_completed] { return is_completed; });
+    EXPECT_THAT(work_thread_id, testing::Ne(std::this_thread::get_id()));
+    EXPECT_THAT(completion_thread_id, std::this_thread::get_id());
+}
+
+TEST(TestWorkerPool, submit_passes_result)
+{
+    ocvsmd::platform::SingleThreadedExecutor executor;
+
+    const auto worker_pool = WorkerPool::make(executor, 2);
+    ASSERT_THAT(worker_pool, testing::NotNull());
+
+    // Completions of many tasks (executed concurrently by the workers) are all delivered to the executor.
+    //
+    constexpr std::size_t Tasks = 100;
+    std::size_t           total = 0;
+    std::size_t           count = 0;
+    for (std::size_t index = 1; index <= Tasks; ++index)
+    {
+        worker_pool->submit([index] { return std::to_string(index); },
+                            [&total, &count](std::string&& result) {
+                                total += std::stoul(result);
+                                ++count;
+                            });
+    }
+
+    ocvsmd::platform::waitPollingUntil(executor, [&count] { return count == Tasks; });
+    EXPECT_THAT(total, Tasks * (Tasks + 1) / 2);
+}
+
+TEST(TestWorkerPool, no_threads_runs_inline)
+{
+    ocvsmd::platform::SingleThreadedExecutor executor;
+
+    const auto worker_pool = WorkerPool::make(executor, 0);
+    ASSERT_THAT(worker_pool, testing::NotNull());
+    EXPECT_THAT(worker_pool->threadsCount(), 0U);
+
+    int result = 0;
+    worker_pool->submit([] { return 42; }, [&result](const int value) { result = value; });
+    EXPECT_THAT(result, 42);
+}
+
+TEST(TestWorkerPool, destroyed_with_pending_work)
+{
+    ocvsmd::platform::SingleThreadedExecutor executor;
+
+    // Destruction waits for the work in progress only - the rest of work with completions
+    // (and all completions) are dropped.
+    //
+    std::size_t completions = 0;
+    {
+        const auto worker_pool = WorkerPool::make(executor, 1);
+        ASSERT_THAT(worker_pool, testing::NotNull());
+        for (std::size_t index = 0; index < 10; ++index)
+        {
+            worker_pool->post([] { std::this_thread::sleep_for(std::chrono::milliseconds{1}); },
+                              [&completions] { ++completions; });
+        }
+    }
+    (void) executor.spinOnce();
+    EXPECT_THAT(completions, 0U);
+}
+
+TEST(TestWorkerPool, destroyed_with_pending_work_without_completion)
+{
+    ocvsmd::platform::SingleThreadedExecutor executor;
+
+    // Work without completion (f.e. a config save) is never dropped - destruction waits for all of it.
+    //
+    std::atomic<std::size_t> works{0};
+    std::size_t              completions = 0;
+    {
+        const auto worker_pool = WorkerPool::make(executor, 1);
+        ASSERT_THAT(worker_pool, testing::NotNull());
+        for (std::size_t index = 0; index < 10; ++index)
+        {
+            worker_pool->post(
+                [&works] {
+                    std::this_thread::sleep_for(std::chrono::milliseconds{1});
+                    ++works;
+                },
+                {});
+            worker_pool->post([] { std::this_thread::sleep_for(std::chrono::milliseconds{1}); },
+                              [&completions] { ++completions; });
+        }
+    }
+    (void) executor.spinOnce();
+    EXPECT_THAT(works.load(), 10U);
+    EXPECT_THAT(completions, 0U);
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+}  // namespace